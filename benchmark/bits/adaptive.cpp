@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <dynamic_bitset/adaptive_bitset.hpp>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/density.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <map>
+#include <random>
+#include <utility>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Universe of the compared sets, 2^28 bits keep two flat operands and the result in memory.
+ */
+constexpr std::size_t kAdaptiveBenchmarkBits{std::size_t{1} << 28};
+
+inline auto MemoryUsage(const AdaptiveBitset<>& bits) -> std::size_t { return bits.MemoryUsage(); }
+
+/**
+ * @internal
+ * @brief Flat set of about `elements` uniform random bits, built once per arguments.
+ * @details Sets denser than a half start full and clear random bits instead.
+ */
+inline auto GetUniverseInput(long long elements, std::uint32_t seed) -> const DynamicBitset<>& {
+  static std::map<std::pair<long long, std::uint32_t>, DynamicBitset<>> inputs;
+  auto [input, inserted]{inputs.try_emplace({elements, seed}, kAdaptiveBenchmarkBits)};
+  if (inserted) {
+    DynamicBitset<>& bits{input->second};
+    std::mt19937_64 engine{seed};
+    const bool dense{static_cast<std::size_t>(elements) > kAdaptiveBenchmarkBits / 2};
+    if (dense) {
+      bits.Set();
+    }
+    const std::size_t updates{dense ? kAdaptiveBenchmarkBits - static_cast<std::size_t>(elements)
+                                    : static_cast<std::size_t>(elements)};
+    for (std::size_t update{}; update < updates; ++update) {
+      bits.Set(engine() % kAdaptiveBenchmarkBits, !dense);
+    }
+  }
+  return input->second;
+}
+
+/**
+ * @internal
+ * @brief Binary operation between two sets of about `state.range(0)` elements each.
+ * @details Operation: '&' or '|'. Items are elements of both operands, `bytes` is the memory of one operand.
+ */
+template<typename Container, char Operation>
+auto BM_AdaptiveOperation(::benchmark::State& state) -> void {
+  const Container lhs{GetUniverseInput(state.range(0), 1)};
+  const Container rhs{GetUniverseInput(state.range(0), 2)};
+
+  for (auto _ : state) {
+    if constexpr (Operation == '&') {
+      ::benchmark::DoNotOptimize(lhs & rhs);
+    } else {
+      ::benchmark::DoNotOptimize(lhs | rhs);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(lhs.Count() + rhs.Count()));
+  state.counters["bytes"] = static_cast<double>(MemoryUsage(lhs));
+}
+
+/**
+ * @internal
+ * @brief From 10 elements to 90% of the universe, 8388608 is the largest array.
+ */
+inline auto AdaptiveGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgName("elements")
+    ->Arg(10)
+    ->Arg(1'000)
+    ->Arg(100'000)
+    ->Arg(8'388'608)
+    ->Arg(26'843'546)
+    ->Arg(241'591'910)
+    ->Unit(::benchmark::kMicrosecond);
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_AdaptiveOperationBenchmark(container, operation, func)      \
+  BENCHMARK(bits::benchmark::BM_AdaptiveOperation<container, operation>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))                 \
+    ->Apply(bits::benchmark::AdaptiveGenerator)
+
+BITS_AdaptiveOperationBenchmark(bits::AdaptiveBitset<>, '&', operator&);
+BITS_AdaptiveOperationBenchmark(bits::DynamicBitset<>, '&', operator&);
+BITS_AdaptiveOperationBenchmark(bits::AdaptiveBitset<>, '|', operator|);
+BITS_AdaptiveOperationBenchmark(bits::DynamicBitset<>, '|', operator|);
@@ -0,0 +1,149 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/concurrency.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/slot_allocator.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Free-slot map searched from the beginning under a mutex, baseline for slot allocation.
+ */
+class LockedSlotAllocator {
+ public:
+  explicit LockedSlotAllocator(std::size_t slots) : bits_(slots) { }
+
+  [[nodiscard]] auto Size() const noexcept -> std::size_t { return bits_.Size(); }
+
+  [[nodiscard]] auto Acquire() -> std::size_t {
+    const std::lock_guard lock{mutex_};
+    const std::size_t* data{bits_.Data()};
+    for (std::size_t block{}; block < bits_.NumBlocks(); ++block) {
+      if (const std::size_t index{block * 64 + static_cast<std::size_t>(std::countr_one(data[block]))};
+          index < bits_.Size() && ~data[block]) {
+        bits_.Set(index, true);
+        return index;
+      }
+    }
+    return bits_.Size();
+  }
+
+  [[nodiscard]] auto AcquireN(std::size_t count) -> std::size_t {
+    const std::lock_guard lock{mutex_};
+    std::size_t length{};
+    for (std::size_t index{}; index < bits_.Size(); ++index) {
+      length = bits_.Test(index) ? 0 : length + 1;
+      if (length == count) {
+        for (std::size_t slot{index + 1 - count}; slot <= index; ++slot) {
+          bits_.Set(slot, true);
+        }
+        return index + 1 - count;
+      }
+    }
+    return bits_.Size();
+  }
+
+  auto Release(std::size_t index) -> void {
+    const std::lock_guard lock{mutex_};
+    bits_.Reset(index);
+  }
+
+  auto ReleaseN(std::size_t index, std::size_t count) -> void {
+    const std::lock_guard lock{mutex_};
+    for (std::size_t slot{index}; slot < index + count; ++slot) {
+      bits_.Reset(slot);
+    }
+  }
+
+ private:
+  DynamicBitset<> bits_;
+  std::mutex mutex_;
+};
+
+/**
+ * @internal
+ * @brief Creates a pool of `state.range(0)` slots with `state.range(1)` percent of them acquired.
+ * @details Slots are acquired in random groups of 64, so free runs for `AcquireN()` remain at any occupancy.
+ */
+template<typename Container>
+auto SetupOccupiedSlots(const ::benchmark::State& state) -> void {
+  SetupSharedBits<Container>(state);
+  Container& slots{*g_shared_bits<Container>};
+  const auto occupancy{static_cast<std::uint64_t>(state.range(1))};
+  ::benchmark::DoNotOptimize(slots.AcquireN(slots.Size()));
+  for (std::size_t slot{}; slot < slots.Size(); ++slot) {
+    if ((slot / 64 * 0x9E3779B97F4A7C15ULL >> 32) % 100 >= occupancy) {
+      slots.Release(slot);
+    }
+  }
+}
+
+/**
+ * @internal
+ * @brief Slot churn: every thread acquires one slot and releases it.
+ */
+template<typename Container>
+auto BM_SlotAcquireRelease(::benchmark::State& state) -> void {
+  Container& slots{*g_shared_bits<Container>};
+
+  for (auto _ : state) {
+    const std::size_t slot{slots.Acquire()};
+    ::benchmark::DoNotOptimize(slot);
+    if (slot != slots.Size()) {
+      slots.Release(slot);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @internal
+ * @brief Run churn: every thread acquires 16 consecutive slots and releases them.
+ */
+template<typename Container>
+auto BM_SlotAcquireReleaseN(::benchmark::State& state) -> void {
+  constexpr std::size_t kRun{16};
+  Container& slots{*g_shared_bits<Container>};
+
+  for (auto _ : state) {
+    const std::size_t slot{slots.AcquireN(kRun)};
+    ::benchmark::DoNotOptimize(slot);
+    if (slot != slots.Size()) {
+      slots.ReleaseN(slot, kRun);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @internal
+ * @brief 1M slots, empty, 90% and 99% acquired, 1 to 2 * cores threads.
+ */
+inline auto OccupancyGenerator(::benchmark::internal::Benchmark* b) -> void {
+  const int threads{static_cast<int>(std::max(2U, std::thread::hardware_concurrency() * 2))};
+  b->ArgNames({"slots", "occupancy"})->ArgsProduct({{1 << 20}, {0, 90, 99}})->ThreadRange(1, threads)->UseRealTime();
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_SlotAllocatorBenchmark(benchmark_function, container, func) \
+  BENCHMARK(bits::benchmark::benchmark_function<container>)              \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))                 \
+    ->Setup(bits::benchmark::SetupOccupiedSlots<container>)              \
+    ->Teardown(bits::benchmark::TeardownSharedBits<container>)           \
+    ->Apply(bits::benchmark::OccupancyGenerator)
+
+BITS_SlotAllocatorBenchmark(BM_SlotAcquireRelease, bits::BitmapSlotAllocator<>, Acquire()/Release());
+BITS_SlotAllocatorBenchmark(BM_SlotAcquireRelease, bits::benchmark::LockedSlotAllocator, Acquire()/Release());
+BITS_SlotAllocatorBenchmark(BM_SlotAcquireReleaseN, bits::BitmapSlotAllocator<>, AcquireN(16)/ReleaseN());
+BITS_SlotAllocatorBenchmark(BM_SlotAcquireReleaseN, bits::benchmark::LockedSlotAllocator, AcquireN(16)/ReleaseN());
@@ -0,0 +1,29 @@
+#include <benchmark/benchmark.h>
+
+#include <dynamic_bitset/atomic_dynamic_bitset.hpp>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/concurrency.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+
+namespace bits::benchmark {
+
+inline auto BM_AtomicSnapshot(::benchmark::State& state) -> void {
+  const AtomicDynamicBitset<> bits{static_cast<std::size_t>(state.range(0))};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(bits.Snapshot());
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+}
+
+}  // namespace bits::benchmark
+
+BITS_ConcurrentBenchmark(BM_ConcurrentTestAndSet, bits::AtomicDynamicBitset<>, TestAndSet());
+BITS_ConcurrentBenchmark(BM_ConcurrentTestAndSet, bits::benchmark::LockedDynamicBitset, TestAndSet());
+BITS_ConcurrentBenchmark(BM_ConcurrentSetReset, bits::AtomicDynamicBitset<>, TestAndSet()/Reset());
+BITS_ConcurrentBenchmark(BM_ConcurrentSetReset, bits::benchmark::LockedDynamicBitset, TestAndSet()/Reset());
+
+BENCHMARK(bits::benchmark::BM_AtomicSnapshot)
+  ->Name(BITS_BenchmarkNameGenerator(bits::AtomicDynamicBitset<>, Snapshot()))
+  ->Apply(BITS_DefaultRangeGenerator);
@@ -203,4 +203,52 @@ BITS_XorOperatorBenchmark(BITS_DB(unsigned), operator^=);
 BITS_XorOperatorBenchmark(BITS_DB(unsigned long), operator^=);
 BITS_XorOperatorBenchmark(BITS_DB(unsigned long long), operator^=);
 
+BITS_LeftShiftBenchmark(BITS_DB(unsigned char), operator<<=);
+BITS_LeftShiftBenchmark(BITS_DB(unsigned short), operator<<=);
+BITS_LeftShiftBenchmark(BITS_DB(unsigned), operator<<=);
+BITS_LeftShiftBenchmark(BITS_DB(unsigned long), operator<<=);
+BITS_LeftShiftBenchmark(BITS_DB(unsigned long long), operator<<=);
+
+BITS_RightShiftBenchmark(BITS_DB(unsigned char), operator>>=);
+BITS_RightShiftBenchmark(BITS_DB(unsigned short), operator>>=);
+BITS_RightShiftBenchmark(BITS_DB(unsigned), operator>>=);
+BITS_RightShiftBenchmark(BITS_DB(unsigned long), operator>>=);
+BITS_RightShiftBenchmark(BITS_DB(unsigned long long), operator>>=);
+
+BITS_EqualOperatorBenchmark(BITS_DB(unsigned char), operator==);
+BITS_EqualOperatorBenchmark(BITS_DB(unsigned short), operator==);
+BITS_EqualOperatorBenchmark(BITS_DB(unsigned), operator==);
+BITS_EqualOperatorBenchmark(BITS_DB(unsigned long), operator==);
+BITS_EqualOperatorBenchmark(BITS_DB(unsigned long long), operator==);
+
+BITS_ResizeBenchmark(BITS_DB(unsigned char), Resize());
+BITS_ResizeBenchmark(BITS_DB(unsigned short), Resize());
+BITS_ResizeBenchmark(BITS_DB(unsigned), Resize());
+BITS_ResizeBenchmark(BITS_DB(unsigned long), Resize());
+BITS_ResizeBenchmark(BITS_DB(unsigned long long), Resize());
+
+BITS_ReserveBenchmark(BITS_DB(unsigned char), Reserve());
+BITS_ReserveBenchmark(BITS_DB(unsigned short), Reserve());
+BITS_ReserveBenchmark(BITS_DB(unsigned), Reserve());
+BITS_ReserveBenchmark(BITS_DB(unsigned long), Reserve());
+BITS_ReserveBenchmark(BITS_DB(unsigned long long), Reserve());
+
+BITS_ShrinkToFitBenchmark(BITS_DB(unsigned char), ShrinkToFit());
+BITS_ShrinkToFitBenchmark(BITS_DB(unsigned short), ShrinkToFit());
+BITS_ShrinkToFitBenchmark(BITS_DB(unsigned), ShrinkToFit());
+BITS_ShrinkToFitBenchmark(BITS_DB(unsigned long), ShrinkToFit());
+BITS_ShrinkToFitBenchmark(BITS_DB(unsigned long long), ShrinkToFit());
+
+BITS_FindFirstBenchmark(BITS_DB(unsigned char), FindFirst());
+BITS_FindFirstBenchmark(BITS_DB(unsigned short), FindFirst());
+BITS_FindFirstBenchmark(BITS_DB(unsigned), FindFirst());
+BITS_FindFirstBenchmark(BITS_DB(unsigned long), FindFirst());
+BITS_FindFirstBenchmark(BITS_DB(unsigned long long), FindFirst());
+
+BITS_FindNextLoopBenchmark(BITS_DB(unsigned char), FindNext());
+BITS_FindNextLoopBenchmark(BITS_DB(unsigned short), FindNext());
+BITS_FindNextLoopBenchmark(BITS_DB(unsigned), FindNext());
+BITS_FindNextLoopBenchmark(BITS_DB(unsigned long), FindNext());
+BITS_FindNextLoopBenchmark(BITS_DB(unsigned long long), FindNext());
+
 BENCHMARK_MAIN();
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/breadth_first_search.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <execution>
+#include <map>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Undirected RMAT graph (a = 0.57, b = c = 0.19) in CSR form, 2^scale vertices, edge factor 16.
+ */
+struct RmatGraph {
+  explicit RmatGraph(unsigned scale) : offsets((std::size_t{1} << scale) + 1) {
+    const std::size_t vertices{std::size_t{1} << scale};
+    std::mt19937_64 engine{1};
+    std::uniform_real_distribution<double> quadrant;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges(vertices * 16);
+    for (auto& [from, to] : edges) {
+      from = to = 0;
+      for (unsigned bit{}; bit < scale; ++bit) {
+        const double sample{quadrant(engine)};
+        from |= static_cast<std::uint32_t>(sample >= 0.76) << bit;
+        to |= static_cast<std::uint32_t>((sample >= 0.57 && sample < 0.76) || sample >= 0.95) << bit;
+      }
+      ++offsets[from + 1];
+      ++offsets[to + 1];
+    }
+
+    for (std::size_t vertex{}; vertex < vertices; ++vertex) {
+      offsets[vertex + 1] += offsets[vertex];
+    }
+    targets.resize(offsets.back());
+    std::vector<std::size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (const auto& [from, to] : edges) {
+      targets[cursor[from]++] = to;
+      targets[cursor[to]++] = from;
+    }
+  }
+
+  std::vector<std::size_t> offsets;
+  std::vector<std::uint32_t> targets;
+};
+
+/**
+ * @internal
+ * @brief Graphs are built once per scale.
+ */
+inline auto GetRmatGraph(unsigned scale) -> const RmatGraph& {
+  static std::map<unsigned, std::unique_ptr<RmatGraph>> graphs;
+  auto& graph{graphs[scale]};
+  if (!graph) {
+    graph = std::make_unique<RmatGraph>(scale);
+  }
+  return *graph;
+}
+
+/**
+ * @internal
+ * @brief Textbook top-down BFS with a FIFO queue and a `DynamicBitset` of visited vertices, baseline for
+ *        `BreadthFirstSearch`.
+ */
+struct QueueBfs {
+  static auto Run(const RmatGraph& graph, std::uint32_t source) -> std::size_t {
+    DynamicBitset<> visited(graph.offsets.size() - 1);
+    std::vector<std::uint32_t> queue{source};
+    visited.Set(source, true);
+    for (std::size_t head{}; head < queue.size(); ++head) {
+      const std::uint32_t vertex{queue[head]};
+      for (std::size_t edge{graph.offsets[vertex]}; edge < graph.offsets[vertex + 1]; ++edge) {
+        if (!visited.Test(graph.targets[edge])) {
+          visited.Set(graph.targets[edge], true);
+          queue.push_back(graph.targets[edge]);
+        }
+      }
+    }
+    return queue.size();
+  }
+};
+
+/**
+ * @internal
+ * @brief Full search from vertex 0 of an RMAT graph of scale `state.range(0)`, items are edges of the graph.
+ */
+template<typename Container, bool Parallel>
+auto BM_RmatBfs(::benchmark::State& state) -> void {
+  const RmatGraph& graph{GetRmatGraph(static_cast<unsigned>(state.range(0)))};
+
+  if constexpr (std::is_same_v<Container, QueueBfs>) {
+    for (auto _ : state) {
+      ::benchmark::DoNotOptimize(QueueBfs::Run(graph, 0));
+    }
+  } else {
+    Container bfs{graph.offsets, graph.targets};
+    for (auto _ : state) {
+      if constexpr (Parallel) {
+        ::benchmark::DoNotOptimize(bfs.Run(std::execution::par, 0));
+      } else {
+        ::benchmark::DoNotOptimize(bfs.Run(0));
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(graph.targets.size() / 2));
+}
+
+/**
+ * @internal
+ * @brief Scales 16 to 22 (64 Ki to 4 Mi vertices).
+ */
+inline auto RmatGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgName("scale")->DenseRange(16, 22, 2)->Unit(::benchmark::kMillisecond);
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_RmatBfsBenchmark(container, parallel, func)    \
+  BENCHMARK(bits::benchmark::BM_RmatBfs<container, parallel>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))      \
+    ->Apply(bits::benchmark::RmatGenerator)
+
+BITS_RmatBfsBenchmark(bits::BreadthFirstSearch<>, false, Run(seq));
+BITS_RmatBfsBenchmark(bits::BreadthFirstSearch<>, true, Run(par));
+BITS_RmatBfsBenchmark(bits::benchmark::QueueBfs, false, Run());
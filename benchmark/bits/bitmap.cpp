@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/bitmap_index.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <limits>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Synthetic table: `region` in 4 sorted runs, uniform `status` (8 keys) and `category` (64 keys).
+ */
+struct Table {
+  explicit Table(std::size_t rows) : region(rows), status(rows), category(rows) {
+    std::mt19937_64 engine{1};
+    for (std::size_t row{}; row < rows; ++row) {
+      region[row] = static_cast<std::uint8_t>(row * 4 / rows);
+      status[row] = static_cast<std::uint8_t>(engine() % 8);
+      category[row] = static_cast<std::uint8_t>(engine() % 64);
+    }
+    regions = BitmapIndex<std::uint8_t>{region};
+    statuses = BitmapIndex<std::uint8_t>{status};
+    categories = BitmapIndex<std::uint8_t>{category};
+  }
+
+  std::vector<std::uint8_t> region;
+  std::vector<std::uint8_t> status;
+  std::vector<std::uint8_t> category;
+  BitmapIndex<std::uint8_t> regions;
+  BitmapIndex<std::uint8_t> statuses;
+  BitmapIndex<std::uint8_t> categories;
+};
+
+/**
+ * @internal
+ * @brief Table of the current benchmark, the last one is kept for the next run.
+ * @details 10^8 rows take about 1.3 GB with indexes, so the previous table is freed before the next is built.
+ */
+inline auto GetTable(std::size_t rows) -> const Table& {
+  static std::size_t key{};
+  static std::unique_ptr<Table> table;
+  if (!table || rows != key) {
+    table.reset();
+    table = std::make_unique<Table>(rows);
+    key = rows;
+  }
+  return *table;
+}
+
+/**
+ * @internal
+ * @brief Row by row evaluation over the raw columns, baseline for `BitmapIndex`.
+ */
+struct ScanTable {
+  static auto Matches(const Table& table, std::size_t row) noexcept -> bool {
+    return table.region[row] == 1 && (table.status[row] == 2 || table.status[row] == 3) && table.category[row] != 5;
+  }
+
+  static auto Evaluate(const Table& table) -> DynamicBitset<> {
+    constexpr std::size_t kBits{std::numeric_limits<std::size_t>::digits};
+    DynamicBitset<> result(table.region.size());
+    for (std::size_t row{}; row < table.region.size(); ++row) {
+      result.Data()[row / kBits] |= static_cast<std::size_t>(Matches(table, row)) << row % kBits;
+    }
+    return result;
+  }
+
+  static auto Count(const Table& table) noexcept -> std::size_t {
+    std::size_t count{};
+    for (std::size_t row{}; row < table.region.size(); ++row) {
+      count += Matches(table, row);
+    }
+    return count;
+  }
+};
+
+/**
+ * @internal
+ * @brief `region = 1 AND status IN (2, 3) AND NOT category = 5` over `state.range(0)` rows.
+ * @details The index builds the predicate tree on every iteration, as a query engine would.
+ */
+template<typename Container, bool CountOnly>
+auto BM_TableQuery(::benchmark::State& state) -> void {
+  const Table& table{GetTable(static_cast<std::size_t>(state.range(0)))};
+
+  for (auto _ : state) {
+    if constexpr (std::is_same_v<Container, ScanTable>) {
+      if constexpr (CountOnly) {
+        ::benchmark::DoNotOptimize(ScanTable::Count(table));
+      } else {
+        ::benchmark::DoNotOptimize(ScanTable::Evaluate(table));
+      }
+    } else {
+      const auto query{table.regions.Equal(1) & table.statuses.In({2, 3}) & ~table.categories.Equal(5)};
+      if constexpr (CountOnly) {
+        ::benchmark::DoNotOptimize(query.Count());
+      } else {
+        ::benchmark::DoNotOptimize(query.Evaluate());
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @internal
+ * @brief 10^6 to 10^8 rows.
+ */
+inline auto TableGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgName("rows")->Arg(1'000'000)->Arg(10'000'000)->Arg(100'000'000)->Unit(::benchmark::kMillisecond);
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_TableBenchmark(container, count_only, func)           \
+  BENCHMARK(bits::benchmark::BM_TableQuery<container, count_only>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))           \
+    ->Apply(bits::benchmark::TableGenerator)
+
+BITS_TableBenchmark(bits::BitmapIndex<std::uint8_t>, false, Evaluate());
+BITS_TableBenchmark(bits::benchmark::ScanTable, false, Evaluate());
+BITS_TableBenchmark(bits::BitmapIndex<std::uint8_t>, true, Count());
+BITS_TableBenchmark(bits::benchmark::ScanTable, true, Count());
@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/bloom_filter.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Bloom filter with `k` independent probes through `DynamicBitset::Set()`/`Test()`, baseline for
+ *        `BlockedBloomFilter`. Probes use double hashing, so every probe is a separate cache miss.
+ */
+class NaiveBloomFilter {
+ public:
+  NaiveBloomFilter(std::size_t bits, std::size_t probes) : bits_(bits), probes_{probes} { }
+
+  auto Insert(std::uint64_t hash) -> void {
+    for (std::size_t probe{}; probe < probes_; ++probe) {
+      bits_.Set(Probe(hash, probe), true);
+    }
+  }
+
+  [[nodiscard]] auto Contains(std::uint64_t hash) const -> bool {
+    for (std::size_t probe{}; probe < probes_; ++probe) {
+      if (!bits_.Test(Probe(hash, probe))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  [[nodiscard]] auto Probe(std::uint64_t hash, std::size_t probe) const noexcept -> std::size_t {
+    return static_cast<std::size_t>(((hash >> 32) + probe * (hash | 1)) % bits_.Size());
+  }
+
+  DynamicBitset<> bits_;
+  std::size_t probes_;
+};
+
+/**
+ * @internal
+ * @brief Random 64-bit hashes.
+ */
+inline auto MakeHashes(std::size_t count, std::uint64_t seed) -> std::vector<std::uint64_t> {
+  std::mt19937_64 engine{seed};
+  std::vector<std::uint64_t> result(count);
+  for (std::uint64_t& hash : result) {
+    hash = engine();
+  }
+  return result;
+}
+
+/**
+ * @internal
+ * @brief Looks up absent keys in a filter of 2^21 keys with `state.range(0)` bits per key.
+ * @details Reports lookups per second and the measured false positive rate `fpr`.
+ */
+template<typename Container, bool Batch>
+auto BM_BloomLookup(::benchmark::State& state) -> void {
+  constexpr std::size_t kKeys{1 << 21};
+  constexpr std::size_t kLookups{1 << 16};
+  const auto bits_per_key{static_cast<std::size_t>(state.range(0))};
+
+  const auto filter{[&]() -> Container {
+    const auto keys{MakeHashes(kKeys, 1)};
+    if constexpr (std::is_same_v<Container, BlockedBloomFilter>) {
+      BlockedBloomFilter result{kKeys * bits_per_key};
+      result.InsertBatch(keys);
+      return result;
+    } else {
+      // Optimal number of probes for the given size is ln(2) * bits per key
+      Container result{kKeys * bits_per_key, static_cast<std::size_t>(std::lround(0.693 * bits_per_key))};
+      for (const std::uint64_t hash : keys) {
+        result.Insert(hash);
+      }
+      return result;
+    }
+  }()};
+  const auto lookups{MakeHashes(kLookups, 2)};
+  DynamicBitset<> found(kLookups);
+
+  std::size_t positives{};
+  for (auto _ : state) {
+    positives = 0;
+    if constexpr (Batch) {
+      positives = filter.ContainsBatch(lookups, found);
+    } else {
+      for (const std::uint64_t hash : lookups) {
+        positives += filter.Contains(hash);
+      }
+    }
+    ::benchmark::DoNotOptimize(positives);
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(kLookups));
+  state.counters["fpr"] = static_cast<double>(positives) / kLookups;
+}
+
+/**
+ * @internal
+ * @brief 8, 12 and 16 bits per key (2, 3 and 4 MiB filters).
+ */
+inline auto BloomGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgName("bits_per_key")->Arg(8)->Arg(12)->Arg(16)->Unit(::benchmark::kMicrosecond);
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_BloomBenchmark(container, batch, func)            \
+  BENCHMARK(bits::benchmark::BM_BloomLookup<container, batch>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))       \
+    ->Apply(bits::benchmark::BloomGenerator)
+
+BITS_BloomBenchmark(bits::BlockedBloomFilter, true, ContainsBatch());
+BITS_BloomBenchmark(bits::BlockedBloomFilter, false, Contains());
+BITS_BloomBenchmark(bits::benchmark::NaiveBloomFilter, false, Contains());
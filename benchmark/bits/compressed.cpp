@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/density.hpp>
+#include <dynamic_bitset/compressed_bitset.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+
+namespace bits::benchmark {
+
+inline auto MemoryUsage(const CompressedBitset& bits) -> std::size_t { return bits.MemoryUsage(); }
+
+/**
+ * @internal
+ * @brief Binary operation between two sets of the same density.
+ * @details `state.range(0)` is density in permille, `state.range(1)` selects clustered layout.
+ *          Operation: '&', '|', '^' or '-' for AND NOT.
+ */
+template<typename Container, char Operation>
+auto BM_DensityBinaryOperation(::benchmark::State& state) -> void {
+  const Container lhs{MakeDensityInput(state.range(0), state.range(1), 1)};
+  const Container rhs{MakeDensityInput(state.range(0), state.range(1), 2)};
+
+  for (auto _ : state) {
+    if constexpr (Operation == '&') {
+      ::benchmark::DoNotOptimize(lhs & rhs);
+    } else if constexpr (Operation == '|') {
+      ::benchmark::DoNotOptimize(lhs | rhs);
+    } else if constexpr (Operation == '^') {
+      ::benchmark::DoNotOptimize(lhs ^ rhs);
+    } else if constexpr (std::is_same_v<Container, CompressedBitset>) {
+      ::benchmark::DoNotOptimize(Container{lhs}.AndNot(rhs));
+    } else {
+      ::benchmark::DoNotOptimize(lhs & ~rhs);
+    }
+  }
+
+  state.counters["bytes"] = static_cast<double>(MemoryUsage(lhs));
+}
+
+template<typename Container>
+auto BM_DensityCount(::benchmark::State& state) -> void {
+  const Container unit{MakeDensityInput(state.range(0), state.range(1), 1)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(unit.Count());
+  }
+
+  state.counters["bytes"] = static_cast<double>(MemoryUsage(unit));
+}
+
+/**
+ * @internal
+ * @brief Visits every set bit with `FindFirst()`/`FindNext()`.
+ */
+template<typename Container>
+auto BM_DensityFindNext(::benchmark::State& state) -> void {
+  const Container unit{MakeDensityInput(state.range(0), state.range(1), 1)};
+
+  for (auto _ : state) {
+    std::size_t visited{};
+    for (std::size_t bit{unit.FindFirst()}; bit < unit.Size(); bit = unit.FindNext(bit)) {
+      ++visited;
+    }
+    ::benchmark::DoNotOptimize(visited);
+  }
+
+  state.counters["bytes"] = static_cast<double>(MemoryUsage(unit));
+}
+
+inline auto BM_Compress(::benchmark::State& state) -> void {
+  const auto flat{MakeDensityInput(state.range(0), state.range(1), 1)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(CompressedBitset{flat});
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(flat.Size() / 8));
+}
+
+inline auto BM_Decompress(::benchmark::State& state) -> void {
+  const CompressedBitset compressed{MakeDensityInput(state.range(0), state.range(1), 1)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(compressed.ToDynamicBitset());
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(compressed.Size() / 8));
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_DB bits::DynamicBitset<>
+#define BITS_CB bits::CompressedBitset
+
+#define BITS_DensityBinaryOperationBenchmark(container, operation, func)      \
+  BENCHMARK(bits::benchmark::BM_DensityBinaryOperation<container, operation>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))                      \
+    ->Apply(bits::benchmark::DensityGenerator)
+
+#define BITS_DensityCountBenchmark(container, func)      \
+  BENCHMARK(bits::benchmark::BM_DensityCount<container>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(bits::benchmark::DensityGenerator)
+
+#define BITS_DensityFindNextBenchmark(container, func)      \
+  BENCHMARK(bits::benchmark::BM_DensityFindNext<container>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))    \
+    ->Apply(bits::benchmark::DensityGenerator)
+
+BITS_DensityBinaryOperationBenchmark(BITS_DB, '&', operator&);
+BITS_DensityBinaryOperationBenchmark(BITS_CB, '&', operator&);
+BITS_DensityBinaryOperationBenchmark(BITS_DB, '|', operator|);
+BITS_DensityBinaryOperationBenchmark(BITS_CB, '|', operator|);
+BITS_DensityBinaryOperationBenchmark(BITS_DB, '^', operator^);
+BITS_DensityBinaryOperationBenchmark(BITS_CB, '^', operator^);
+BITS_DensityBinaryOperationBenchmark(BITS_DB, '-', operator&(~));
+BITS_DensityBinaryOperationBenchmark(BITS_CB, '-', AndNot());
+
+BITS_DensityCountBenchmark(BITS_DB, Count());
+BITS_DensityCountBenchmark(BITS_CB, Count());
+
+BITS_DensityFindNextBenchmark(BITS_DB, FindNext());
+BITS_DensityFindNextBenchmark(BITS_CB, FindNext());
+
+BENCHMARK(bits::benchmark::BM_Compress)
+  ->Name(BITS_BenchmarkNameGenerator(bits::CompressedBitset, CompressedBitset(const DynamicBitset&)))
+  ->Apply(bits::benchmark::DensityGenerator);
+BENCHMARK(bits::benchmark::BM_Decompress)
+  ->Name(BITS_BenchmarkNameGenerator(bits::CompressedBitset, ToDynamicBitset()))
+  ->Apply(bits::benchmark::DensityGenerator);
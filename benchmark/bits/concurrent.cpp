@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/concurrency.hpp>
+#include <dynamic_bitset/concurrent_dynamic_bitset.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <thread>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Ingestion: threads append bits to a set growing from empty.
+ */
+template<typename Container>
+auto BM_ConcurrentPushBack(::benchmark::State& state) -> void {
+  Container& bits{*g_shared_bits<Container>};
+  bool value{};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(bits.PushBack(value = !value));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @internal
+ * @brief Ingestion: threads set interleaved ascending ids, every write past `Size()` grows the set.
+ */
+template<typename Container>
+auto BM_ConcurrentGrowth(::benchmark::State& state) -> void {
+  Container& bits{*g_shared_bits<Container>};
+  const auto threads{static_cast<std::size_t>(state.threads())};
+  std::size_t index{static_cast<std::size_t>(state.thread_index())};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(bits.TestAndSet(index));
+    index += threads;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @internal
+ * @brief Starts from an empty set, 1 to 2 * cores threads.
+ */
+inline auto GrowthGenerator(::benchmark::internal::Benchmark* b) -> void {
+  const int threads{static_cast<int>(std::max(2U, std::thread::hardware_concurrency() * 2))};
+  b->ArgName("bits")->Arg(0)->ThreadRange(1, threads)->UseRealTime();
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_ConcurrentGrowthBenchmark(benchmark_function, container, func) \
+  BENCHMARK(bits::benchmark::benchmark_function<container>)                 \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))                    \
+    ->Setup(bits::benchmark::SetupSharedBits<container>)                    \
+    ->Teardown(bits::benchmark::TeardownSharedBits<container>)              \
+    ->Apply(bits::benchmark::GrowthGenerator)
+
+BITS_ConcurrentBenchmark(BM_ConcurrentTestAndSet, bits::ConcurrentDynamicBitset<>, TestAndSet());
+BITS_ConcurrentBenchmark(BM_ConcurrentSetReset, bits::ConcurrentDynamicBitset<>, TestAndSet()/Reset());
+
+BITS_ConcurrentGrowthBenchmark(BM_ConcurrentPushBack, bits::ConcurrentDynamicBitset<>, PushBack());
+BITS_ConcurrentGrowthBenchmark(BM_ConcurrentPushBack, bits::benchmark::LockedDynamicBitset, PushBack());
+BITS_ConcurrentGrowthBenchmark(BM_ConcurrentGrowth, bits::ConcurrentDynamicBitset<>, TestAndSet(ascending));
+BITS_ConcurrentGrowthBenchmark(BM_ConcurrentGrowth, bits::benchmark::LockedDynamicBitset, TestAndSet(ascending));
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/density.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/elias_fano.hpp>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Sorted `std::vector` of positions searched with `std::lower_bound`, baseline for `EliasFano`.
+ */
+struct SortedVector {
+  explicit SortedVector(const DynamicBitset<>& bits) : values(bits.Count()) {
+    bits.ToIndices(std::span{values});
+  }
+
+  [[nodiscard]] auto NextGEQ(std::size_t value) const -> std::size_t {
+    return static_cast<std::size_t>(std::lower_bound(values.begin(), values.end(), value) - values.begin());
+  }
+
+  std::vector<std::size_t> values;
+};
+
+inline auto MemoryUsage(const SortedVector& sorted) -> std::size_t {
+  return sizeof(sorted) + sorted.values.capacity() * sizeof(std::size_t);
+}
+
+inline auto MemoryUsage(const EliasFano<>& sequence) -> std::size_t { return sequence.MemoryUsage(); }
+
+/**
+ * @internal
+ * @brief `NextGEQ()` of random values, `DynamicBitset` answers with `FindNext()`.
+ * @details Items are queries, `bits_per_element` is the memory of the container per set bit.
+ */
+template<typename Container>
+auto BM_NextGEQ(::benchmark::State& state) -> void {
+  const auto input{MakeDensityInput(state.range(0), state.range(1), 1)};
+  const Container container{input};
+
+  std::mt19937_64 engine{2};
+  std::vector<std::size_t> queries(4'096);
+  for (std::size_t& query : queries) {
+    query = engine() % input.Size();
+  }
+
+  for (auto _ : state) {
+    std::size_t sum{};
+    for (const std::size_t query : queries) {
+      if constexpr (std::is_same_v<Container, DynamicBitset<>>) {
+        sum += query ? container.FindNext(query - 1) : container.FindFirst();
+      } else if constexpr (std::is_same_v<Container, SortedVector>) {
+        sum += container.NextGEQ(query);
+      } else {
+        sum += container.NextGEQ(query).first;
+      }
+    }
+    ::benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(queries.size()));
+  state.counters["bits_per_element"] =
+    static_cast<double>(MemoryUsage(container) * 8) / static_cast<double>(input.Count());
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_NextGEQBenchmark(container, func)           \
+  BENCHMARK(bits::benchmark::BM_NextGEQ<container>)      \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(bits::benchmark::DensityGenerator)
+
+BITS_NextGEQBenchmark(bits::EliasFano<>, NextGEQ());
+BITS_NextGEQBenchmark(bits::benchmark::SortedVector, NextGEQ());
+BITS_NextGEQBenchmark(bits::DynamicBitset<>, NextGEQ()/FindNext);
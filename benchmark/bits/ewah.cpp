@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/density.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/ewah_bitset.hpp>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Reports compressed size and compression ratio against flat storage.
+ */
+inline auto SetCompressionCounters(::benchmark::State& state, const EwahBitset& bits) -> void {
+  state.counters["bytes"] = static_cast<double>(bits.MemoryUsage());
+  state.counters["ratio"] =
+    static_cast<double>(MemoryUsage(DynamicBitset<>(bits.Size()))) / static_cast<double>(bits.MemoryUsage());
+}
+
+/**
+ * @internal
+ * @brief Binary operation on compressed streams, same layout as `BM_DensityBinaryOperation`.
+ */
+template<char Operation>
+auto BM_EwahBinaryOperation(::benchmark::State& state) -> void {
+  const auto lhs{EwahBitset::Compress(MakeDensityInput(state.range(0), state.range(1), 1))};
+  const auto rhs{EwahBitset::Compress(MakeDensityInput(state.range(0), state.range(1), 2))};
+
+  for (auto _ : state) {
+    if constexpr (Operation == '&') {
+      ::benchmark::DoNotOptimize(lhs & rhs);
+    } else if constexpr (Operation == '|') {
+      ::benchmark::DoNotOptimize(lhs | rhs);
+    } else if constexpr (Operation == '^') {
+      ::benchmark::DoNotOptimize(lhs ^ rhs);
+    } else {
+      ::benchmark::DoNotOptimize(EwahBitset{lhs}.AndNot(rhs));
+    }
+  }
+
+  SetCompressionCounters(state, lhs);
+}
+
+inline auto BM_EwahCount(::benchmark::State& state) -> void {
+  const auto unit{EwahBitset::Compress(MakeDensityInput(state.range(0), state.range(1), 1))};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(unit.Count());
+  }
+
+  SetCompressionCounters(state, unit);
+}
+
+inline auto BM_EwahCompress(::benchmark::State& state) -> void {
+  const auto flat{MakeDensityInput(state.range(0), state.range(1), 1)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(EwahBitset::Compress(flat));
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(flat.Size() / 8));
+  SetCompressionCounters(state, EwahBitset::Compress(flat));
+}
+
+inline auto BM_EwahDecompress(::benchmark::State& state) -> void {
+  const auto compressed{EwahBitset::Compress(MakeDensityInput(state.range(0), state.range(1), 1))};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(compressed.Decompress());
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(compressed.Size() / 8));
+  SetCompressionCounters(state, compressed);
+}
+
+/**
+ * @internal
+ * @brief Streams flat input into compressed storage 64 bits at a time.
+ */
+inline auto BM_EwahAppendBits(::benchmark::State& state) -> void {
+  const auto flat{MakeDensityInput(state.range(0), state.range(1), 1)};
+
+  for (auto _ : state) {
+    EwahBitset unit;
+    for (std::size_t block{}; block < flat.NumBlocks(); ++block) {
+      unit.AppendBits(flat.Data()[block], 64);
+    }
+    ::benchmark::DoNotOptimize(unit);
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(flat.Size() / 8));
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_EwahBinaryOperationBenchmark(operation, func)        \
+  BENCHMARK(bits::benchmark::BM_EwahBinaryOperation<operation>)   \
+    ->Name(BITS_BenchmarkNameGenerator(bits::EwahBitset, func)) \
+    ->Apply(bits::benchmark::DensityGenerator)
+
+#define BITS_EwahDensityBenchmark(function, func)               \
+  BENCHMARK(bits::benchmark::function)                          \
+    ->Name(BITS_BenchmarkNameGenerator(bits::EwahBitset, func)) \
+    ->Apply(bits::benchmark::DensityGenerator)
+
+BITS_EwahBinaryOperationBenchmark('&', operator&);
+BITS_EwahBinaryOperationBenchmark('|', operator|);
+BITS_EwahBinaryOperationBenchmark('^', operator^);
+BITS_EwahBinaryOperationBenchmark('-', AndNot());
+
+BITS_EwahDensityBenchmark(BM_EwahCount, Count());
+BITS_EwahDensityBenchmark(BM_EwahCompress, Compress());
+BITS_EwahDensityBenchmark(BM_EwahDecompress, Decompress());
+BITS_EwahDensityBenchmark(BM_EwahAppendBits, AppendBits());
+
+BITS_PushBackBenchmark(bits::EwahBitset, PushBack(), BITS_DefaultRangeGenerator);
@@ -0,0 +1,174 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <format>
+#include <iterator>
+#include <string>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Byte to characters lookup table used by the previous `ToString()` implementation.
+ */
+constexpr auto kStrBytesMapping{[] consteval {
+  std::array<std::array<char, 8>, 256> mapping{};
+  for (std::size_t byte{}; byte < mapping.size(); ++byte) {
+    for (std::size_t bit{}; bit < mapping[byte].size(); ++bit) {
+      mapping[byte][bit] = static_cast<char>((byte >> bit & 1) | '0');
+    }
+  }
+  return mapping;
+}()};
+
+/**
+ * @internal
+ * @brief Lookup table `ToString()` baseline to compare SIMD expansion with.
+ */
+template<typename Container>
+auto ToStringLookupTable(const Container& unit) -> std::string {
+  std::string str_bits(unit.Size(), '\0');
+  const auto* bytes{reinterpret_cast<const unsigned char*>(unit.Data())};
+  const std::size_t full_bytes{unit.Size() >> 3};
+  for (std::size_t byte{}; byte < full_bytes; ++byte) {
+    std::ranges::copy(kStrBytesMapping[bytes[byte]], str_bits.begin() + (byte << 3));
+  }
+  for (std::size_t bit{full_bytes << 3}; bit < unit.Size(); ++bit) {
+    str_bits[bit] = static_cast<char>(unit.Test(bit) | '0');
+  }
+  return str_bits;
+}
+
+template<typename Container>
+auto BM_ToStringLookupTable(::benchmark::State& state) -> void {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container unit(state.range(0));
+    state.ResumeTiming();
+    ::benchmark::DoNotOptimize(ToStringLookupTable(unit));
+  }
+}
+
+template<typename Container>
+auto BM_ToHexString(::benchmark::State& state) -> void {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container unit(state.range(0));
+    state.ResumeTiming();
+    ::benchmark::DoNotOptimize(unit.ToHexString());
+  }
+}
+
+template<typename Container>
+auto BM_FromHexString(::benchmark::State& state) -> void {
+  for (auto _ : state) {
+    state.PauseTiming();
+    const std::string hex{Container(state.range(0)).ToHexString()};
+    state.ResumeTiming();
+    ::benchmark::DoNotOptimize(Container::FromHexString(hex, state.range(0)));
+  }
+}
+
+/**
+ * @internal
+ * @brief Previous formatter behaviour: format the temporary `ToString()` result.
+ */
+template<typename Container>
+auto BM_FormatToString(::benchmark::State& state) -> void {
+  std::string buffer;
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container unit(state.range(0));
+    buffer.clear();
+    state.ResumeTiming();
+    std::format_to(std::back_inserter(buffer), "{}", unit.ToString());
+    ::benchmark::DoNotOptimize(buffer);
+  }
+}
+
+/**
+ * @internal
+ * @brief Formats directly into a reused buffer with the given presentation type
+ *        ('b', 'x', 'r' or 't' for binary output truncated to 64 bits).
+ */
+template<typename Container, char Type>
+auto BM_Format(::benchmark::State& state) -> void {
+  std::string buffer;
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container unit(state.range(0));
+    buffer.clear();
+    state.ResumeTiming();
+    if constexpr (Type == 'x') {
+      std::format_to(std::back_inserter(buffer), "{:x}", unit);
+    } else if constexpr (Type == 'r') {
+      std::format_to(std::back_inserter(buffer), "{:r}", unit);
+    } else if constexpr (Type == 't') {
+      std::format_to(std::back_inserter(buffer), "{:.64}", unit);
+    } else {
+      std::format_to(std::back_inserter(buffer), "{}", unit);
+    }
+    ::benchmark::DoNotOptimize(buffer);
+  }
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_DB(type) bits::DynamicBitset<type>
+
+#define BITS_ToStringLookupTableBenchmark(container, func)      \
+  BENCHMARK(bits::benchmark::BM_ToStringLookupTable<container>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))        \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+#define BITS_ToHexStringBenchmark(container, func)       \
+  BENCHMARK(bits::benchmark::BM_ToHexString<container>)  \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+#define BITS_FromHexStringBenchmark(container, func)      \
+  BENCHMARK(bits::benchmark::BM_FromHexString<container>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))  \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+BITS_ToStringLookupTableBenchmark(BITS_DB(unsigned char), ToString(LUT));
+BITS_ToStringLookupTableBenchmark(BITS_DB(unsigned short), ToString(LUT));
+BITS_ToStringLookupTableBenchmark(BITS_DB(unsigned), ToString(LUT));
+BITS_ToStringLookupTableBenchmark(BITS_DB(unsigned long), ToString(LUT));
+BITS_ToStringLookupTableBenchmark(BITS_DB(unsigned long long), ToString(LUT));
+
+BITS_ToHexStringBenchmark(BITS_DB(unsigned char), ToHexString());
+BITS_ToHexStringBenchmark(BITS_DB(unsigned short), ToHexString());
+BITS_ToHexStringBenchmark(BITS_DB(unsigned), ToHexString());
+BITS_ToHexStringBenchmark(BITS_DB(unsigned long), ToHexString());
+BITS_ToHexStringBenchmark(BITS_DB(unsigned long long), ToHexString());
+
+BITS_FromHexStringBenchmark(BITS_DB(unsigned char), FromHexString());
+BITS_FromHexStringBenchmark(BITS_DB(unsigned short), FromHexString());
+BITS_FromHexStringBenchmark(BITS_DB(unsigned), FromHexString());
+BITS_FromHexStringBenchmark(BITS_DB(unsigned long), FromHexString());
+BITS_FromHexStringBenchmark(BITS_DB(unsigned long long), FromHexString());
+
+#define BITS_FormatToStringBenchmark(container, func)      \
+  BENCHMARK(bits::benchmark::BM_FormatToString<container>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))   \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+#define BITS_FormatBenchmark(container, type, func)       \
+  BENCHMARK(bits::benchmark::BM_Format<container, type>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+BITS_FormatToStringBenchmark(BITS_DB(unsigned char), format("{}", ToString()));
+BITS_FormatToStringBenchmark(BITS_DB(unsigned long long), format("{}", ToString()));
+
+BITS_FormatBenchmark(BITS_DB(unsigned char), 'b', format("{}"));
+BITS_FormatBenchmark(BITS_DB(unsigned long long), 'b', format("{}"));
+BITS_FormatBenchmark(BITS_DB(unsigned char), 'x', format("{:x}"));
+BITS_FormatBenchmark(BITS_DB(unsigned long long), 'x', format("{:x}"));
+BITS_FormatBenchmark(BITS_DB(unsigned char), 'r', format("{:r}"));
+BITS_FormatBenchmark(BITS_DB(unsigned long long), 'r', format("{:r}"));
+BITS_FormatBenchmark(BITS_DB(unsigned char), 't', format("{:.64}"));
+BITS_FormatBenchmark(BITS_DB(unsigned long long), 't', format("{:.64}"));
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/hierarchical_bitset.hpp>
+#include <random>
+#include <type_traits>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Bitset of 2^`log_size` bits with `ppm` set bits per 2^20 bits at uniform random positions.
+ */
+inline auto MakeSparseInput(long long log_size, long long ppm) -> DynamicBitset<> {
+  std::mt19937_64 engine{1};
+  DynamicBitset<> bits(std::size_t{1} << log_size);
+  const std::size_t count{std::max<std::size_t>(1, (bits.Size() >> 20) * static_cast<std::size_t>(ppm))};
+  for (std::size_t bit{}; bit < count; ++bit) {
+    bits.Set(engine() % bits.Size(), true);
+  }
+  return bits;
+}
+
+/**
+ * @internal
+ * @brief Walks all set bits with `FindFirst()`/`FindNext()`, items are visited set bits.
+ */
+template<typename Container>
+auto BM_SparseFindNext(::benchmark::State& state) -> void {
+  const auto input{MakeSparseInput(state.range(0), state.range(1))};
+  const Container bits{[&input]() -> Container {
+    if constexpr (std::is_same_v<Container, DynamicBitset<>>) {
+      return input;
+    } else {
+      return Container{input};
+    }
+  }()};
+
+  std::size_t visited{};
+  for (auto _ : state) {
+    visited = 0;
+    for (std::size_t index{bits.FindFirst()}; index < bits.Size(); index = bits.FindNext(index)) {
+      ++visited;
+    }
+    ::benchmark::DoNotOptimize(visited);
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(visited));
+}
+
+/**
+ * @internal
+ * @brief 2^24 to 2^30 bits with 1, 100 and 10000 set bits per 2^20 bits.
+ */
+inline auto SparseGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgNames({"log_size", "ppm"})->ArgsProduct({{24, 27, 30}, {1, 100, 10'000}})->Unit(::benchmark::kMicrosecond);
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_SparseFindNextBenchmark(container, func)      \
+  BENCHMARK(bits::benchmark::BM_SparseFindNext<container>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))   \
+    ->Apply(bits::benchmark::SparseGenerator)
+
+BITS_SparseFindNextBenchmark(bits::HierarchicalBitset<>, FindNext());
+BITS_SparseFindNextBenchmark(bits::DynamicBitset<>, FindNext());
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/incremental.hpp>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Runs `generator` to the end and returns the longest time between two steps.
+ */
+template<typename Generator>
+auto LongestStep(Generator&& generator) -> std::chrono::nanoseconds {
+  std::chrono::nanoseconds longest{};
+  auto start{std::chrono::steady_clock::now()};
+  for (const auto& value : generator) {
+    ::benchmark::DoNotOptimize(value);
+    const auto now{std::chrono::steady_clock::now()};
+    longest = std::max(longest, std::chrono::nanoseconds{now - start});
+    start = now;
+  }
+  return longest;
+}
+
+/**
+ * @internal
+ * @brief Event loop pause: whole operation on `state.range(0)` random bits, `state.range(1)` blocks per step.
+ * @details Budget 0 runs the blocking member function. Reports the longest step of the median iteration,
+ *          the median filters out iterations hit by preemption or page faults.
+ */
+template<char Operation>
+auto BM_IncrementalPause(::benchmark::State& state) -> void {
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  const auto budget{static_cast<std::size_t>(state.range(1))};
+  DynamicBitset<> bits(size);
+  std::mt19937_64 engine{42};
+  std::generate_n(bits.Data(), bits.NumBlocks(), std::ref(engine));
+
+  std::vector<std::chrono::nanoseconds> pauses;
+  for (auto _ : state) {
+    std::chrono::nanoseconds longest{};
+    std::size_t sum{};
+    const auto visit{[&sum](std::size_t index) noexcept -> void { sum += index; }};
+    if (!budget) {
+      const auto start{std::chrono::steady_clock::now()};
+      if constexpr (Operation == 'c') {
+        ::benchmark::DoNotOptimize(bits.Count());
+      } else if constexpr (Operation == 'e') {
+        for (std::size_t index{bits.FindFirst()}; index != bits.Size(); index = bits.FindNext(index)) {
+          visit(index);
+        }
+      } else if constexpr (Operation == 's') {
+        ::benchmark::DoNotOptimize(bits.ToString());
+      } else {
+        ::benchmark::DoNotOptimize(bits <<= 1);
+      }
+      longest = std::max(longest, std::chrono::nanoseconds{std::chrono::steady_clock::now() - start});
+    } else if constexpr (Operation == 'c') {
+      longest = std::max(longest, LongestStep(CountIncrementally(bits, budget)));
+    } else if constexpr (Operation == 'e') {
+      longest = std::max(longest, LongestStep(ForEachSetBitChunked(bits, budget, visit)));
+    } else if constexpr (Operation == 's') {
+      longest = std::max(longest, LongestStep(ToStringIncrementally(bits, budget)));
+    } else {
+      longest = std::max(longest, LongestStep(ShiftLeftIncrementally(bits, 1, budget)));
+    }
+    ::benchmark::DoNotOptimize(sum);
+    ::benchmark::ClobberMemory();
+    pauses.push_back(longest);
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(bits.NumBlocks() * sizeof(std::size_t)));
+  const auto median{pauses.begin() + static_cast<std::ptrdiff_t>(pauses.size() / 2)};
+  std::nth_element(pauses.begin(), median, pauses.end());
+  state.counters["max_pause_us"] = static_cast<double>(median->count()) / 1e3;
+}
+
+/**
+ * @internal
+ * @brief 8 MiB set, blocking call and budgets of 512 B to 512 KiB of storage per step.
+ */
+inline auto PauseGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgNames({"bits", "budget"})
+    ->ArgsProduct({{1LL << 26}, {0, 1 << 6, 1 << 11, 1 << 16}})
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_IncrementalPauseBenchmark(operation, func)              \
+  BENCHMARK(bits::benchmark::BM_IncrementalPause<operation>)         \
+    ->Name(BITS_BenchmarkNameGenerator(bits::DynamicBitset<>, func)) \
+    ->Apply(bits::benchmark::PauseGenerator)
+
+BITS_IncrementalPauseBenchmark('c', CountIncrementally());
+BITS_IncrementalPauseBenchmark('e', ForEachSetBitChunked());
+BITS_IncrementalPauseBenchmark('s', ToStringIncrementally());
+BITS_IncrementalPauseBenchmark('<', ShiftLeftIncrementally());
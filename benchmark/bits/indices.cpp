@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/density.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <span>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Decodes set bit positions of a `state.range(0)` permille dense set to `Index`.
+ * @details `Decoder` 'f' is the `FindFirst()`/`FindNext()` walk baseline, otherwise `ToIndices()`.
+ *          Items are decoded indices, bytes are storage read plus indices written.
+ */
+template<typename Index, char Decoder>
+auto BM_ToIndices(::benchmark::State& state) -> void {
+  const auto bits{MakeDensityInput(state.range(0), state.range(1), 1)};
+  const std::size_t count{bits.Count()};
+  std::vector<Index> indices(count);
+
+  for (auto _ : state) {
+    if constexpr (Decoder == 'f') {
+      Index* out{indices.data()};
+      for (std::size_t index{bits.FindFirst()}; index != bits.Size(); index = bits.FindNext(index)) {
+        *out++ = static_cast<Index>(index);
+      }
+    } else {
+      ::benchmark::DoNotOptimize(bits.ToIndices(std::span{indices}));
+    }
+    ::benchmark::DoNotOptimize(indices.data());
+    ::benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(count));
+  state.SetBytesProcessed(
+    state.iterations() * static_cast<long long>(bits.NumBlocks() * sizeof(std::size_t) + count * sizeof(Index))
+  );
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_ToIndicesBenchmark(index, decoder, func)                \
+  BENCHMARK(bits::benchmark::BM_ToIndices<index, decoder>)           \
+    ->Name(BITS_BenchmarkNameGenerator(bits::DynamicBitset<>, func)) \
+    ->Apply(bits::benchmark::DensityGenerator)
+
+BITS_ToIndicesBenchmark(std::uint32_t, 'm', ToIndices(span<uint32_t>));
+BITS_ToIndicesBenchmark(std::uint64_t, 'm', ToIndices(span<uint64_t>));
+BITS_ToIndicesBenchmark(std::uint32_t, 'f', FindNext()/uint32_t);
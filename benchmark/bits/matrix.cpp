@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/bit_matrix.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <random>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief One `DynamicBitset` per row, baseline for `BitMatrix`.
+ */
+class RowsMatrix {
+ public:
+  RowsMatrix(std::size_t rows, std::size_t cols) : rows_(rows, DynamicBitset<>(cols)) { }
+
+  auto Set(std::size_t row, std::size_t column, bool value) -> void { rows_[row].Set(column, value); }
+
+  [[nodiscard]] auto Transpose() const -> RowsMatrix {
+    RowsMatrix result{rows_.empty() ? 0 : rows_.front().Size(), rows_.size()};
+    for (std::size_t row{}; row < rows_.size(); ++row) {
+      for (std::size_t column{}; column < rows_[row].Size(); ++column) {
+        if (rows_[row].Test(column)) {
+          result.rows_[column].Set(row, true);
+        }
+      }
+    }
+    return result;
+  }
+
+  [[nodiscard]] auto Multiply(const RowsMatrix& rhs) const -> RowsMatrix {
+    RowsMatrix result{rows_.size(), rhs.rows_.empty() ? 0 : rhs.rows_.front().Size()};
+    for (std::size_t row{}; row < rows_.size(); ++row) {
+      const DynamicBitset<>& lhs_row{rows_[row]};
+      for (std::size_t k{lhs_row.FindFirst()}; k != lhs_row.Size(); k = lhs_row.FindNext(k)) {
+        result.rows_[row] |= rhs.rows_[k];
+      }
+    }
+    return result;
+  }
+
+ private:
+  std::vector<DynamicBitset<>> rows_;
+};
+
+/**
+ * @internal
+ * @brief Builds `size x size` matrix with `permille` density of set bits.
+ */
+template<typename Container>
+auto MakeMatrix(std::size_t size, unsigned permille, std::uint32_t seed) -> Container {
+  std::mt19937_64 engine{seed};
+  Container matrix{size, size};
+  for (std::size_t row{}; row < size; ++row) {
+    for (std::size_t column{}; column < size; ++column) {
+      matrix.Set(row, column, engine() % 1000 < permille);
+    }
+  }
+  return matrix;
+}
+
+/**
+ * @internal
+ * @brief Transposes a half full `state.range(0)` square matrix.
+ */
+template<typename Container>
+auto BM_MatrixTranspose(::benchmark::State& state) -> void {
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  const auto matrix{MakeMatrix<Container>(size, 500, 1)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(matrix.Transpose());
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(size * size / 8));
+}
+
+/**
+ * @internal
+ * @brief Boolean product of two `state.range(0)` square matrices with 1% of bits set.
+ */
+template<typename Container>
+auto BM_MatrixMultiply(::benchmark::State& state) -> void {
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  const auto lhs{MakeMatrix<Container>(size, 10, 1)};
+  const auto rhs{MakeMatrix<Container>(size, 10, 2)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(lhs.Multiply(rhs));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(size * size));
+}
+
+/**
+ * @internal
+ * @brief Square matrices from 256 (8 KiB) to 4096 (2 MiB) rows.
+ */
+inline auto MatrixGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgName("size")->RangeMultiplier(4)->Range(1 << 8, 1 << 12)->Unit(::benchmark::kMicrosecond);
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_MatrixBenchmark(benchmark_function, container, func) \
+  BENCHMARK(bits::benchmark::benchmark_function<container>)       \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))          \
+    ->Apply(bits::benchmark::MatrixGenerator)
+
+BITS_MatrixBenchmark(BM_MatrixTranspose, bits::BitMatrix<>, Transpose());
+BITS_MatrixBenchmark(BM_MatrixTranspose, bits::benchmark::RowsMatrix, Transpose());
+BITS_MatrixBenchmark(BM_MatrixMultiply, bits::BitMatrix<>, Multiply());
+BITS_MatrixBenchmark(BM_MatrixMultiply, bits::benchmark::RowsMatrix, Multiply());
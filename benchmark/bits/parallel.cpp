@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/thread_pool.hpp>
+#include <thread>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Whole-bitset operation on `state.range(0)` bits with a pool of `state.range(1)` threads.
+ * @details Every thread count runs on the same data, so the rows show the scaling of a single operation.
+ */
+template<char Operation>
+auto BM_ParallelOperation(::benchmark::State& state) -> void {
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  DynamicBitset<> lhs(size);
+  DynamicBitset<> rhs(size);
+  rhs.Flip();
+
+  ThreadPoolExecutor pool{static_cast<std::size_t>(state.range(1))};
+  SetParallelExecutor(&pool, 0);
+
+  for (auto _ : state) {
+    if constexpr (Operation == 'c') {
+      ::benchmark::DoNotOptimize(lhs.Count());
+    } else if constexpr (Operation == 's') {
+      ::benchmark::DoNotOptimize(lhs.Set());
+    } else if constexpr (Operation == 'f') {
+      ::benchmark::DoNotOptimize(lhs.Flip());
+    } else if constexpr (Operation == '&') {
+      ::benchmark::DoNotOptimize(lhs &= rhs);
+    } else if constexpr (Operation == '|') {
+      ::benchmark::DoNotOptimize(lhs |= rhs);
+    } else if constexpr (Operation == '^') {
+      ::benchmark::DoNotOptimize(lhs ^= rhs);
+    } else {
+      ::benchmark::DoNotOptimize(lhs == rhs);
+    }
+    ::benchmark::ClobberMemory();
+  }
+
+  SetParallelExecutor(nullptr);
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(lhs.NumBlocks() * sizeof(std::size_t)));
+}
+
+/**
+ * @internal
+ * @brief 32 MiB and 512 MiB sets, 1 to max(4, cores) threads.
+ */
+inline auto ScalingGenerator(::benchmark::internal::Benchmark* b) -> void {
+  const long long threads{std::max(4U, std::thread::hardware_concurrency())};
+  b->ArgNames({"bits", "threads"})
+    ->ArgsProduct({{1LL << 28, 1LL << 32}, ::benchmark::CreateRange(1, threads, 2)})
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_ParallelBenchmark(operation, func)                       \
+  BENCHMARK(bits::benchmark::BM_ParallelOperation<operation>)         \
+    ->Name(BITS_BenchmarkNameGenerator(bits::DynamicBitset<>, func)) \
+    ->Apply(bits::benchmark::ScalingGenerator)
+
+BITS_ParallelBenchmark('c', ParallelCount());
+BITS_ParallelBenchmark('s', ParallelSet());
+BITS_ParallelBenchmark('f', ParallelFlip());
+BITS_ParallelBenchmark('&', ParallelOperator&=);
+BITS_ParallelBenchmark('|', ParallelOperator|=);
+BITS_ParallelBenchmark('^', ParallelOperator^=);
+BITS_ParallelBenchmark('=', ParallelOperator==);
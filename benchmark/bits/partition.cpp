@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <dynamic_bitset/atomic_dynamic_bitset.hpp>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/concurrency.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/partition.hpp>
+#include <thread>
+#include <type_traits>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Parallel fill: every thread sets every second bit of its own range of `state.range(0)` shared bits.
+ * @details `DynamicBitset` is written with plain stores through `Partition()`, the baseline splits bits
+ *          evenly and relies on atomic read-modify-write at the shared boundary words.
+ */
+template<typename Container>
+auto BM_PartitionedFill(::benchmark::State& state) -> void {
+  Container& bits{*g_shared_bits<Container>};
+  const auto thread{static_cast<std::size_t>(state.thread_index())};
+  const auto threads{static_cast<std::size_t>(state.threads())};
+
+  std::size_t filled{};
+  if constexpr (std::is_same_v<Container, DynamicBitset<>>) {
+    auto partition{Partition(bits, threads)[thread]};
+    for (auto _ : state) {
+      for (std::size_t index{partition.Begin()}; index < partition.End(); index += 2) {
+        partition.Set(index, true);
+      }
+      ::benchmark::ClobberMemory();
+    }
+    filled = partition.Size();
+  } else {
+    const std::size_t begin{thread * bits.Size() / threads};
+    const std::size_t end{(thread + 1) * bits.Size() / threads};
+    for (auto _ : state) {
+      for (std::size_t index{begin}; index < end; index += 2) {
+        bits.Set(index, std::memory_order_relaxed);
+      }
+      ::benchmark::ClobberMemory();
+    }
+    filled = end - begin;
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(filled / 2));
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(filled / 8));
+}
+
+/**
+ * @internal
+ * @brief 64 KiB (per-core caches) and 2 MiB sets, 1 to 2 * cores threads.
+ */
+inline auto FillGenerator(::benchmark::internal::Benchmark* b) -> void {
+  const int threads{static_cast<int>(std::max(2U, std::thread::hardware_concurrency() * 2))};
+  b->ArgName("bits")->Arg(1 << 19)->Arg(1 << 24)->ThreadRange(1, threads)->UseRealTime();
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_PartitionedFillBenchmark(container, func)         \
+  BENCHMARK(bits::benchmark::BM_PartitionedFill<container>)    \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))       \
+    ->Setup(bits::benchmark::SetupSharedBits<container>)       \
+    ->Teardown(bits::benchmark::TeardownSharedBits<container>) \
+    ->Apply(bits::benchmark::FillGenerator)
+
+BITS_PartitionedFillBenchmark(bits::DynamicBitset<>, Partition()/Set());
+BITS_PartitionedFillBenchmark(bits::AtomicDynamicBitset<>, Set(relaxed));
@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/shift_and_matcher.hpp>
+#include <functional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Scans the text once per pattern with `std::string_view::find`, baseline for `ShiftAndMatcher`.
+ */
+struct StringViewFind {
+  explicit StringViewFind(std::span<const std::string_view> patterns) : patterns{patterns.begin(), patterns.end()} {}
+
+  [[nodiscard]] auto Count(std::string_view text) const -> std::size_t {
+    std::size_t count{};
+    for (const std::string_view pattern : patterns) {
+      for (std::size_t position{text.find(pattern)}; position != std::string_view::npos;
+           position = text.find(pattern, position + 1)) {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  std::vector<std::string_view> patterns;
+};
+
+/**
+ * @internal
+ * @brief Scans the text once per pattern with a prebuilt `std::boyer_moore_searcher`.
+ */
+struct BoyerMooreSearch {
+  explicit BoyerMooreSearch(std::span<const std::string_view> patterns) {
+    for (const std::string_view pattern : patterns) {
+      searchers.emplace_back(pattern.begin(), pattern.end());
+    }
+  }
+
+  [[nodiscard]] auto Count(std::string_view text) const -> std::size_t {
+    std::size_t count{};
+    for (const auto& searcher : searchers) {
+      for (auto [first, last]{searcher(text.begin(), text.end())}; first != text.end();
+           std::tie(first, last) = searcher(first + 1, text.end())) {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  std::vector<std::boyer_moore_searcher<std::string_view::const_iterator>> searchers;
+};
+
+/**
+ * @internal
+ * @brief 4 MiB of log lines assembled from a small vocabulary, built once.
+ */
+inline auto GetLogText() -> const std::string& {
+  static const std::string text{[]() -> std::string {
+    constexpr std::array<std::string_view, 12> kWords{
+      "INFO ", "WARN ", "request ", "id=", "user ", "timeout ", "ms ", "connection ", "closed ", "GET /api/v1/", "200 ",
+      "\n"
+    };
+    std::mt19937_64 engine{1};
+    std::string log;
+    while (log.size() < (std::size_t{1} << 22)) {
+      log += kWords[engine() % kWords.size()];
+      log += std::to_string(engine() % 10'000);
+    }
+    return log;
+  }()};
+  return text;
+}
+
+/**
+ * @internal
+ * @brief Counts occurrences of `state.range(1)` patterns of `state.range(0)` characters taken from the text.
+ * @details Bytes are characters of the text scanned per iteration, reported as throughput.
+ */
+template<typename Container>
+auto BM_PatternScan(::benchmark::State& state) -> void {
+  const std::string_view text{GetLogText()};
+  std::mt19937_64 engine{static_cast<std::uint64_t>(state.range(0))};
+  std::vector<std::string_view> patterns;
+  for (long long pattern{}; pattern < state.range(1); ++pattern) {
+    const auto length{static_cast<std::size_t>(state.range(0))};
+    patterns.push_back(text.substr(engine() % (text.size() - length), length));
+  }
+  const Container matcher{patterns};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(matcher.Count(text));
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(text.size()));
+}
+
+/**
+ * @internal
+ * @brief Patterns of 16 to 1024 characters, one or eight of them.
+ */
+inline auto PatternScanGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgNames({"length", "patterns"})->ArgsProduct({{16, 128, 1'024}, {1, 8}})->Unit(::benchmark::kMillisecond);
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_PatternScanBenchmark(container, func)       \
+  BENCHMARK(bits::benchmark::BM_PatternScan<container>)  \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(bits::benchmark::PatternScanGenerator)
+
+BITS_PatternScanBenchmark(bits::ShiftAndMatcher<>, Count());
+BITS_PatternScanBenchmark(bits::benchmark::StringViewFind, Count());
+BITS_PatternScanBenchmark(bits::benchmark::BoyerMooreSearch, Count());
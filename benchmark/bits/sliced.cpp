@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/bit_sliced_index.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Plain column scanned row by row, baseline for `BitSlicedIndex`.
+ * @details Results are packed into words directly, without per-bit `DynamicBitset::Set()` calls.
+ */
+class ScanColumn {
+ public:
+  explicit ScanColumn(std::span<const std::uint32_t> values) : values_(values.begin(), values.end()) { }
+
+  [[nodiscard]] auto Less(std::uint32_t value) const -> DynamicBitset<> {
+    return Scan([value](std::uint32_t row) { return row < value; });
+  }
+
+  [[nodiscard]] auto Between(std::uint32_t low, std::uint32_t high) const -> DynamicBitset<> {
+    return Scan([low, high](std::uint32_t row) { return row >= low && row <= high; });
+  }
+
+  [[nodiscard]] auto Sum(const DynamicBitset<>& mask) const -> std::uint64_t {
+    std::uint64_t sum{};
+    for (std::size_t row{}; row < values_.size(); ++row) {
+      sum += mask.Test(row) ? values_[row] : 0;
+    }
+    return sum;
+  }
+
+ private:
+  template<typename Predicate>
+  [[nodiscard]] auto Scan(Predicate predicate) const -> DynamicBitset<> {
+    constexpr std::size_t kBits{std::numeric_limits<std::size_t>::digits};
+    DynamicBitset<> result(values_.size());
+    for (std::size_t row{}; row < values_.size(); ++row) {
+      result.Data()[row / kBits] |= static_cast<std::size_t>(predicate(values_[row])) << row % kBits;
+    }
+    return result;
+  }
+
+  std::vector<std::uint32_t> values_;
+};
+
+/**
+ * @internal
+ * @brief 2^22 uniform values of `state.range(0)` bits.
+ */
+inline auto MakeColumn(const ::benchmark::State& state) -> std::vector<std::uint32_t> {
+  std::mt19937_64 engine{1};
+  const auto width{static_cast<unsigned>(state.range(0))};
+  std::vector<std::uint32_t> result(1 << 22);
+  for (std::uint32_t& value : result) {
+    value = static_cast<std::uint32_t>(engine() & ((std::uint64_t{1} << width) - 1));
+  }
+  return result;
+}
+
+/**
+ * @internal
+ * @brief `col < x` with `x` in the middle of the value range.
+ */
+template<typename Container>
+auto BM_ColumnLess(::benchmark::State& state) -> void {
+  const auto values{MakeColumn(state)};
+  const Container column{values};
+  const auto pivot{static_cast<std::uint32_t>((std::uint64_t{1} << state.range(0)) / 2)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(column.Less(pivot));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(values.size()));
+}
+
+/**
+ * @internal
+ * @brief `col BETWEEN a AND b` selecting the middle half of the value range.
+ */
+template<typename Container>
+auto BM_ColumnBetween(::benchmark::State& state) -> void {
+  const auto values{MakeColumn(state)};
+  const Container column{values};
+  const auto range{static_cast<std::uint32_t>((std::uint64_t{1} << state.range(0)) / 4)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(column.Between(range, 3 * range));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(values.size()));
+}
+
+/**
+ * @internal
+ * @brief `SUM(col WHERE mask)` with a random half of rows selected.
+ */
+template<typename Container>
+auto BM_ColumnMaskedSum(::benchmark::State& state) -> void {
+  const auto values{MakeColumn(state)};
+  const Container column{values};
+  std::mt19937_64 engine{2};
+  DynamicBitset<> mask(values.size());
+  for (std::size_t block{}; block < mask.NumBlocks(); ++block) {
+    mask.Data()[block] = engine();
+  }
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(column.Sum(mask));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(values.size()));
+}
+
+/**
+ * @internal
+ * @brief 8, 16 and 32 bit wide values.
+ */
+inline auto ColumnGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgName("width")->Arg(8)->Arg(16)->Arg(32)->Unit(::benchmark::kMicrosecond);
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_ColumnBenchmark(benchmark_function, container, func) \
+  BENCHMARK(bits::benchmark::benchmark_function<container>)       \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))          \
+    ->Apply(bits::benchmark::ColumnGenerator)
+
+BITS_ColumnBenchmark(BM_ColumnLess, bits::BitSlicedIndex<std::uint32_t>, Less());
+BITS_ColumnBenchmark(BM_ColumnLess, bits::benchmark::ScanColumn, Less());
+BITS_ColumnBenchmark(BM_ColumnBetween, bits::BitSlicedIndex<std::uint32_t>, Between());
+BITS_ColumnBenchmark(BM_ColumnBetween, bits::benchmark::ScanColumn, Between());
+BITS_ColumnBenchmark(BM_ColumnMaskedSum, bits::BitSlicedIndex<std::uint32_t>, Sum(mask));
+BITS_ColumnBenchmark(BM_ColumnMaskedSum, bits::benchmark::ScanColumn, Sum(mask));
@@ -0,0 +1,180 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/benchmark/concurrency.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/snapshot_bitset.hpp>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Reader-writer lock protected `DynamicBitset`, baseline for read-mostly sets.
+ */
+class SharedMutexDynamicBitset {
+ public:
+  explicit SharedMutexDynamicBitset(std::size_t bits) : bits_(bits) { }
+
+  [[nodiscard]] auto Size() const noexcept -> std::size_t { return bits_.Size(); }
+
+  [[nodiscard]] auto Test(std::size_t index) const -> bool {
+    const std::shared_lock lock{mutex_};
+    return bits_.Test(index);
+  }
+
+  template<typename Function>
+  auto Update(Function function) -> void {
+    const std::unique_lock lock{mutex_};
+    function(bits_);
+  }
+
+ private:
+  DynamicBitset<> bits_;
+  mutable std::shared_mutex mutex_;
+};
+
+/**
+ * @internal
+ * @brief Number of random bits flipped by the writer in one round.
+ */
+inline constexpr std::size_t kWriteRoundBits{256};
+
+/**
+ * @internal
+ * @brief Pause between writer rounds.
+ */
+inline constexpr std::chrono::milliseconds kWritePeriod{1};
+
+inline auto WriteRound(SnapshotBitset<>& bits, std::uint64_t& random) -> void {
+  for (std::size_t bit{}; bit < kWriteRoundBits; ++bit) {
+    bits.Flip(NextIndex(random, bits.Size()));
+  }
+  bits.Publish();
+}
+
+inline auto WriteRound(SharedMutexDynamicBitset& bits, std::uint64_t& random) -> void {
+  bits.Update([&random](DynamicBitset<>& storage) -> void {
+    for (std::size_t bit{}; bit < kWriteRoundBits; ++bit) {
+      storage.Flip(NextIndex(random, storage.Size()));
+    }
+  });
+}
+
+inline auto ReadBit(const SnapshotBitset<>& bits, std::size_t index) -> bool { return bits.Snapshot().Test(index); }
+
+inline auto ReadBit(const SharedMutexDynamicBitset& bits, std::size_t index) -> bool { return bits.Test(index); }
+
+/**
+ * @internal
+ * @brief Background writer running while reader threads are measured.
+ */
+inline std::atomic<bool> g_writer_stop;
+inline std::unique_ptr<std::thread> g_writer;
+
+template<typename Container>
+auto SetupWriter(const ::benchmark::State& state) -> void {
+  SetupSharedBits<Container>(state);
+  g_writer_stop.store(false);
+  g_writer = std::make_unique<std::thread>([]() -> void {
+    Container& bits{*g_shared_bits<Container>};
+    std::uint64_t random{0x2545F4914F6CDD1DULL};
+    while (!g_writer_stop.load(std::memory_order_relaxed)) {
+      WriteRound(bits, random);
+      std::this_thread::sleep_for(kWritePeriod);
+    }
+  });
+}
+
+template<typename Container>
+auto TeardownWriter(const ::benchmark::State& state) -> void {
+  g_writer_stop.store(true);
+  g_writer->join();
+  g_writer.reset();
+  TeardownSharedBits<Container>(state);
+}
+
+/**
+ * @internal
+ * @brief Latency histogram with 1 ns buckets, the last bucket collects everything slower.
+ */
+class LatencyHistogram {
+ public:
+  auto Add(std::chrono::nanoseconds latency) noexcept -> void {
+    ++buckets_[std::min(static_cast<std::size_t>(latency.count()), kBuckets - 1)];
+  }
+
+  [[nodiscard]] auto Percentile(double fraction) const noexcept -> double {
+    std::uint64_t total{};
+    for (const std::uint64_t count : buckets_) {
+      total += count;
+    }
+    const auto rank{static_cast<std::uint64_t>(static_cast<double>(total) * fraction)};
+    std::uint64_t seen{};
+    for (std::size_t bucket{}; bucket < kBuckets; ++bucket) {
+      seen += buckets_[bucket];
+      if (seen > rank) {
+        return static_cast<double>(bucket);
+      }
+    }
+    return static_cast<double>(kBuckets - 1);
+  }
+
+ private:
+  static constexpr std::size_t kBuckets{1 << 14};
+
+  std::array<std::uint64_t, kBuckets> buckets_{};
+};
+
+/**
+ * @internal
+ * @brief Filter lookups: readers test random bits while one writer updates the set every millisecond.
+ * @details Reports per-query latency percentiles, averaged over reader threads.
+ */
+template<typename Container>
+auto BM_SnapshotRead(::benchmark::State& state) -> void {
+  const Container& bits{*g_shared_bits<Container>};
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  std::uint64_t random{0x9E3779B97F4A7C15ULL * (static_cast<std::uint64_t>(state.thread_index()) + 1)};
+  const auto histogram{std::make_unique<LatencyHistogram>()};
+
+  for (auto _ : state) {
+    const std::size_t index{NextIndex(random, size)};
+    const auto start{std::chrono::steady_clock::now()};
+    ::benchmark::DoNotOptimize(ReadBit(bits, index));
+    histogram->Add(std::chrono::steady_clock::now() - start);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["p50_ns"] = ::benchmark::Counter(histogram->Percentile(0.5), ::benchmark::Counter::kAvgThreads);
+  state.counters["p99_ns"] = ::benchmark::Counter(histogram->Percentile(0.99), ::benchmark::Counter::kAvgThreads);
+}
+
+/**
+ * @internal
+ * @brief 1M and 16M bits, 1 to 4 * cores reader threads.
+ */
+inline auto ReadersGenerator(::benchmark::internal::Benchmark* b) -> void {
+  const int threads{static_cast<int>(std::max(2U, std::thread::hardware_concurrency() * 4))};
+  b->ArgName("bits")->Arg(1 << 20)->Arg(1 << 24)->ThreadRange(1, threads)->UseRealTime();
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_SnapshotReadBenchmark(container, func)            \
+  BENCHMARK(bits::benchmark::BM_SnapshotRead<container>)       \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))       \
+    ->Setup(bits::benchmark::SetupWriter<container>)           \
+    ->Teardown(bits::benchmark::TeardownWriter<container>)     \
+    ->Apply(bits::benchmark::ReadersGenerator)
+
+BITS_SnapshotReadBenchmark(bits::SnapshotBitset<>, Snapshot().Test());
+BITS_SnapshotReadBenchmark(bits::benchmark::SharedMutexDynamicBitset, Test(shared_lock));
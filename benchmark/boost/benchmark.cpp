@@ -86,6 +86,12 @@ BITS_TestLoopBenchmark(BOOST_CONST_DB(unsigned long), test());
 BITS_TestLoopBenchmark(BOOST_DB(unsigned long long), test());
 BITS_TestLoopBenchmark(BOOST_CONST_DB(unsigned long long), test());
 
+BITS_CountBenchmark(BOOST_DB(unsigned char), count());
+BITS_CountBenchmark(BOOST_DB(unsigned short), count());
+BITS_CountBenchmark(BOOST_DB(unsigned), count());
+BITS_CountBenchmark(BOOST_DB(unsigned long), count());
+BITS_CountBenchmark(BOOST_DB(unsigned long long), count());
+
 BITS_EmptyBenchmark(BOOST_DB(unsigned char), empty());
 BITS_EmptyBenchmark(BOOST_DB(unsigned short), empty());
 BITS_EmptyBenchmark(BOOST_DB(unsigned), empty());
@@ -170,4 +176,52 @@ BITS_XorOperatorBenchmark(BOOST_DB(unsigned), operator^=);
 BITS_XorOperatorBenchmark(BOOST_DB(unsigned long), operator^=);
 BITS_XorOperatorBenchmark(BOOST_DB(unsigned long long), operator^=);
 
+BITS_LeftShiftBenchmark(BOOST_DB(unsigned char), operator<<=);
+BITS_LeftShiftBenchmark(BOOST_DB(unsigned short), operator<<=);
+BITS_LeftShiftBenchmark(BOOST_DB(unsigned), operator<<=);
+BITS_LeftShiftBenchmark(BOOST_DB(unsigned long), operator<<=);
+BITS_LeftShiftBenchmark(BOOST_DB(unsigned long long), operator<<=);
+
+BITS_RightShiftBenchmark(BOOST_DB(unsigned char), operator>>=);
+BITS_RightShiftBenchmark(BOOST_DB(unsigned short), operator>>=);
+BITS_RightShiftBenchmark(BOOST_DB(unsigned), operator>>=);
+BITS_RightShiftBenchmark(BOOST_DB(unsigned long), operator>>=);
+BITS_RightShiftBenchmark(BOOST_DB(unsigned long long), operator>>=);
+
+BITS_EqualOperatorBenchmark(BOOST_DB(unsigned char), operator==);
+BITS_EqualOperatorBenchmark(BOOST_DB(unsigned short), operator==);
+BITS_EqualOperatorBenchmark(BOOST_DB(unsigned), operator==);
+BITS_EqualOperatorBenchmark(BOOST_DB(unsigned long), operator==);
+BITS_EqualOperatorBenchmark(BOOST_DB(unsigned long long), operator==);
+
+BITS_ResizeBenchmark(BOOST_DB(unsigned char), resize());
+BITS_ResizeBenchmark(BOOST_DB(unsigned short), resize());
+BITS_ResizeBenchmark(BOOST_DB(unsigned), resize());
+BITS_ResizeBenchmark(BOOST_DB(unsigned long), resize());
+BITS_ResizeBenchmark(BOOST_DB(unsigned long long), resize());
+
+BITS_ReserveBenchmark(BOOST_DB(unsigned char), reserve());
+BITS_ReserveBenchmark(BOOST_DB(unsigned short), reserve());
+BITS_ReserveBenchmark(BOOST_DB(unsigned), reserve());
+BITS_ReserveBenchmark(BOOST_DB(unsigned long), reserve());
+BITS_ReserveBenchmark(BOOST_DB(unsigned long long), reserve());
+
+BITS_ShrinkToFitBenchmark(BOOST_DB(unsigned char), shrink_to_fit());
+BITS_ShrinkToFitBenchmark(BOOST_DB(unsigned short), shrink_to_fit());
+BITS_ShrinkToFitBenchmark(BOOST_DB(unsigned), shrink_to_fit());
+BITS_ShrinkToFitBenchmark(BOOST_DB(unsigned long), shrink_to_fit());
+BITS_ShrinkToFitBenchmark(BOOST_DB(unsigned long long), shrink_to_fit());
+
+BITS_FindFirstBenchmark(BOOST_DB(unsigned char), find_first());
+BITS_FindFirstBenchmark(BOOST_DB(unsigned short), find_first());
+BITS_FindFirstBenchmark(BOOST_DB(unsigned), find_first());
+BITS_FindFirstBenchmark(BOOST_DB(unsigned long), find_first());
+BITS_FindFirstBenchmark(BOOST_DB(unsigned long long), find_first());
+
+BITS_FindNextLoopBenchmark(BOOST_DB(unsigned char), find_next());
+BITS_FindNextLoopBenchmark(BOOST_DB(unsigned short), find_next());
+BITS_FindNextLoopBenchmark(BOOST_DB(unsigned), find_next());
+BITS_FindNextLoopBenchmark(BOOST_DB(unsigned long), find_next());
+BITS_FindNextLoopBenchmark(BOOST_DB(unsigned long long), find_next());
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/execution.hpp>
+#include <execution>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Bulk operation on `state.range(0)` bits with the `Policy` execution policy.
+ */
+template<const auto& Policy, char Operation>
+auto BM_ExecutionPolicy(::benchmark::State& state) -> void {
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  const DynamicBitset<> lhs(size);
+  DynamicBitset<> rhs(size);
+  rhs.Flip();
+  DynamicBitset<> dst(size);
+
+  for (auto _ : state) {
+    if constexpr (Operation == 'c') {
+      ::benchmark::DoNotOptimize(Count(Policy, lhs));
+    } else if constexpr (Operation == 'a') {
+      ::benchmark::DoNotOptimize(Any(Policy, lhs));
+    } else if constexpr (Operation == '&') {
+      ::benchmark::DoNotOptimize(And(Policy, dst, lhs, rhs));
+    } else if constexpr (Operation == '|') {
+      ::benchmark::DoNotOptimize(Or(Policy, dst, lhs, rhs));
+    } else if constexpr (Operation == '^') {
+      ::benchmark::DoNotOptimize(Xor(Policy, dst, lhs, rhs));
+    } else {
+      ::benchmark::DoNotOptimize(Transform(Policy, dst, lhs, std::bit_not<>{}));
+    }
+    ::benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(lhs.NumBlocks() * sizeof(std::size_t)));
+}
+
+/**
+ * @internal
+ * @brief From 8 KiB (stays in L1) to 128 MiB (memory bound) of storage.
+ */
+inline auto PolicyRangeGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgName("bits")->RangeMultiplier(16)->Range(1 << 16, 1LL << 30)->UseRealTime();
+}
+
+/**
+ * @internal
+ * @brief Decodes set bit positions of `state.range(0)` random bits to `std::uint32_t` with the `Policy` policy.
+ * @details Items are decoded indices, bytes are storage read plus indices written.
+ */
+template<const auto& Policy>
+auto BM_ExecutionToIndices(::benchmark::State& state) -> void {
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  DynamicBitset<> bits(size);
+  std::mt19937_64 engine{42};
+  std::generate_n(bits.Data(), bits.NumBlocks(), std::ref(engine));
+  std::vector<std::uint32_t> indices(bits.Count());
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(ToIndices(Policy, bits, std::span{indices}));
+    ::benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(indices.size()));
+  state.SetBytesProcessed(
+    state.iterations() *
+    static_cast<long long>(bits.NumBlocks() * sizeof(std::size_t) + indices.size() * sizeof(std::uint32_t))
+  );
+}
+
+/**
+ * @internal
+ * @brief From 8 KiB to 8 MiB of storage, the output is 16 times larger.
+ */
+inline auto IndicesRangeGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgName("bits")->RangeMultiplier(16)->Range(1 << 16, 1 << 26)->UseRealTime();
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_ExecutionPolicyBenchmark(policy, operation, func)      \
+  BENCHMARK(bits::benchmark::BM_ExecutionPolicy<policy, operation>) \
+    ->Name(BITS_BenchmarkNameGenerator(policy, func))               \
+    ->Apply(bits::benchmark::PolicyRangeGenerator)
+
+#define BITS_ExecutionPolicyBenchmarks(operation, func)                     \
+  BITS_ExecutionPolicyBenchmark(std::execution::seq, operation, func);      \
+  BITS_ExecutionPolicyBenchmark(std::execution::par, operation, func);      \
+  BITS_ExecutionPolicyBenchmark(std::execution::par_unseq, operation, func)
+
+BITS_ExecutionPolicyBenchmarks('c', Count());
+BITS_ExecutionPolicyBenchmarks('a', Any());
+BITS_ExecutionPolicyBenchmarks('&', And());
+BITS_ExecutionPolicyBenchmarks('|', Or());
+BITS_ExecutionPolicyBenchmarks('^', Xor());
+BITS_ExecutionPolicyBenchmarks('~', Transform(bit_not));
+
+#define BITS_ExecutionToIndicesBenchmark(policy)                           \
+  BENCHMARK(bits::benchmark::BM_ExecutionToIndices<policy>)                \
+    ->Name(BITS_BenchmarkNameGenerator(policy, ToIndices(span<uint32_t>))) \
+    ->Apply(bits::benchmark::IndicesRangeGenerator)
+
+BITS_ExecutionToIndicesBenchmark(std::execution::seq);
+BITS_ExecutionToIndicesBenchmark(std::execution::par);
+BITS_ExecutionToIndicesBenchmark(std::execution::par_unseq);
+
+BENCHMARK_MAIN();
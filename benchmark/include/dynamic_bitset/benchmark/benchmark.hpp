@@ -2,8 +2,15 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <climits>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 #include <numeric>
+#include <random>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 #if defined(BITS_DYNAMIC_BITSET_BENCHMARK)
@@ -25,6 +32,11 @@
   #define ANY_METHOD() Any()
   #define ALL_METHOD() All()
   #define NONE_METHOD() None()
+  #define RESIZE_METHOD(count) Resize(count)
+  #define RESERVE_METHOD(count) Reserve(bits::benchmark::BlocksOf<Container>(count))
+  #define SHRINK_TO_FIT_METHOD() ShrinkToFit()
+  #define FIND_FIRST_METHOD() FindFirst()
+  #define FIND_NEXT_METHOD(index) FindNext(index)
 #else
   #define SIZE_METHOD() size()
   #define CAPACITY_METHOD() capacity()
@@ -44,6 +56,11 @@
   #define ANY_METHOD() any()
   #define ALL_METHOD() all()
   #define NONE_METHOD() none()
+  #define RESIZE_METHOD(count) resize(count)
+  #define RESERVE_METHOD(count) reserve(count)
+  #define SHRINK_TO_FIT_METHOD() shrink_to_fit()
+  #define FIND_FIRST_METHOD() find_first()
+  #define FIND_NEXT_METHOD(index) find_next(index)
 #endif
 
 /**
@@ -52,6 +69,16 @@
  */
 namespace bits::benchmark {
 
+/**
+ * @brief Layouts of set bits in benchmark inputs, the third argument of query benchmarks.
+ */
+enum class Distribution : long long {
+  kUniform = 0,   /* every bit is set independently with the given density */
+  kClustered = 1, /* runs of 1024 set bits on average separated by gaps, matching the density on average */
+  kLastBit = 2,   /* only the last bit is set, the worst case of searches */
+  kPowerLaw = 3,  /* Pareto distributed gaps: dense bursts and long empty stretches */
+};
+
 /**
  * @brief Namespace containing range generators for benchmakrs.
  * @namespace generators
@@ -69,6 +96,12 @@ constexpr long long kDefaultStartRange{2};
 constexpr long long kDefaultLimitRange{INT_MAX};
 constexpr int kDefaultMultiplierRange{2};
 constexpr int kDefaultDenseStep{200'000'039};
+constexpr int kDefaultShiftSizeMultiplier{8};
+constexpr int kDefaultShiftMultiplier{64};
+constexpr long long kDefaultDistributionStartRange{1 << 10};
+constexpr int kDefaultDistributionMultiplier{32};
+constexpr std::uint64_t kDefaultDistributionSeed{20'261'018};
+constexpr double kDefaultClusteredRunLength{1'024};
 
 }  // namespace __details
 
@@ -82,8 +115,152 @@ auto MultiplicativeGenerator(::benchmark::internal::Benchmark* b) -> void {
   b->RangeMultiplier(Multiplier)->Range(Start, Limit);
 }
 
+/**
+ * @brief Sizes from 2^10 bits with uniform (1 to 1000 permille), clustered and power law (1 to 500 permille)
+ *        layouts and the single last bit.
+ */
+inline auto DistributionGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgNames({"bits", "permille", "distribution"});
+  const auto sizes{
+    ::benchmark::CreateRange(kDefaultDistributionStartRange, kDefaultLimitRange, kDefaultDistributionMultiplier)
+  };
+  for (const long long count : sizes) {
+    for (const long long permille : {1, 100, 500, 1'000}) {
+      b->Args({count, permille, static_cast<long long>(Distribution::kUniform)});
+    }
+    for (const Distribution distribution : {Distribution::kClustered, Distribution::kPowerLaw}) {
+      for (const long long permille : {1, 100, 500}) {
+        b->Args({count, permille, static_cast<long long>(distribution)});
+      }
+    }
+    b->Args({count, 0, static_cast<long long>(Distribution::kLastBit)});
+  }
+}
+
 }  // namespace generators
 
+/**
+ * @internal
+ * @brief Builds `count` bits with about `permille` set bits per 1000 laid out by `distribution`.
+ * @details Bits are set through `operator[]` so that every container can be filled, positions come from
+ *          gaps between set bits, so the cost is proportional to the number of set bits. The only
+ *          generator of benchmark inputs, density benchmarks use it with their own seeds.
+ */
+template<typename Container>
+auto MakeDistributionInput(
+  long long count, long long permille, Distribution distribution,
+  std::uint64_t seed = generators::kDefaultDistributionSeed
+) -> Container {
+  Container unit(count);
+  std::mt19937_64 engine{seed};
+  if (distribution == Distribution::kLastBit) {
+    unit[count - 1] = true;
+    return unit;
+  }
+  if (permille <= 0) {
+    return unit;
+  }
+  if (permille >= 1'000) {
+    for (long long bit{}; bit < count; ++bit) {
+      unit[bit] = true;
+    }
+    return unit;
+  }
+
+  const double density{static_cast<double>(permille) / 1'000};
+  std::geometric_distribution<long long> uniform_gap{density};
+  std::geometric_distribution<long long> run_length{1 / generators::kDefaultClusteredRunLength};
+  std::uniform_real_distribution<double> unit_interval{0.0, 1.0};
+  for (long long bit{}; bit < count;) {
+    switch (distribution) {
+      case Distribution::kClustered: {
+        const long long run{run_length(engine) + 1};
+        bit += static_cast<long long>(static_cast<double>(run) * (1 - density) / density);
+        for (const long long last{std::min(bit + run, count)}; bit < last; ++bit) {
+          unit[bit] = true;
+        }
+        break;
+      }
+      case Distribution::kPowerLaw: {
+        // Pareto gaps with shape 1.5 have the mean of 3 * scale, one set bit per 1 / density bits
+        constexpr double kShape{1.5};
+        const double scale{(1 / density - 1) / 3};
+        bit += std::llround(scale / std::pow(1 - unit_interval(engine), 1 / kShape));
+        if (bit < count) {
+          unit[bit++] = true;
+        }
+        break;
+      }
+      default:
+        bit += uniform_gap(engine);
+        if (bit < count) {
+          unit[bit++] = true;
+        }
+        break;
+    }
+  }
+  return unit;
+}
+
+/**
+ * @internal
+ * @brief Input of query benchmarks `(bits, permille, distribution)`, the last one is kept for the next run.
+ */
+template<typename Container>
+auto GetDistributionInput(const ::benchmark::State& state) -> const std::remove_cv_t<Container>& {
+  using Input = std::remove_cv_t<Container>;
+  static std::tuple<long long, long long, long long> key{-1, -1, -1};
+  static Input input;
+  const std::tuple<long long, long long, long long> current{state.range(0), state.range(1), state.range(2)};
+  if (current != key) {
+    input = Input{};
+    input = MakeDistributionInput<Input>(state.range(0), state.range(1), static_cast<Distribution>(state.range(2)));
+    key = current;
+  }
+  return input;
+}
+
+/**
+ * @internal
+ * @brief Bits per storage block of `Container`, `std::vector<bool>` stores bits in `unsigned long` words.
+ */
+template<typename Container>
+constexpr auto BlockBitsOf() -> long long {
+  if constexpr (requires { typename Container::block_type; }) {
+    return std::numeric_limits<typename Container::block_type>::digits;
+  } else {
+    return std::numeric_limits<unsigned long>::digits;
+  }
+}
+
+/**
+ * @internal
+ * @brief Number of blocks holding `count` bits, `DynamicBitset::Reserve()` takes blocks instead of bits.
+ */
+template<typename Container>
+constexpr auto BlocksOf(long long count) -> std::size_t {
+  return static_cast<std::size_t>((count + BlockBitsOf<Container>() - 1) / BlockBitsOf<Container>());
+}
+
+/**
+ * @internal
+ * @brief Reports the work of one iteration over `operands` containers of `count` bits each.
+ * @details Items are bits and bytes are whole blocks touched, so `bytes_per_second` is the effective memory
+ *          bandwidth and results of different sizes and block types are comparable. Counters: `bits_per_ns`
+ *          and `blocks` touched per iteration.
+ */
+template<typename Container>
+auto SetThroughput(::benchmark::State& state, long long count, long long operands = 1) -> void {
+  const auto blocks{static_cast<long long>(BlocksOf<Container>(count)) * operands};
+  state.SetItemsProcessed(state.iterations() * count * operands);
+  state.SetBytesProcessed(state.iterations() * blocks * (BlockBitsOf<Container>() / CHAR_BIT));
+  state.counters["bits_per_ns"] = ::benchmark::Counter(
+    static_cast<double>(state.iterations()) * static_cast<double>(count * operands) * 1e-9,
+    ::benchmark::Counter::kIsRate
+  );
+  state.counters["blocks"] = static_cast<double>(blocks);
+}
+
 template<typename Container>
 auto BM_DefaultConstructor(::benchmark::State& state) -> void {
   for (auto _ : state) {
@@ -101,6 +278,8 @@ auto BM_CopyConstructor(::benchmark::State& state) -> void {
     Container copied_unit(unit);
     ::benchmark::DoNotOptimize(copied_unit);
   }
+
+  SetThroughput<Container>(state, state.range(0), 2);
 }
 
 template<typename Container>
@@ -124,6 +303,8 @@ auto BM_CopyAssignment(::benchmark::State& state) -> void {
     unit2 = unit1;
     ::benchmark::DoNotOptimize(unit2);
   }
+
+  SetThroughput<Container>(state, state.range(0), 2);
 }
 
 template<typename Container>
@@ -148,6 +329,8 @@ auto BM_PushBack(::benchmark::State& state) -> void {
       unit.PUSH_BACK_METHOD(!(i & 1));
     }
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -160,6 +343,8 @@ auto BM_PopBack(::benchmark::State& state) -> void {
       unit.POP_BACK_METHOD();
     }
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -193,6 +378,8 @@ auto BM_SubscriptTraverse(::benchmark::State& state) -> void {
       ::benchmark::DoNotOptimize(bit_value);
     }
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -206,6 +393,8 @@ auto BM_AtTraverse(::benchmark::State& state) -> void {
       ::benchmark::DoNotOptimize(bit_value);
     }
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -219,17 +408,19 @@ auto BM_TestTraverse(::benchmark::State& state) -> void {
       ::benchmark::DoNotOptimize(bit_value);
     }
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
 auto BM_Count(::benchmark::State& state) -> void {
+  const auto& unit{GetDistributionInput<Container>(state)};
   for (auto _ : state) {
-    state.PauseTiming();
-    Container unit(state.range(0));
-    state.ResumeTiming();
     decltype(unit.COUNT_METHOD()) set_bits{unit.COUNT_METHOD()};
     ::benchmark::DoNotOptimize(set_bits);
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -245,30 +436,24 @@ auto BM_Empty(::benchmark::State& state) -> void {
 
 template<typename Container>
 auto BM_All(::benchmark::State& state) -> void {
+  const auto& unit{GetDistributionInput<Container>(state)};
   for (auto _ : state) {
-    state.PauseTiming();
-    Container unit(state.range(0));
-    state.ResumeTiming();
     ::benchmark::DoNotOptimize(unit.ALL_METHOD());
   }
 }
 
 template<typename Container>
 auto BM_Any(::benchmark::State& state) -> void {
+  const auto& unit{GetDistributionInput<Container>(state)};
   for (auto _ : state) {
-    state.PauseTiming();
-    Container unit(state.range(0));
-    state.ResumeTiming();
     ::benchmark::DoNotOptimize(unit.ANY_METHOD());
   }
 }
 
 template<typename Container>
 auto BM_None(::benchmark::State& state) -> void {
+  const auto& unit{GetDistributionInput<Container>(state)};
   for (auto _ : state) {
-    state.PauseTiming();
-    Container unit(state.range(0));
-    state.ResumeTiming();
     ::benchmark::DoNotOptimize(unit.NONE_METHOD());
   }
 }
@@ -282,6 +467,8 @@ auto BM_Set(::benchmark::State& state) -> void {
     unit.SET_METHOD();
     ::benchmark::DoNotOptimize(unit);
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -293,6 +480,8 @@ auto BM_Reset(::benchmark::State& state) -> void {
     unit.RESET_METHOD();
     ::benchmark::DoNotOptimize(unit);
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -304,6 +493,8 @@ auto BM_Flip(::benchmark::State& state) -> void {
     unit.FLIP_METHOD();
     ::benchmark::DoNotOptimize(unit);
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -314,6 +505,8 @@ auto BM_ToString(::benchmark::State& state) -> void {
     state.ResumeTiming();
     ::benchmark::DoNotOptimize(unit.TO_STRING_METHOD());
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -324,6 +517,8 @@ auto BM_Inverse(::benchmark::State& state) -> void {
     state.ResumeTiming();
     ::benchmark::DoNotOptimize(~unit);
   }
+
+  SetThroughput<Container>(state, state.range(0), 2);
 }
 
 template<typename Container>
@@ -368,7 +563,10 @@ auto BM_BitwiseAND(::benchmark::State& state) -> void {
     Container unit2(state.range(0));
     state.ResumeTiming();
     unit1 &= unit2;
+    ::benchmark::DoNotOptimize(unit1);
   }
+
+  SetThroughput<Container>(state, state.range(0), 2);
 }
 
 template<typename Container>
@@ -379,7 +577,10 @@ auto BM_BitwiseOR(::benchmark::State& state) -> void {
     Container unit2(state.range(0));
     state.ResumeTiming();
     unit1 |= unit2;
+    ::benchmark::DoNotOptimize(unit1);
   }
+
+  SetThroughput<Container>(state, state.range(0), 2);
 }
 
 template<typename Container>
@@ -388,9 +589,12 @@ auto BM_BitwiseXOR(::benchmark::State& state) -> void {
     state.PauseTiming();
     Container unit1(state.range(0));
     Container unit2(state.range(0));
-    state.PauseTiming();
+    state.ResumeTiming();
     unit1 ^= unit2;
+    ::benchmark::DoNotOptimize(unit1);
   }
+
+  SetThroughput<Container>(state, state.range(0), 2);
 }
 
 template<typename Container>
@@ -402,6 +606,8 @@ auto BM_BitwiseLeftShift(::benchmark::State& state) -> void {
     unit <<= state.range(1);
     ::benchmark::DoNotOptimize(unit);
   }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 template<typename Container>
@@ -413,6 +619,84 @@ auto BM_BitwiseRightShift(::benchmark::State& state) -> void {
     unit >>= state.range(1);
     ::benchmark::DoNotOptimize(unit);
   }
+
+  SetThroughput<Container>(state, state.range(0));
+}
+
+template<typename Container>
+auto BM_Equal(::benchmark::State& state) -> void {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container unit1(state.range(0));
+    Container unit2(state.range(0));
+    state.ResumeTiming();
+    ::benchmark::DoNotOptimize(unit1 == unit2);
+  }
+
+  SetThroughput<Container>(state, state.range(0), 2);
+}
+
+template<typename Container>
+auto BM_Resize(::benchmark::State& state) -> void {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container unit;
+    state.ResumeTiming();
+    unit.RESIZE_METHOD(state.range(0));
+    ::benchmark::DoNotOptimize(unit);
+  }
+
+  SetThroughput<Container>(state, state.range(0));
+}
+
+template<typename Container>
+auto BM_Reserve(::benchmark::State& state) -> void {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container unit;
+    state.ResumeTiming();
+    unit.RESERVE_METHOD(state.range(0));
+    ::benchmark::DoNotOptimize(unit);
+  }
+}
+
+template<typename Container>
+auto BM_ShrinkToFit(::benchmark::State& state) -> void {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container unit;
+    unit.RESERVE_METHOD(state.range(0) * 2);
+    unit.RESIZE_METHOD(state.range(0));
+    state.ResumeTiming();
+    unit.SHRINK_TO_FIT_METHOD();
+    ::benchmark::DoNotOptimize(unit);
+  }
+
+  SetThroughput<Container>(state, state.range(0));
+}
+
+template<typename Container>
+auto BM_FindFirst(::benchmark::State& state) -> void {
+  const auto& unit{GetDistributionInput<Container>(state)};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(unit.FIND_FIRST_METHOD());
+  }
+
+  // The search stops at the first set bit
+  const auto first{static_cast<long long>(std::min<std::size_t>(unit.FIND_FIRST_METHOD(), unit.SIZE_METHOD() - 1))};
+  SetThroughput<Container>(state, first + 1);
+}
+
+template<typename Container>
+auto BM_FindNextTraverse(::benchmark::State& state) -> void {
+  const auto& unit{GetDistributionInput<Container>(state)};
+  for (auto _ : state) {
+    for (auto i{unit.FIND_FIRST_METHOD()}; i < unit.SIZE_METHOD(); i = unit.FIND_NEXT_METHOD(i)) {
+      ::benchmark::DoNotOptimize(i);
+    }
+  }
+
+  SetThroughput<Container>(state, state.range(0));
 }
 
 }  // namespace bits::benchmark
@@ -491,7 +775,7 @@ auto BM_BitwiseRightShift(::benchmark::State& state) -> void {
 #define BITS_CountBenchmark(container, func)             \
   BENCHMARK(bits::benchmark::BM_Count<container>)        \
     ->Name(BITS_BenchmarkNameGenerator(container, func)) \
-    ->Apply(BITS_DefaultRangeGenerator)
+    ->Apply(bits::benchmark::generators::DistributionGenerator)
 
 #define BITS_EmptyBenchmark(container, func)             \
   BENCHMARK(bits::benchmark::BM_Empty<container>)        \
@@ -506,17 +790,17 @@ auto BM_BitwiseRightShift(::benchmark::State& state) -> void {
 #define BITS_AllBenchmark(container, func)               \
   BENCHMARK(bits::benchmark::BM_All<container>)          \
     ->Name(BITS_BenchmarkNameGenerator(container, func)) \
-    ->Apply(BITS_DefaultRangeGenerator)
+    ->Apply(bits::benchmark::generators::DistributionGenerator)
 
 #define BITS_AnyBenchmark(container, func)               \
   BENCHMARK(bits::benchmark::BM_Any<container>)          \
     ->Name(BITS_BenchmarkNameGenerator(container, func)) \
-    ->Apply(BITS_DefaultRangeGenerator)
+    ->Apply(bits::benchmark::generators::DistributionGenerator)
 
 #define BITS_NoneBenchmark(container, func)              \
   BENCHMARK(bits::benchmark::BM_None<container>)         \
     ->Name(BITS_BenchmarkNameGenerator(container, func)) \
-    ->Apply(BITS_DefaultRangeGenerator)
+    ->Apply(bits::benchmark::generators::DistributionGenerator)
 
 #define BITS_InverseBenchmark(container, func)           \
   BENCHMARK(bits::benchmark::BM_Inverse<container>)      \
@@ -573,10 +857,12 @@ auto BM_BitwiseRightShift(::benchmark::State& state) -> void {
     ->Name(BITS_BenchmarkNameGenerator(container, func))                                                          \
     ->ArgsProduct(                                                                                                \
       {benchmark::CreateRange(                                                                                    \
-         bits::benchmark::generators::kDefaultStartRange, bits::benchmark::generators::kDefaultLimitRange         \
+         bits::benchmark::generators::kDefaultStartRange,                                                         \
+         bits::benchmark::generators::kDefaultLimitRange,                                                         \
+         bits::benchmark::generators::kDefaultShiftSizeMultiplier                                                 \
        ),                                                                                                         \
        benchmark::CreateRange(                                                                                    \
-         1, bits::benchmark::generators::kDefaultLimitRange, bits::benchmark::generators::kDefaultMultiplierRange \
+         1, bits::benchmark::generators::kDefaultLimitRange, bits::benchmark::generators::kDefaultShiftMultiplier \
        )}                                                                                                         \
     )
 
@@ -585,9 +871,41 @@ auto BM_BitwiseRightShift(::benchmark::State& state) -> void {
     ->Name(BITS_BenchmarkNameGenerator(container, func))                                                          \
     ->ArgsProduct(                                                                                                \
       {benchmark::CreateRange(                                                                                    \
-         bits::benchmark::generators::kDefaultStartRange, bits::benchmark::generators::kDefaultLimitRange         \
+         bits::benchmark::generators::kDefaultStartRange,                                                         \
+         bits::benchmark::generators::kDefaultLimitRange,                                                         \
+         bits::benchmark::generators::kDefaultShiftSizeMultiplier                                                 \
        ),                                                                                                         \
        benchmark::CreateRange(                                                                                    \
-         1, bits::benchmark::generators::kDefaultLimitRange, bits::benchmark::generators::kDefaultMultiplierRange \
+         1, bits::benchmark::generators::kDefaultLimitRange, bits::benchmark::generators::kDefaultShiftMultiplier \
        )}                                                                                                         \
     )
+
+#define BITS_EqualOperatorBenchmark(container, func)     \
+  BENCHMARK(bits::benchmark::BM_Equal<container>)        \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+#define BITS_ResizeBenchmark(container, func)            \
+  BENCHMARK(bits::benchmark::BM_Resize<container>)       \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+#define BITS_ReserveBenchmark(container, func)           \
+  BENCHMARK(bits::benchmark::BM_Reserve<container>)      \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+#define BITS_ShrinkToFitBenchmark(container, func)       \
+  BENCHMARK(bits::benchmark::BM_ShrinkToFit<container>)  \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(BITS_DefaultRangeGenerator)
+
+#define BITS_FindFirstBenchmark(container, func)         \
+  BENCHMARK(bits::benchmark::BM_FindFirst<container>)    \
+    ->Name(BITS_BenchmarkNameGenerator(container, func)) \
+    ->Apply(bits::benchmark::generators::DistributionGenerator)
+
+#define BITS_FindNextLoopBenchmark(container, func)          \
+  BENCHMARK(bits::benchmark::BM_FindNextTraverse<container>) \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))     \
+    ->Apply(bits::benchmark::generators::DistributionGenerator)
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Mutex protected `DynamicBitset`, baseline for concurrent updates.
+ * @details Writes past `Size()` grow the set under the same lock.
+ */
+class LockedDynamicBitset {
+ public:
+  explicit LockedDynamicBitset(std::size_t bits) : bits_(bits) { }
+
+  auto TestAndSet(std::size_t index) -> bool {
+    const std::lock_guard lock{mutex_};
+    // PushBack() grows storage geometrically, Resize() allocates exactly
+    while (index >= bits_.Size()) {
+      bits_.PushBack(false);
+    }
+    const bool value{bits_.Test(index)};
+    bits_.Set(index, true);
+    return value;
+  }
+
+  auto Reset(std::size_t index) -> void {
+    const std::lock_guard lock{mutex_};
+    bits_.Reset(index);
+  }
+
+  auto PushBack(bool value) -> std::size_t {
+    const std::lock_guard lock{mutex_};
+    bits_.PushBack(value);
+    return bits_.Size() - 1;
+  }
+
+ private:
+  DynamicBitset<> bits_;
+  std::mutex mutex_;
+};
+
+/**
+ * @internal
+ * @brief Set shared by all threads of the running benchmark.
+ */
+template<typename Container>
+inline std::unique_ptr<Container> g_shared_bits;
+
+template<typename Container>
+auto SetupSharedBits(const ::benchmark::State& state) -> void {
+  g_shared_bits<Container> = std::make_unique<Container>(static_cast<std::size_t>(state.range(0)));
+}
+
+template<typename Container>
+auto TeardownSharedBits(const ::benchmark::State&) -> void {
+  g_shared_bits<Container>.reset();
+}
+
+/**
+ * @internal
+ * @brief Uniform random indices, independent per thread.
+ */
+inline auto NextIndex(std::uint64_t& state, std::size_t bits) noexcept -> std::size_t {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return static_cast<std::size_t>(state % bits);
+}
+
+/**
+ * @internal
+ * @brief Visited set: every thread claims random bits in a set of `state.range(0)` bits.
+ * @details Smaller sets mean more threads hitting the same cache lines.
+ */
+template<typename Container>
+auto BM_ConcurrentTestAndSet(::benchmark::State& state) -> void {
+  Container& bits{*g_shared_bits<Container>};
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  std::uint64_t random{0x9E3779B97F4A7C15ULL * (static_cast<std::uint64_t>(state.thread_index()) + 1)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(bits.TestAndSet(NextIndex(random, size)));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @internal
+ * @brief Write contention: every iteration sets one random bit and resets another one.
+ */
+template<typename Container>
+auto BM_ConcurrentSetReset(::benchmark::State& state) -> void {
+  Container& bits{*g_shared_bits<Container>};
+  const auto size{static_cast<std::size_t>(state.range(0))};
+  std::uint64_t random{0x9E3779B97F4A7C15ULL * (static_cast<std::uint64_t>(state.thread_index()) + 1)};
+
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(bits.TestAndSet(NextIndex(random, size)));
+    bits.Reset(NextIndex(random, size));
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+/**
+ * @internal
+ * @brief Set sizes from one cache line to one bit per 4 cache lines of 16M bits, 1 to 2 * cores threads.
+ */
+inline auto ContentionGenerator(::benchmark::internal::Benchmark* b) -> void {
+  const int threads{static_cast<int>(std::max(2U, std::thread::hardware_concurrency() * 2))};
+  b->ArgName("bits")->Arg(512)->Arg(1 << 16)->Arg(1 << 24)->ThreadRange(1, threads)->UseRealTime();
+}
+
+}  // namespace bits::benchmark
+
+#define BITS_ConcurrentBenchmark(benchmark_function, container, func)        \
+  BENCHMARK(bits::benchmark::benchmark_function<container>)                  \
+    ->Name(BITS_BenchmarkNameGenerator(container, func))                     \
+    ->Setup(bits::benchmark::SetupSharedBits<container>)                     \
+    ->Teardown(bits::benchmark::TeardownSharedBits<container>)               \
+    ->Apply(bits::benchmark::ContentionGenerator)
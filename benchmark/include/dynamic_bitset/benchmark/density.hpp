@@ -0,0 +1,40 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <dynamic_bitset/benchmark/benchmark.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+
+namespace bits::benchmark {
+
+/**
+ * @internal
+ * @brief Number of bits in compared sets.
+ */
+constexpr std::size_t kDensityBenchmarkBits{1 << 24};
+
+/**
+ * @internal
+ * @brief Builds flat input with `permille` density of set bits.
+ * @details Uniform or clustered layout of `MakeDistributionInput()`, `seed` tells apart operands.
+ */
+inline auto MakeDensityInput(long long permille, bool clustered, std::uint64_t seed) -> DynamicBitset<> {
+  return MakeDistributionInput<DynamicBitset<>>(
+    kDensityBenchmarkBits, permille, clustered ? Distribution::kClustered : Distribution::kUniform, seed
+  );
+}
+
+inline auto MemoryUsage(const DynamicBitset<>& bits) -> std::size_t {
+  return sizeof(bits) + bits.NumBlocks() * sizeof(DynamicBitset<>::BlockType);
+}
+
+/**
+ * @internal
+ * @brief Densities in permille for uniform and clustered layouts.
+ */
+inline auto DensityGenerator(::benchmark::internal::Benchmark* b) -> void {
+  b->ArgNames({"permille", "clustered"})->ArgsProduct({{1, 10, 100, 500}, {0, 1}})->Unit(::benchmark::kMicrosecond);
+}
+
+}  // namespace bits::benchmark
@@ -42,4 +42,12 @@ BITS_SizeBenchmark(STD_DB, size());
 
 BITS_CapacityBenchmark(STD_DB, capacity());
 
+BITS_EqualOperatorBenchmark(STD_DB, operator==);
+
+BITS_ResizeBenchmark(STD_DB, resize());
+
+BITS_ReserveBenchmark(STD_DB, reserve());
+
+BITS_ShrinkToFitBenchmark(STD_DB, shrink_to_fit());
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,640 @@
+/**
+ * @file dynamic_bitset/adaptive_bitset.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Set of 32-bit values switching between a sorted array and a bitmap
+ * @defgroup adaptive-bitset Adaptive bitset
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::lower_bound, std::sort, std::set_union, std::copy_if, std::all_of */
+#include <cstddef>   /* std::ptrdiff_t */
+#include <cstdint>   /* std::uint8_t, std::uint32_t */
+#include <iterator>  /* std::back_inserter */
+#include <limits>    /* std::numeric_limits */
+#include <span>      /* std::span */
+#include <stdexcept> /* std::out_of_range, std::invalid_argument */
+#include <utility>   /* std::move */
+#include <vector>    /* std::vector, std::erase_if */
+
+namespace bits {
+
+/**
+ * @brief Set of bits over a universe of up to 2^32 bits stored as a sorted `std::uint32_t` array or a bitmap.
+ * @details The array is used while it is smaller than the bitmap, i.e. up to `Size() / 32` set bits.
+ *          Past that limit the set moves to `DynamicBitset` storage and returns to the array once it
+ *          shrinks to half of the limit, so sets oscillating around the limit are not converted on
+ *          every update. Bitwise operations dispatch on the (array, bitmap) pair of operands: arrays
+ *          of very different sizes are intersected by galloping the smaller one through the larger one,
+ *          mixed pairs probe the bitmap with the array values and only bitmap pairs run word by word.
+ * @ingroup adaptive-bitset
+ *
+ * @tparam Block Unsigned integral type used for bitmap storage.
+ * @tparam Allocator Allocator of blocks.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::AdaptiveBitset<> a{std::size_t{1} << 32};
+ * a.Set(10, true).Set(4'000'000'000, true);   // Sorted array of two values
+ * bits::AdaptiveBitset<> b{bits::DynamicBitset<>(std::size_t{1} << 32).Set()};
+ * a &= b;                                     // Array probed against bitmap, `a` stays an array
+ * @endcode
+ */
+template<
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class AdaptiveBitset {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using value_type = std::uint32_t;
+  using ValueType = value_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using BitsetType = DynamicBitset<BlockType, Allocator>;
+
+  /**
+   * @public
+   * @brief Current storage of the set.
+   */
+  enum class Kind : std::uint8_t { kArray, kBitmap };
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kValueBits{std::numeric_limits<ValueType>::digits};
+    static constexpr SizeType kMaxBits{SizeType{1} << kValueBits};
+    static constexpr SizeType kGallopRatio{64};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs an empty set over an empty universe.
+   */
+  AdaptiveBitset() = default;
+
+  /**
+   * @public
+   * @brief Constructs an empty set over `bits` bits.
+   *
+   * @throws std::invalid_argument If `bits > 2^32`.
+   */
+  explicit AdaptiveBitset(SizeType bits) : bits_{bits} {
+    if (bits > BlockInfo::kMaxBits) {
+      throw std::invalid_argument{"bits::AdaptiveBitset::AdaptiveBitset(SizeType): universe is too large"};
+    }
+  }
+
+  /**
+   * @public
+   * @brief Constructs the set of `values` over `bits` bits, duplicates are ignored.
+   *
+   * @throws std::invalid_argument If `bits > 2^32`.
+   * @throws std::out_of_range If any value is not less than `bits`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  AdaptiveBitset(SizeType bits, std::span<const ValueType> values) : AdaptiveBitset(bits) {
+    array_.assign(values.begin(), values.end());
+    std::sort(array_.begin(), array_.end());
+    array_.erase(std::unique(array_.begin(), array_.end()), array_.end());
+    if (!array_.empty() && array_.back() >= bits_) {
+      throw std::out_of_range{
+        "bits::AdaptiveBitset::AdaptiveBitset(SizeType, std::span<const ValueType>): value is out of range"
+      };
+    }
+    count_ = array_.size();
+    Normalize();
+  }
+
+  /**
+   * @public
+   * @brief Constructs the set of bits set in `bits` in the smaller representation.
+   *
+   * @throws std::invalid_argument If `bits.Size() > 2^32`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit AdaptiveBitset(const BitsetType& bits) : AdaptiveBitset(bits.Size()) {
+    count_ = bits.Count();
+    if (count_ > ArrayLimit()) {
+      bitmap_ = bits;
+      bitmap_.Data()[(bits_ - 1) / BlockInfo::kBitsCount] &= __bits_details::TailMask<BlockType>(bits_);
+      kind_ = Kind::kBitmap;
+    } else {
+      array_.resize(count_);
+      bits.ToIndices(std::span{array_});
+    }
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of bits in the universe.
+   */
+  [[nodiscard]] func Size() const noexcept -> SizeType { return bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of set bits.
+   */
+  [[nodiscard]] func Count() const noexcept -> SizeType { return count_; }
+
+  /**
+   * @public
+   * @brief Returns the current storage of the set.
+   */
+  [[nodiscard]] func Representation() const noexcept -> Kind { return kind_; }
+
+  /**
+   * @public
+   * @brief Returns the number of bytes used by the object and its storage.
+   */
+  [[nodiscard]] func MemoryUsage() const noexcept -> SizeType {
+    return sizeof(*this) + array_.capacity() * sizeof(ValueType) + bitmap_.NumBlocks() * sizeof(BlockType);
+  }
+
+  /**
+   * @public
+   * @brief Returns the value of bit with `index`.
+   *
+   * @warning **Undefined Behaviour** if `index >= Size()`.
+   */
+  [[nodiscard]] func Test(SizeType index) const noexcept -> bool {
+    return kind_ == Kind::kArray ? std::binary_search(array_.begin(), array_.end(), static_cast<ValueType>(index))
+                                 : bitmap_.Test(index);
+  }
+
+  /**
+   * @public
+   * @brief Set the bit with `index` to `value`, converting the storage when it crosses the limit.
+   * @note Inserting into or removing from the array is linear in `Count()`.
+   *
+   * @param[in] index The zero-based index of the bit to set/unset.
+   * @param[in] value The boolean value `true/false`.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func Set(SizeType index, bool value = false) -> AdaptiveBitset& {
+    if (index >= bits_) {
+      throw std::out_of_range{"bits::AdaptiveBitset::Set(SizeType, bool = false): index is out of range"};
+    }
+
+    if (!value) {
+      ResetBit(index);
+    } else if (kind_ == Kind::kBitmap) {
+      count_ += !bitmap_.Test(index);
+      bitmap_.Set(index, true);
+    } else {
+      const auto position{std::lower_bound(array_.begin(), array_.end(), static_cast<ValueType>(index))};
+      if (position == array_.end() || *position != index) {
+        array_.insert(position, static_cast<ValueType>(index));
+        ++count_;
+        Normalize();
+      }
+    }
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Set bit with `index` to `false`. Implies range checking.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func Reset(SizeType index) -> AdaptiveBitset& {
+    if (index >= bits_) {
+      throw std::out_of_range{"bits::AdaptiveBitset::Reset(SizeType): index is out of range"};
+    }
+
+    ResetBit(index);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Returns the index of the first set bit or `Size()` if there is no such bit.
+   * @see DynamicBitset::FindFirst()
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func FindFirst() const noexcept -> SizeType { return FindFrom(0); }
+
+  /**
+   * @public
+   * @brief Returns the index of the first set bit after `index` or `Size()` if there is no such bit.
+   * @see DynamicBitset::FindNext()
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func FindNext(SizeType index) const noexcept -> SizeType {
+    return index + 1 < bits_ ? FindFrom(index + 1) : bits_;
+  }
+
+  /**
+   * @public
+   * @brief Returns the set as a `DynamicBitset` of `Size()` bits.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func ToDynamicBitset() const -> BitsetType {
+    if (kind_ == Kind::kBitmap) {
+      return bitmap_;
+    }
+    return ToBitmap(array_);
+  }
+
+  /**
+   * @public
+   * @brief Performs bitwise AND operation on all bits.
+   * @details Two arrays are intersected by galloping, an array and a bitmap by probing the bitmap with
+   *          the array values. The result never needs more storage than the smaller operand.
+   *
+   * @param[in] other Another `AdaptiveBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func operator&=(const AdaptiveBitset& other) -> AdaptiveBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::AdaptiveBitset::operator&=(): invalid storage size"};
+    }
+
+    if (kind_ == Kind::kArray && other.kind_ == Kind::kArray) {
+      AssignArray(
+        array_.size() <= other.array_.size() ? Intersect(array_, other.array_) : Intersect(other.array_, array_)
+      );
+    } else if (kind_ == Kind::kArray) {
+      std::erase_if(array_, [&other](ValueType value) -> bool { return !other.bitmap_.Test(value); });
+      count_ = array_.size();
+    } else if (other.kind_ == Kind::kArray) {
+      std::vector<ValueType> result;
+      result.reserve(other.array_.size());
+      std::copy_if(
+        other.array_.begin(), other.array_.end(), std::back_inserter(result),
+        [this](ValueType value) -> bool { return bitmap_.Test(value); }
+      );
+      AssignArray(std::move(result));
+    } else {
+      bitmap_ &= other.bitmap_;
+      count_ = bitmap_.Count();
+    }
+    Normalize();
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Performs bitwise OR operation on all bits.
+   *
+   * @param[in] other Another `AdaptiveBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func operator|=(const AdaptiveBitset& other) -> AdaptiveBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::AdaptiveBitset::operator|=(): invalid storage size"};
+    }
+
+    if (kind_ == Kind::kArray && other.kind_ == Kind::kArray && array_.size() + other.array_.size() > ArrayLimit()) {
+      MoveToBitmap();
+    }
+    if (kind_ == Kind::kArray && other.kind_ == Kind::kArray) {
+      std::vector<ValueType> result;
+      result.reserve(array_.size() + other.array_.size());
+      std::set_union(
+        array_.begin(), array_.end(), other.array_.begin(), other.array_.end(), std::back_inserter(result)
+      );
+      AssignArray(std::move(result));
+    } else if (kind_ == Kind::kBitmap && other.kind_ == Kind::kBitmap) {
+      bitmap_ |= other.bitmap_;
+      count_ = bitmap_.Count();
+    } else {
+      ApplyToBitmap(other, [](BlockType& word, BlockType bit) -> std::ptrdiff_t {
+        const std::ptrdiff_t added{!(word & bit)};
+        word |= bit;
+        return added;
+      });
+    }
+    Normalize();
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Performs bitwise XOR operation on all bits.
+   *
+   * @param[in] other Another `AdaptiveBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func operator^=(const AdaptiveBitset& other) -> AdaptiveBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::AdaptiveBitset::operator^=(): invalid storage size"};
+    }
+
+    if (kind_ == Kind::kArray && other.kind_ == Kind::kArray && array_.size() + other.array_.size() > ArrayLimit()) {
+      MoveToBitmap();
+    }
+    if (kind_ == Kind::kArray && other.kind_ == Kind::kArray) {
+      std::vector<ValueType> result;
+      result.reserve(array_.size() + other.array_.size());
+      std::set_symmetric_difference(
+        array_.begin(), array_.end(), other.array_.begin(), other.array_.end(), std::back_inserter(result)
+      );
+      AssignArray(std::move(result));
+    } else if (kind_ == Kind::kBitmap && other.kind_ == Kind::kBitmap) {
+      bitmap_ ^= other.bitmap_;
+      count_ = bitmap_.Count();
+    } else {
+      ApplyToBitmap(other, [](BlockType& word, BlockType bit) -> std::ptrdiff_t {
+        word ^= bit;
+        return word & bit ? 1 : -1;
+      });
+    }
+    Normalize();
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Checks if two objects have equal size and equal set bits regardless of representation.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func operator==(const AdaptiveBitset& other) const noexcept -> bool {
+    if (bits_ != other.bits_ || count_ != other.count_) {
+      return false;
+    }
+    if (kind_ != other.kind_) {
+      const AdaptiveBitset& array{kind_ == Kind::kArray ? *this : other};
+      const AdaptiveBitset& bitmap{kind_ == Kind::kArray ? other : *this};
+      return std::all_of(array.array_.begin(), array.array_.end(), [&bitmap](ValueType value) -> bool {
+        return bitmap.bitmap_.Test(value);
+      });
+    }
+    return kind_ == Kind::kArray ? array_ == other.array_ : bitmap_ == other.bitmap_;
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Largest number of values kept in the array, the array is smaller than the bitmap up to it.
+   */
+  [[nodiscard]] func ArrayLimit() const noexcept -> SizeType { return bits_ / BlockInfo::kValueBits; }
+
+  /**
+   * @internal
+   * @private
+   * @brief Moves to the bitmap past `ArrayLimit()` and back to the array at half of it.
+   */
+  func Normalize() -> void {
+    if (kind_ == Kind::kArray && count_ > ArrayLimit()) {
+      MoveToBitmap();
+    } else if (kind_ == Kind::kBitmap && count_ <= ArrayLimit() / 2) {
+      std::vector<ValueType> array(count_);
+      bitmap_.ToIndices(std::span{array});
+      AssignArray(std::move(array));
+    }
+  }
+
+  func AssignArray(std::vector<ValueType>&& array) noexcept -> void {
+    array_ = std::move(array);
+    count_ = array_.size();
+    bitmap_ = BitsetType{};
+    kind_ = Kind::kArray;
+  }
+
+  func MoveToBitmap() -> void {
+    bitmap_ = ToBitmap(array_);
+    array_ = std::vector<ValueType>{};
+    kind_ = Kind::kBitmap;
+  }
+
+  [[nodiscard]] func ToBitmap(const std::vector<ValueType>& array) const -> BitsetType {
+    BitsetType bitmap(bits_);
+    for (const ValueType value : array) {
+      bitmap.Data()[value / BlockInfo::kBitsCount] |=
+        static_cast<BlockType>(BlockType{1} << value % BlockInfo::kBitsCount);
+    }
+    return bitmap;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Combines an array operand into the bitmap operand with `operation(word, bit)`, which returns
+   *        the change of the number of set bits. `this` moves to the bitmap of `other` if it is the array.
+   */
+  template<typename Operation>
+  func ApplyToBitmap(const AdaptiveBitset& other, Operation operation) -> void {
+    const auto apply{[operation](BitsetType& bitmap, const std::vector<ValueType>& values) -> std::ptrdiff_t {
+      std::ptrdiff_t delta{};
+      for (const ValueType value : values) {
+        delta += operation(
+          bitmap.Data()[value / BlockInfo::kBitsCount],
+          static_cast<BlockType>(BlockType{1} << value % BlockInfo::kBitsCount)
+        );
+      }
+      return delta;
+    }};
+
+    if (kind_ == Kind::kBitmap) {
+      count_ = static_cast<SizeType>(static_cast<std::ptrdiff_t>(count_) + apply(bitmap_, other.array_));
+      return;
+    }
+    BitsetType bitmap{other.bitmap_};
+    count_ = static_cast<SizeType>(static_cast<std::ptrdiff_t>(other.count_) + apply(bitmap, array_));
+    array_ = std::vector<ValueType>{};
+    bitmap_ = std::move(bitmap);
+    kind_ = Kind::kBitmap;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Intersects sorted arrays by galloping every value of `small` through `large`.
+   * @details The search window doubles from the last match until it passes the value, then the
+   *          last window is binary searched, O(|small| log(|large| / |small|)) comparisons. Arrays
+   *          within `BlockInfo::kGallopRatio` of each other are merged branch-free instead.
+   */
+  [[nodiscard]] static func Intersect(const std::vector<ValueType>& small, const std::vector<ValueType>& large)
+    -> std::vector<ValueType> {
+    std::vector<ValueType> result;
+    if (small.size() * BlockInfo::kGallopRatio >= large.size()) {
+      result.resize(small.size());
+      SizeType found{};
+      for (auto lhs{small.begin()}, rhs{large.begin()}; lhs != small.end() && rhs != large.end();) {
+        const ValueType lhs_value{*lhs};
+        const ValueType rhs_value{*rhs};
+        result[found] = lhs_value;
+        found += lhs_value == rhs_value;
+        lhs += lhs_value <= rhs_value;
+        rhs += rhs_value <= lhs_value;
+      }
+      result.resize(found);
+      return result;
+    }
+
+    result.reserve(small.size());
+    auto cursor{large.begin()};
+    for (const ValueType value : small) {
+      if (cursor == large.end()) {
+        break;
+      }
+      if (*cursor < value) {
+        const auto remaining{static_cast<SizeType>(large.end() - cursor)};
+        SizeType bound{1};
+        while (bound < remaining && cursor[static_cast<std::ptrdiff_t>(bound)] < value) {
+          bound <<= 1;
+        }
+        cursor = std::lower_bound(
+          cursor + static_cast<std::ptrdiff_t>(bound / 2 + 1),
+          cursor + static_cast<std::ptrdiff_t>(std::min(bound + 1, remaining)), value
+        );
+      }
+      if (cursor != large.end() && *cursor == value) {
+        result.push_back(value);
+        ++cursor;
+      }
+    }
+    return result;
+  }
+
+  func ResetBit(SizeType index) -> void {
+    if (kind_ == Kind::kBitmap) {
+      count_ -= bitmap_.Test(index);
+      bitmap_.Reset(index);
+      Normalize();
+      return;
+    }
+
+    const auto position{std::lower_bound(array_.begin(), array_.end(), static_cast<ValueType>(index))};
+    if (position != array_.end() && *position == index) {
+      array_.erase(position);
+      --count_;
+    }
+  }
+
+  [[nodiscard]] func FindFrom(SizeType index) const noexcept -> SizeType {
+    if (index >= bits_) {
+      return bits_;
+    }
+    if (kind_ == Kind::kBitmap) {
+      return index ? bitmap_.FindNext(index - 1) : bitmap_.FindFirst();
+    }
+
+    const auto value{std::lower_bound(array_.begin(), array_.end(), static_cast<ValueType>(index))};
+    return value == array_.end() ? bits_ : *value;
+  }
+
+  SizeType bits_{};
+  SizeType count_{};
+  Kind kind_{Kind::kArray};
+  std::vector<ValueType> array_;
+  BitsetType bitmap_;
+};
+
+}  // namespace bits
+
+/**
+ * @brief Performs a bitwise AND between two `AdaptiveBitset` objects.
+ * @see bits::AdaptiveBitset::operator&=
+ * @ingroup adaptive-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails.
+ */
+template<typename Block, typename Allocator>
+[[nodiscard]] func operator&(
+  const bits::AdaptiveBitset<Block, Allocator>& lhs,  //
+  const bits::AdaptiveBitset<Block, Allocator>& rhs
+) /* clang-format off */ -> bits::AdaptiveBitset<Block, Allocator> /* clang-format on */ {
+  // Copy the smaller operand, the result fits its storage
+  const bool lhs_smaller{lhs.Count() <= rhs.Count()};
+  auto bits{lhs_smaller ? lhs : rhs};
+  bits &= lhs_smaller ? rhs : lhs;
+  return bits;
+}
+
+/**
+ * @brief Performs a bitwise OR between two `AdaptiveBitset` objects.
+ * @see bits::AdaptiveBitset::operator|=
+ * @ingroup adaptive-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails.
+ */
+template<typename Block, typename Allocator>
+[[nodiscard]] func operator|(
+  const bits::AdaptiveBitset<Block, Allocator>& lhs,  //
+  const bits::AdaptiveBitset<Block, Allocator>& rhs
+) /* clang-format off */ -> bits::AdaptiveBitset<Block, Allocator> /* clang-format on */ {
+  auto bits{lhs};
+  bits |= rhs;
+  return bits;
+}
+
+/**
+ * @brief Performs a bitwise XOR between two `AdaptiveBitset` objects.
+ * @see bits::AdaptiveBitset::operator^=
+ * @ingroup adaptive-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails.
+ */
+template<typename Block, typename Allocator>
+[[nodiscard]] func operator^(
+  const bits::AdaptiveBitset<Block, Allocator>& lhs,  //
+  const bits::AdaptiveBitset<Block, Allocator>& rhs
+) /* clang-format off */ -> bits::AdaptiveBitset<Block, Allocator> /* clang-format on */ {
+  auto bits{lhs};
+  bits ^= rhs;
+  return bits;
+}
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
@@ -0,0 +1,387 @@
+/**
+ * @file dynamic_bitset/atomic_dynamic_bitset.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Fixed size bitset with lock-free concurrent bit updates
+ * @defgroup atomic-dynamic-bitset Atomic dynamic bitset
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <atomic>    /* std::atomic, std::memory_order */
+#include <bit>       /* std::popcount */
+#include <limits>    /* std::numeric_limits */
+#include <memory>    /* std::unique_ptr, std::make_unique */
+#include <stdexcept> /* std::out_of_range */
+#include <utility>   /* std::exchange, std::move */
+
+namespace bits {
+
+/**
+ * @brief Fixed size bitset which allows concurrent reads and writes of separate and equal bits.
+ * @details Every block is a `std::atomic<Block>`, single bit updates are one `fetch_or`/`fetch_and`,
+ *          so threads never block each other. Typical use is a visited set shared by threads
+ *          of parallel graph traversal, where `TestAndSet()` tells which thread visited the vertex first.
+ *          Whole-set operations (`Count()`, `Snapshot()`, `Reset()`) are not atomic as a whole,
+ *          they observe or update every block atomically one by one.
+ * @ingroup atomic-dynamic-bitset
+ *
+ * @tparam Block Unsigned integral type used for bit storage.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::AtomicDynamicBitset visited{vertices};
+ * // From any thread
+ * if (!visited.TestAndSet(vertex)) {
+ *   // Only one thread gets here for each vertex
+ * }
+ * @endcode
+ */
+template<__bits_details::IsValidDynamicBitsetBlockType Block = size_t>
+class AtomicDynamicBitset {
+  static_assert(std::atomic<Block>::is_always_lock_free, "Block must have lock-free atomic operations");
+
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using value_type = bool;
+  using ValueType = value_type;
+  using block_type = Block;
+  using BlockType = block_type;
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kByteDivConst{kBitsCount < 32 ? sizeof(BlockType) + 2 : kBitsCount == 32 ? 5 : 6};
+    static constexpr SizeType kByteModConst{kBitsCount - 1};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kBit{1};
+    static constexpr BlockType kSet{std::numeric_limits<BlockType>::max()};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs empty `AtomicDynamicBitset`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  AtomicDynamicBitset() noexcept = default;
+
+  /**
+   * @public
+   * @brief Constructs `AtomicDynamicBitset` with `bits` unset bits.
+   *
+   * @param[in] bits Number of bits, fixed for the lifetime of the object.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit AtomicDynamicBitset(SizeType bits)
+    : bits_{bits}, blocks_{(bits + BlockInfo::kBitsCount - 1) >> BlockInfo::kByteDivConst} {
+    storage_ = std::make_unique<std::atomic<BlockType>[]>(blocks_);
+  }
+
+  /**
+   * @public
+   * @brief Constructs `AtomicDynamicBitset` with the content of `bits`.
+   *
+   * @tparam Allocator Allocator type of `bits`.
+   * @param[in] bits Source `DynamicBitset` object.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  template<typename Allocator>
+  explicit AtomicDynamicBitset(const DynamicBitset<BlockType, Allocator>& bits) : AtomicDynamicBitset(bits.Size()) {
+    for (SizeType block{}; block < blocks_; ++block) {
+      storage_[block].store(bits.Data()[block], std::memory_order_relaxed);
+    }
+    if (const SizeType remaining_bits{bits_ & BlockInfo::kByteModConst}; remaining_bits) {
+      // Bits past Size() in the last block are unspecified
+      storage_[blocks_ - 1].fetch_and(
+        static_cast<BlockType>(~(BitMask::kSet << remaining_bits)), std::memory_order_relaxed
+      );
+    }
+  }
+
+  AtomicDynamicBitset(const AtomicDynamicBitset&) = delete;
+  func operator=(const AtomicDynamicBitset&)->AtomicDynamicBitset& = delete;
+
+  AtomicDynamicBitset(AtomicDynamicBitset&& other) noexcept
+    : storage_{std::move(other.storage_)},
+      bits_{std::exchange(other.bits_, 0)},
+      blocks_{std::exchange(other.blocks_, 0)} { }
+
+  func operator=(AtomicDynamicBitset&& other) noexcept -> AtomicDynamicBitset& {
+    storage_ = std::move(other.storage_);
+    bits_ = std::exchange(other.bits_, 0);
+    blocks_ = std::exchange(other.blocks_, 0);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of bits.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Size() const noexcept -> SizeType { return bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of blocks.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func NumBlocks() const noexcept -> SizeType { return blocks_; }
+
+  /**
+   * @public
+   * @brief Checks if the `AtomicDynamicBitset` has no bits (`Size() == 0`).
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Empty() const noexcept -> bool { return !bits_; }
+
+  /**
+   * @public
+   * @brief Returns the value of bit with `index`.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the load, `std::memory_order_acquire` pairs with
+   *                  release (default) `Set()`/`TestAndSet()` of the same bit.
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if `index >= Size()`.
+   */
+  [[nodiscard]] func Test(SizeType index, std::memory_order order = std::memory_order_acquire) const noexcept -> bool {
+    BITS_DYNAMIC_BITSET_ASSERT(index < bits_);
+    return storage_[index >> BlockInfo::kByteDivConst].load(order) & Mask(index);
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `true` and returns its previous value.
+   * @details Bit which is already set is detected with a plain load, without a read-modify-write
+   *          of the shared cache line. Exactly one of the threads racing on an unset bit gets `false`.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the read-modify-write operation.
+   * @return Previous value of the bit.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func TestAndSet(SizeType index, std::memory_order order = std::memory_order_acq_rel) -> bool {
+    if (index >= bits_) [[unlikely]] {
+      throw std::out_of_range{
+        "bits::AtomicDynamicBitset::TestAndSet(SizeType, std::memory_order): index is out of range"
+      };
+    }
+
+    std::atomic<BlockType>& block{storage_[index >> BlockInfo::kByteDivConst]};
+    const BlockType mask{Mask(index)};
+    if (block.load(LoadOrder(order)) & mask) {
+      return true;
+    }
+    return block.fetch_or(mask, order) & mask;
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `false` and returns its previous value.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the read-modify-write operation.
+   * @return Previous value of the bit.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func TestAndReset(SizeType index, std::memory_order order = std::memory_order_acq_rel) -> bool {
+    if (index >= bits_) [[unlikely]] {
+      throw std::out_of_range{
+        "bits::AtomicDynamicBitset::TestAndReset(SizeType, std::memory_order): index is out of range"
+      };
+    }
+
+    const BlockType mask{Mask(index)};
+    return storage_[index >> BlockInfo::kByteDivConst].fetch_and(static_cast<BlockType>(~mask), order) & mask;
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `true`.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the read-modify-write operation.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func Set(SizeType index, std::memory_order order = std::memory_order_release) -> AtomicDynamicBitset& {
+    if (index >= bits_) [[unlikely]] {
+      throw std::out_of_range{"bits::AtomicDynamicBitset::Set(SizeType, std::memory_order): index is out of range"};
+    }
+
+    storage_[index >> BlockInfo::kByteDivConst].fetch_or(Mask(index), order);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `false`.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the read-modify-write operation.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func Reset(SizeType index, std::memory_order order = std::memory_order_release) -> AtomicDynamicBitset& {
+    if (index >= bits_) [[unlikely]] {
+      throw std::out_of_range{"bits::AtomicDynamicBitset::Reset(SizeType, std::memory_order): index is out of range"};
+    }
+
+    storage_[index >> BlockInfo::kByteDivConst].fetch_and(static_cast<BlockType>(~Mask(index)), order);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Sets all bits to `false` with relaxed stores.
+   * @note Not atomic as a whole, concurrent updates of the bits may survive.
+   *
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  func Reset() noexcept -> AtomicDynamicBitset& {
+    for (SizeType block{}; block < blocks_; ++block) {
+      storage_[block].store(0, std::memory_order_relaxed);
+    }
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of set bits.
+   * @note Not atomic as a whole, every block is loaded once with relaxed order.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Count() const noexcept -> SizeType {
+    SizeType count{};
+    for (SizeType block{}; block < blocks_; ++block) {
+      count += static_cast<SizeType>(std::popcount(storage_[block].load(std::memory_order_relaxed)));
+    }
+    return count;
+  }
+
+  /**
+   * @public
+   * @brief Copies the bits into a plain `DynamicBitset`.
+   * @details Blocks are loaded one by one with acquire order, so the result contains every update which
+   *          happened before the call and may contain any subset of concurrent updates.
+   *
+   * @tparam Allocator Allocator type of the result.
+   * @param[in] allocator Allocator used by the result.
+   * @return `DynamicBitset` with `Size()` bits.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::AtomicDynamicBitset<> visited{1024};
+   * // ... parallel traversal ...
+   * auto frontier{visited.Snapshot()}; // bits::DynamicBitset<>
+   * @endcode
+   */
+  template<typename Allocator = std::allocator<BlockType>>
+  [[nodiscard]] func Snapshot(const Allocator& allocator = Allocator{}) const -> DynamicBitset<BlockType, Allocator> {
+    DynamicBitset<BlockType, Allocator> bits(bits_, 0, allocator);
+    LoadBlocks(bits.Data(), blocks_);
+    return bits;
+  }
+
+  /**
+   * @public
+   * @brief Loads the first `count` blocks into `out` one by one with `order`.
+   *
+   * @param[out] out Destination of at least `count` blocks.
+   * @param[in] count Number of blocks to load.
+   * @param[in] order Memory order of every load.
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if `count > NumBlocks()`.
+   */
+  func LoadBlocks(BlockType* out, SizeType count, std::memory_order order = std::memory_order_acquire) const noexcept
+    -> void {
+    BITS_DYNAMIC_BITSET_ASSERT(count <= blocks_);
+    for (SizeType block{}; block < count; ++block) {
+      out[block] = storage_[block].load(order);
+    }
+  }
+
+ private:
+  [[nodiscard]] static constexpr func Mask(SizeType index) noexcept -> BlockType {
+    return static_cast<BlockType>(BitMask::kBit << (index & BlockInfo::kByteModConst));
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns the order of the load part of read-modify-write with `order`.
+   */
+  [[nodiscard]] static constexpr func LoadOrder(std::memory_order order) noexcept -> std::memory_order {
+    return order == std::memory_order_release   ? std::memory_order_relaxed
+           : order == std::memory_order_acq_rel ? std::memory_order_acquire
+                                                : order;
+  }
+
+ private:
+  std::unique_ptr<std::atomic<BlockType>[]> storage_;
+  SizeType bits_{};
+  SizeType blocks_{};
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
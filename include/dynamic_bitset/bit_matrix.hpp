@@ -0,0 +1,654 @@
+/**
+ * @file dynamic_bitset/bit_matrix.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Dense two-dimensional bit matrix in one row-major allocation
+ * @defgroup bit-matrix Bit matrix
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm>   /* std::copy_n, std::any_of */
+#include <array>       /* std::array */
+#include <bit>         /* std::countr_zero, std::popcount */
+#include <cstdint>     /* std::uint64_t */
+#include <limits>      /* std::numeric_limits */
+#include <memory>      /* std::allocator */
+#include <stdexcept>   /* std::invalid_argument, std::out_of_range */
+#include <type_traits> /* std::conditional_t */
+
+namespace __bits_details {
+
+/**
+ * @brief Transposes 64x64 bit tile in place, bit `c` of `tile[r]` is exchanged with bit `r` of `tile[c]`.
+ * @details Six butterfly steps swap off-diagonal blocks of 32, 16, ..., 1 bits. Steps with blocks of
+ *          at least 4 rows run on four rows at once with AVX2.
+ */
+inline func Transpose64(std::array<std::uint64_t, 64>& tile) noexcept -> void {
+  std::uint64_t mask{0x00000000'ffffffffULL};
+  for (std::size_t step{32}; step; step >>= 1, mask ^= mask << step) {
+    for (std::size_t row{}; row < 64; row += step * 2) {
+      std::size_t k{row};
+#if defined(__AVX2__)
+      const __m256i vector_mask{_mm256_set1_epi64x(static_cast<long long>(mask))};
+      const __m128i shift{_mm_cvtsi64_si128(static_cast<long long>(step))};
+      for (; k + 4 <= row + step; k += 4) {
+        auto* low{reinterpret_cast<__m256i*>(&tile[k])};
+        auto* high{reinterpret_cast<__m256i*>(&tile[k + step])};
+        const __m256i low_rows{_mm256_loadu_si256(low)};
+        const __m256i high_rows{_mm256_loadu_si256(high)};
+        const __m256i swap{
+          _mm256_and_si256(_mm256_xor_si256(_mm256_srl_epi64(low_rows, shift), high_rows), vector_mask)
+        };
+        _mm256_storeu_si256(high, _mm256_xor_si256(high_rows, swap));
+        _mm256_storeu_si256(low, _mm256_xor_si256(low_rows, _mm256_sll_epi64(swap, shift)));
+      }
+#endif
+      for (; k < row + step; ++k) {
+        const std::uint64_t swap{((tile[k] >> step) ^ tile[k + step]) & mask};
+        tile[k + step] ^= swap;
+        tile[k] ^= swap << step;
+      }
+    }
+  }
+}
+
+}  // namespace __bits_details
+
+namespace bits {
+
+/**
+ * @brief Dense `Rows() x Cols()` bit matrix stored row-major in a single allocation.
+ * @details Every row is padded to a whole number of 64-bit words, so rows start at word boundaries and
+ *          padding bits are always zero. Row views expose rows as bitsets, `Transpose()` works on
+ *          64x64 tiles and `Multiply()` computes the boolean product as an OR of rows of `rhs`.
+ * @ingroup bit-matrix
+ *
+ * @tparam Block Unsigned integral type used for bit storage, at most 64 bits wide.
+ * @tparam Allocator Allocator of blocks.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::BitMatrix<> adjacency{4, 4};
+ * adjacency.Set(0, 1, true);
+ * adjacency.Set(1, 2, true);
+ * auto two_hops{adjacency.Multiply(adjacency)}; // two_hops.Test(0, 2) == true
+ * @endcode
+ */
+template<
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class BitMatrix {
+  static_assert(std::numeric_limits<Block>::digits <= 64, "Block must be at most 64 bits wide");
+
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using allocator_type = Allocator;
+  using AllocatorType = allocator_type;
+  using BitsetType = DynamicBitset<BlockType, AllocatorType>;
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kByteDivConst{kBitsCount < 32 ? sizeof(BlockType) + 2 : kBitsCount == 32 ? 5 : 6};
+    static constexpr SizeType kByteModConst{kBitsCount - 1};
+    static constexpr SizeType kWordBlocks{64 / kBitsCount};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kBit{1};
+  };
+
+ public:
+  /**
+   * @brief View of one matrix row, usable where a bitset of `Cols()` bits is expected.
+   * @details Indices are column numbers. Mutating members are available for `RowView` only.
+   *          The view is invalidated when the matrix is destroyed or assigned.
+   *
+   * @tparam IsConst `true` for `ConstRowView`.
+   */
+  template<bool IsConst>
+  class BasicRowView {
+    friend class BitMatrix;
+    friend class BasicRowView<!IsConst>;
+
+   public:
+    using Pointer = std::conditional_t<IsConst, const BlockType*, BlockType*>;
+
+    /**
+     * @brief Converts `RowView` to `ConstRowView`.
+     */
+    constexpr operator BasicRowView<true>() const noexcept
+      requires(!IsConst)
+    {
+      return BasicRowView<true>{storage_, bits_};
+    }
+
+    /**
+     * @brief Returns the number of bits in the row, equal to `Cols()`.
+     */
+    [[nodiscard]] constexpr func Size() const noexcept -> SizeType { return bits_; }
+
+    /**
+     * @brief Returns the number of blocks used by the row, excluding padding words.
+     */
+    [[nodiscard]] constexpr func NumBlocks() const noexcept -> SizeType {
+      return (bits_ + BlockInfo::kByteModConst) >> BlockInfo::kByteDivConst;
+    }
+
+    /**
+     * @brief Returns pointer to the first block of the row.
+     */
+    [[nodiscard]] constexpr func Data() const noexcept -> Pointer { return storage_; }
+
+    /**
+     * @brief Returns the value of the bit in `column`.
+     *
+     * @throws std::out_of_range If `column >= Size()`.
+     */
+    [[nodiscard]] constexpr func Test(SizeType column) const -> bool {
+      if (column >= bits_) [[unlikely]] {
+        throw std::out_of_range{"bits::BitMatrix::RowView::Test(SizeType): column is out of range"};
+      }
+      return storage_[column >> BlockInfo::kByteDivConst] & Mask(column);
+    }
+
+    /**
+     * @brief Returns the number of set bits in the row.
+     */
+    [[nodiscard]] constexpr func Count() const noexcept -> SizeType {
+      SizeType count{};
+      for (SizeType block{}; block < NumBlocks(); ++block) {
+        count += static_cast<SizeType>(std::popcount(storage_[block]));
+      }
+      return count;
+    }
+
+    /**
+     * @brief Checks if any bit of the row is set.
+     */
+    [[nodiscard]] constexpr func Any() const noexcept -> bool {
+      return std::any_of(storage_, storage_ + NumBlocks(), [](BlockType block) noexcept -> bool { return block; });
+    }
+
+    /**
+     * @brief Sets the bit in `column` to `value`.
+     *
+     * @throws std::out_of_range If `column >= Size()`.
+     */
+    constexpr func Set(SizeType column, bool value = false) -> BasicRowView&
+      requires(!IsConst)
+    {
+      if (column >= bits_) [[unlikely]] {
+        throw std::out_of_range{"bits::BitMatrix::RowView::Set(SizeType, bool = false): column is out of range"};
+      }
+      BlockType& block{storage_[column >> BlockInfo::kByteDivConst]};
+      block = static_cast<BlockType>(value ? block | Mask(column) : block & ~Mask(column));
+      return *this;
+    }
+
+    /**
+     * @brief Sets the bit in `column` to `false`.
+     *
+     * @throws std::out_of_range If `column >= Size()`.
+     */
+    constexpr func Reset(SizeType column) -> BasicRowView&
+      requires(!IsConst)
+    {
+      if (column >= bits_) [[unlikely]] {
+        throw std::out_of_range{"bits::BitMatrix::RowView::Reset(SizeType): column is out of range"};
+      }
+      storage_[column >> BlockInfo::kByteDivConst] &= static_cast<BlockType>(~Mask(column));
+      return *this;
+    }
+
+    /**
+     * @brief Flips the bit in `column`.
+     *
+     * @throws std::out_of_range If `column >= Size()`.
+     */
+    constexpr func Flip(SizeType column) -> BasicRowView&
+      requires(!IsConst)
+    {
+      if (column >= bits_) [[unlikely]] {
+        throw std::out_of_range{"bits::BitMatrix::RowView::Flip(SizeType): column is out of range"};
+      }
+      storage_[column >> BlockInfo::kByteDivConst] ^= Mask(column);
+      return *this;
+    }
+
+    /**
+     * @brief Copies bits of `bits` into the row.
+     *
+     * @throws std::invalid_argument If `bits.Size() != Size()`.
+     */
+    constexpr func Assign(const BitsetType& bits) -> BasicRowView&
+      requires(!IsConst)
+    {
+      CheckSize(bits.Size(), "bits::BitMatrix::RowView::Assign(const DynamicBitset&): invalid size");
+      std::copy_n(bits.Data(), NumBlocks(), storage_);
+      ClearTail();
+      return *this;
+    }
+
+    /**
+     * @brief Stores `row & other` in the row, `other` is a row view or `DynamicBitset` of `Size()` bits.
+     *
+     * @throws std::invalid_argument If sizes differ.
+     */
+    template<typename Other>
+    constexpr func operator&=(const Other& other) -> BasicRowView&
+      requires(!IsConst)
+    {
+      CheckSize(other.Size(), "bits::BitMatrix::RowView::operator&=(const Other&): invalid size");
+      for (SizeType block{}; block < NumBlocks(); ++block) {
+        storage_[block] &= other.Data()[block];
+      }
+      ClearTail();
+      return *this;
+    }
+
+    /**
+     * @brief Stores `row | other` in the row, `other` is a row view or `DynamicBitset` of `Size()` bits.
+     *
+     * @throws std::invalid_argument If sizes differ.
+     */
+    template<typename Other>
+    constexpr func operator|=(const Other& other) -> BasicRowView&
+      requires(!IsConst)
+    {
+      CheckSize(other.Size(), "bits::BitMatrix::RowView::operator|=(const Other&): invalid size");
+      for (SizeType block{}; block < NumBlocks(); ++block) {
+        storage_[block] |= other.Data()[block];
+      }
+      ClearTail();
+      return *this;
+    }
+
+    /**
+     * @brief Stores `row ^ other` in the row, `other` is a row view or `DynamicBitset` of `Size()` bits.
+     *
+     * @throws std::invalid_argument If sizes differ.
+     */
+    template<typename Other>
+    constexpr func operator^=(const Other& other) -> BasicRowView&
+      requires(!IsConst)
+    {
+      CheckSize(other.Size(), "bits::BitMatrix::RowView::operator^=(const Other&): invalid size");
+      for (SizeType block{}; block < NumBlocks(); ++block) {
+        storage_[block] ^= other.Data()[block];
+      }
+      ClearTail();
+      return *this;
+    }
+
+    /**
+     * @brief Returns copy of the row as `DynamicBitset`.
+     *
+     * @throws std::bad_alloc If memory allocation fails.
+     */
+    [[nodiscard]] constexpr func ToDynamicBitset() const -> BitsetType {
+      BitsetType result(bits_);
+      std::copy_n(storage_, NumBlocks(), result.Data());
+      return result;
+    }
+
+   private:
+    constexpr BasicRowView(Pointer storage, SizeType bits) noexcept : storage_{storage}, bits_{bits} { }
+
+    [[nodiscard]] static constexpr func Mask(SizeType column) noexcept -> BlockType {
+      return static_cast<BlockType>(BitMask::kBit << (column & BlockInfo::kByteModConst));
+    }
+
+    constexpr func CheckSize(SizeType bits, const char* message) const -> void {
+      if (bits != bits_) [[unlikely]] {
+        throw std::invalid_argument{message};
+      }
+    }
+
+    // Padding bits stay zero, operands may carry unspecified bits past their size
+    constexpr func ClearTail() noexcept -> void {
+      if (bits_ & BlockInfo::kByteModConst) {
+        storage_[NumBlocks() - 1] &= __bits_details::TailMask<BlockType>(bits_);
+      }
+    }
+
+    Pointer storage_;
+    SizeType bits_;
+  };
+
+  using RowView = BasicRowView<false>;
+  using ConstRowView = BasicRowView<true>;
+
+  /**
+   * @public
+   * @brief Constructs an empty `0 x 0` matrix.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr BitMatrix() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) = default;
+
+  /**
+   * @public
+   * @brief Constructs `rows x cols` matrix with all bits unset.
+   *
+   * @param[in] rows Number of rows.
+   * @param[in] cols Number of columns.
+   * @param[in] allocator Allocator of the storage.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  constexpr BitMatrix(SizeType rows, SizeType cols, const AllocatorType& allocator = AllocatorType{})
+    : storage_(rows * Stride(cols) * BlockInfo::kBitsCount, 0, allocator),
+      rows_{rows},
+      cols_{cols},
+      stride_{Stride(cols)} { }
+
+  /**
+   * @public
+   * @brief Returns the number of rows.
+   */
+  [[nodiscard]] constexpr func Rows() const noexcept -> SizeType { return rows_; }
+
+  /**
+   * @public
+   * @brief Returns the number of columns.
+   */
+  [[nodiscard]] constexpr func Cols() const noexcept -> SizeType { return cols_; }
+
+  /**
+   * @public
+   * @brief Returns the distance between rows in blocks, a whole number of 64-bit words.
+   */
+  [[nodiscard]] constexpr func Stride() const noexcept -> SizeType { return stride_; }
+
+  /**
+   * @public
+   * @brief Checks if the matrix has no bits.
+   */
+  [[nodiscard]] constexpr func Empty() const noexcept -> bool { return !rows_ || !cols_; }
+
+  /**
+   * @public
+   * @brief Returns pointer to the first block of the first row.
+   */
+  [[nodiscard]] constexpr func Data() noexcept -> BlockType* { return storage_.Data(); }
+
+  /**
+   * @public
+   * @brief Returns pointer to the first block of the first row.
+   */
+  [[nodiscard]] constexpr func Data() const noexcept -> const BlockType* { return storage_.Data(); }
+
+  /**
+   * @public
+   * @brief Returns a copy of the allocator.
+   */
+  [[nodiscard]] constexpr func GetAllocator() const noexcept -> AllocatorType { return storage_.GetAllocator(); }
+
+  /**
+   * @public
+   * @brief Returns the value of the bit at `row`, `column`.
+   *
+   * @throws std::out_of_range If `row >= Rows()` or `column >= Cols()`.
+   */
+  [[nodiscard]] constexpr func Test(SizeType row, SizeType column) const -> bool {
+    CheckIndex(row, column, "bits::BitMatrix::Test(SizeType, SizeType): index is out of range");
+    return (*this)[row].Test(column);
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit at `row`, `column` to `value`.
+   *
+   * @throws std::out_of_range If `row >= Rows()` or `column >= Cols()`.
+   */
+  constexpr func Set(SizeType row, SizeType column, bool value = false) -> BitMatrix& {
+    CheckIndex(row, column, "bits::BitMatrix::Set(SizeType, SizeType, bool = false): index is out of range");
+    (*this)[row].Set(column, value);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit at `row`, `column` to `false`.
+   *
+   * @throws std::out_of_range If `row >= Rows()` or `column >= Cols()`.
+   */
+  constexpr func Reset(SizeType row, SizeType column) -> BitMatrix& {
+    CheckIndex(row, column, "bits::BitMatrix::Reset(SizeType, SizeType): index is out of range");
+    (*this)[row].Reset(column);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Flips the bit at `row`, `column`.
+   *
+   * @throws std::out_of_range If `row >= Rows()` or `column >= Cols()`.
+   */
+  constexpr func Flip(SizeType row, SizeType column) -> BitMatrix& {
+    CheckIndex(row, column, "bits::BitMatrix::Flip(SizeType, SizeType): index is out of range");
+    (*this)[row].Flip(column);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Returns view of `row` without range checking.
+   *
+   * @warning **Undefined Behaviour** if `row >= Rows()`.
+   */
+  [[nodiscard]] constexpr func operator[](SizeType row) noexcept -> RowView {
+    BITS_DYNAMIC_BITSET_ASSERT(row < rows_);
+    return RowView{storage_.Data() + row * stride_, cols_};
+  }
+
+  /**
+   * @public
+   * @brief Returns view of `row` without range checking.
+   *
+   * @warning **Undefined Behaviour** if `row >= Rows()`.
+   */
+  [[nodiscard]] constexpr func operator[](SizeType row) const noexcept -> ConstRowView {
+    BITS_DYNAMIC_BITSET_ASSERT(row < rows_);
+    return ConstRowView{storage_.Data() + row * stride_, cols_};
+  }
+
+  /**
+   * @public
+   * @brief Returns view of `row`.
+   *
+   * @throws std::out_of_range If `row >= Rows()`.
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::BitMatrix<> matrix{3, 100};
+   * matrix.Row(1) |= matrix.Row(0);
+   * @endcode
+   */
+  [[nodiscard]] constexpr func Row(SizeType row) -> RowView {
+    CheckIndex(row, 0, "bits::BitMatrix::Row(SizeType): row is out of range");
+    return (*this)[row];
+  }
+
+  /**
+   * @public
+   * @brief Returns view of `row`.
+   *
+   * @throws std::out_of_range If `row >= Rows()`.
+   */
+  [[nodiscard]] constexpr func Row(SizeType row) const -> ConstRowView {
+    CheckIndex(row, 0, "bits::BitMatrix::Row(SizeType): row is out of range");
+    return (*this)[row];
+  }
+
+  /**
+   * @public
+   * @brief Returns bits of `column` of every row as a `DynamicBitset` of `Rows()` bits.
+   *
+   * @throws std::out_of_range If `column >= Cols()`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] constexpr func Column(SizeType column) const -> BitsetType {
+    if (column >= cols_) [[unlikely]] {
+      throw std::out_of_range{"bits::BitMatrix::Column(SizeType): column is out of range"};
+    }
+
+    BitsetType result(rows_, 0, GetAllocator());
+    const BlockType* source{storage_.Data() + (column >> BlockInfo::kByteDivConst)};
+    const SizeType shift{column & BlockInfo::kByteModConst};
+    BlockType* out{result.Data()};
+    for (SizeType row{}; row < rows_; ++row, source += stride_) {
+      out[row >> BlockInfo::kByteDivConst] |=
+        static_cast<BlockType>((*source >> shift & BitMask::kBit) << (row & BlockInfo::kByteModConst));
+    }
+    return result;
+  }
+
+  /**
+   * @public
+   * @brief Returns the transposed `Cols() x Rows()` matrix.
+   * @details Rows are processed in tiles of 64 rows by 64 columns, every tile is transposed
+   *          in registers with a butterfly network (AVX2 when available) and stored as one word
+   *          of 64 result rows.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] constexpr func Transpose() const -> BitMatrix {
+    BitMatrix result(cols_, rows_, GetAllocator());
+    std::array<std::uint64_t, 64> tile;
+    for (SizeType row_tile{}; row_tile < rows_; row_tile += 64) {
+      for (SizeType word{}; word < stride_ / BlockInfo::kWordBlocks; ++word) {
+        for (SizeType row{}; row < 64; ++row) {
+          tile[row] = row_tile + row < rows_ ? LoadWord(row_tile + row, word) : 0;
+        }
+        __bits_details::Transpose64(tile);
+        for (SizeType column{}; column < 64 && word * 64 + column < cols_; ++column) {
+          result.StoreWord(word * 64 + column, row_tile / 64, tile[column]);
+        }
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @public
+   * @brief Returns the boolean product `this x rhs`, bit `(i, j)` is set if `(i, k)` and `(k, j)` are set for some `k`.
+   * @details Every result row is the OR of the rows of `rhs` selected by set bits of the row of `this`.
+   *
+   * @throws std::invalid_argument If `Cols() != rhs.Rows()`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] constexpr func Multiply(const BitMatrix& rhs) const -> BitMatrix {
+    if (cols_ != rhs.rows_) [[unlikely]] {
+      throw std::invalid_argument{"bits::BitMatrix::Multiply(const BitMatrix&): invalid matrix size"};
+    }
+
+    BitMatrix result(rows_, rhs.cols_, GetAllocator());
+    const SizeType blocks{(rhs.cols_ + BlockInfo::kByteModConst) >> BlockInfo::kByteDivConst};
+    for (SizeType row{}; row < rows_; ++row) {
+      const BlockType* lhs_row{storage_.Data() + row * stride_};
+      BlockType* out{result.storage_.Data() + row * result.stride_};
+      for (SizeType block{}; block < stride_; ++block) {
+        for (BlockType word{lhs_row[block]}; word; word &= static_cast<BlockType>(word - 1)) {
+          const SizeType k{(block << BlockInfo::kByteDivConst) + static_cast<SizeType>(std::countr_zero(word))};
+          const BlockType* rhs_row{rhs.storage_.Data() + k * rhs.stride_};
+          for (SizeType column{}; column < blocks; ++column) {
+            out[column] |= rhs_row[column];
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of set bits.
+   */
+  [[nodiscard]] constexpr func Count() const noexcept -> SizeType { return storage_.Empty() ? 0 : storage_.Count(); }
+
+  /**
+   * @public
+   * @brief Checks if matrices have equal dimensions and bits.
+   */
+  [[nodiscard]] constexpr func operator==(const BitMatrix& other) const noexcept -> bool {
+    return rows_ == other.rows_ && cols_ == other.cols_ && storage_ == other.storage_;
+  }
+
+ private:
+  [[nodiscard]] static constexpr func Stride(SizeType cols) noexcept -> SizeType {
+    return (cols + 63) / 64 * BlockInfo::kWordBlocks;
+  }
+
+  constexpr func CheckIndex(SizeType row, SizeType column, const char* message) const -> void {
+    if (row >= rows_ || column >= cols_) [[unlikely]] {
+      throw std::out_of_range{message};
+    }
+  }
+
+  [[nodiscard]] constexpr func LoadWord(SizeType row, SizeType word) const noexcept -> std::uint64_t {
+    const BlockType* blocks{storage_.Data() + row * stride_ + word * BlockInfo::kWordBlocks};
+    std::uint64_t result{};
+    for (SizeType block{}; block < BlockInfo::kWordBlocks; ++block) {
+      result |= static_cast<std::uint64_t>(blocks[block]) << (block * BlockInfo::kBitsCount);
+    }
+    return result;
+  }
+
+  constexpr func StoreWord(SizeType row, SizeType word, std::uint64_t value) noexcept -> void {
+    BlockType* blocks{storage_.Data() + row * stride_ + word * BlockInfo::kWordBlocks};
+    for (SizeType block{}; block < BlockInfo::kWordBlocks; ++block) {
+      blocks[block] = static_cast<BlockType>(value >> (block * BlockInfo::kBitsCount));
+    }
+  }
+
+  BitsetType storage_;
+  SizeType rows_{};
+  SizeType cols_{};
+  SizeType stride_{};
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
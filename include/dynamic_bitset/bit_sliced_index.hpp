@@ -0,0 +1,372 @@
+/**
+ * @file dynamic_bitset/bit_sliced_index.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Bit-sliced index of an unsigned integer column with range predicates and masked sums
+ * @defgroup bit-sliced-index Bit-sliced index
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <bit>       /* std::bit_width, std::countr_zero */
+#include <concepts>  /* std::unsigned_integral */
+#include <cstdint>   /* std::uint64_t */
+#include <limits>    /* std::numeric_limits */
+#include <span>      /* std::span */
+#include <stdexcept> /* std::out_of_range, std::invalid_argument */
+#include <vector>    /* std::vector */
+
+namespace bits {
+
+/**
+ * @brief Column of unsigned integers stored as one bitset per value bit.
+ * @details Slice `i` holds bit `i` of every row, only `std::bit_width` of the largest value slices are kept.
+ *          Comparisons run the O'Neil slice algorithm from the most significant slice down, 64 rows per
+ *          step, keeping "less than" and "equal so far" words and producing one result bitset of `Rows()`
+ *          bits. Sums weight the popcount of every slice, masked with `IntersectionCount()`.
+ * @ingroup bit-sliced-index
+ *
+ * @tparam Value Unsigned integral type of the column.
+ * @tparam Block Unsigned integral type used for bit storage.
+ * @tparam Allocator Allocator of blocks.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * std::vector<std::uint32_t> prices{10, 250, 75, 40};
+ * bits::BitSlicedIndex<std::uint32_t> index{prices};
+ * auto cheap{index.Less(50)};           // rows 0 and 3
+ * auto total{index.Sum(cheap)};         // total == 50
+ * auto middle{index.Between(40, 100)};  // rows 2 and 3
+ * @endcode
+ */
+template<
+  std::unsigned_integral Value = std::uint64_t,
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class BitSlicedIndex {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using value_type = Value;
+  using ValueType = value_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using BitsetType = DynamicBitset<BlockType, Allocator>;
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kSet{static_cast<BlockType>(-1)};
+    static constexpr BlockType kReset{0};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs an empty index.
+   */
+  BitSlicedIndex() = default;
+
+  /**
+   * @public
+   * @brief Constructs the index of `values`, row `i` holds `values[i]`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit BitSlicedIndex(std::span<const ValueType> values) : rows_{values.size()} {
+    ValueType max_value{};
+    for (const ValueType value : values) {
+      max_value |= value;
+    }
+    slices_.assign(static_cast<SizeType>(std::bit_width(max_value)), BitsetType(rows_));
+
+    for (SizeType row{}; row < rows_; ++row) {
+      const BlockType bit{static_cast<BlockType>(BlockType{1} << row % BlockInfo::kBitsCount)};
+      for (ValueType value{values[row]}; value; value &= value - 1) {
+        slices_[static_cast<SizeType>(std::countr_zero(value))].Data()[row / BlockInfo::kBitsCount] |= bit;
+      }
+    }
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of rows.
+   */
+  [[nodiscard]] func Rows() const noexcept -> SizeType { return rows_; }
+
+  /**
+   * @public
+   * @brief Returns the number of stored slices, the bit width of the largest value ever stored.
+   */
+  [[nodiscard]] func Slices() const noexcept -> SizeType { return slices_.size(); }
+
+  /**
+   * @public
+   * @brief Returns the bitset of rows having bit `slice` set.
+   *
+   * @throws std::out_of_range If `slice >= Slices()`.
+   */
+  [[nodiscard]] func Slice(SizeType slice) const -> const BitsetType& {
+    if (slice >= slices_.size()) [[unlikely]] {
+      throw std::out_of_range{"bits::BitSlicedIndex::Slice(SizeType): index is out of range"};
+    }
+    return slices_[slice];
+  }
+
+  /**
+   * @public
+   * @brief Returns the value of `row`.
+   *
+   * @throws std::out_of_range If `row >= Rows()`.
+   */
+  [[nodiscard]] func Get(SizeType row) const -> ValueType {
+    if (row >= rows_) [[unlikely]] {
+      throw std::out_of_range{"bits::BitSlicedIndex::Get(SizeType): index is out of range"};
+    }
+
+    ValueType value{};
+    for (SizeType slice{}; slice < slices_.size(); ++slice) {
+      value |= static_cast<ValueType>(static_cast<ValueType>(slices_[slice].Test(row)) << slice);
+    }
+    return value;
+  }
+
+  /**
+   * @public
+   * @brief Replaces the value of `row`, adding slices if `value` is wider than all stored values.
+   *
+   * @throws std::out_of_range If `row >= Rows()`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func Set(SizeType row, ValueType value) -> BitSlicedIndex& {
+    if (row >= rows_) [[unlikely]] {
+      throw std::out_of_range{"bits::BitSlicedIndex::Set(SizeType, ValueType): index is out of range"};
+    }
+
+    if (const auto width{static_cast<SizeType>(std::bit_width(value))}; width > slices_.size()) {
+      slices_.resize(width, BitsetType(rows_));
+    }
+    for (SizeType slice{}; slice < slices_.size(); ++slice) {
+      slices_[slice].Set(row, static_cast<bool>(value >> slice & 1));
+    }
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Returns the rows with values less than `value`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func Less(ValueType value) const -> BitsetType {
+    return Evaluate([this, value](SizeType block) -> BlockType { return Compare(block, value).less; });
+  }
+
+  /**
+   * @public
+   * @brief Returns the rows with values less than or equal to `value`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func LessEqual(ValueType value) const -> BitsetType {
+    return Evaluate([this, value](SizeType block) -> BlockType {
+      const Words words{Compare(block, value)};
+      return words.less | words.equal;
+    });
+  }
+
+  /**
+   * @public
+   * @brief Returns the rows with values greater than `value`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func Greater(ValueType value) const -> BitsetType {
+    return Evaluate([this, value](SizeType block) -> BlockType {
+      const Words words{Compare(block, value)};
+      return static_cast<BlockType>(~(words.less | words.equal));
+    });
+  }
+
+  /**
+   * @public
+   * @brief Returns the rows with values greater than or equal to `value`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func GreaterEqual(ValueType value) const -> BitsetType {
+    return Evaluate([this, value](SizeType block) -> BlockType {
+      return static_cast<BlockType>(~Compare(block, value).less);
+    });
+  }
+
+  /**
+   * @public
+   * @brief Returns the rows with values equal to `value`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func Equal(ValueType value) const -> BitsetType {
+    return Evaluate([this, value](SizeType block) -> BlockType { return Compare(block, value).equal; });
+  }
+
+  /**
+   * @public
+   * @brief Returns the rows with values not equal to `value`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func NotEqual(ValueType value) const -> BitsetType {
+    return Evaluate([this, value](SizeType block) -> BlockType {
+      return static_cast<BlockType>(~Compare(block, value).equal);
+    });
+  }
+
+  /**
+   * @public
+   * @brief Returns the rows with values in `[low, high]`, empty if `low > high`.
+   * @details Both bounds are evaluated in the same pass over the slices.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func Between(ValueType low, ValueType high) const -> BitsetType {
+    return Evaluate([this, low, high](SizeType block) -> BlockType { return CompareRange(block, low, high); });
+  }
+
+  /**
+   * @public
+   * @brief Returns the sum of all values, modulo 2^64.
+   */
+  [[nodiscard]] func Sum() const noexcept -> std::uint64_t {
+    std::uint64_t sum{};
+    for (SizeType slice{}; slice < slices_.size(); ++slice) {
+      sum += static_cast<std::uint64_t>(slices_[slice].Count()) << slice;
+    }
+    return sum;
+  }
+
+  /**
+   * @public
+   * @brief Returns the sum of values of rows set in `mask`, modulo 2^64.
+   *
+   * @throws std::invalid_argument If `mask.Size() != Rows()`.
+   */
+  [[nodiscard]] func Sum(const BitsetType& mask) const -> std::uint64_t {
+    if (mask.Size() != rows_) [[unlikely]] {
+      throw std::invalid_argument{"bits::BitSlicedIndex::Sum(const BitsetType&): invalid mask size"};
+    }
+
+    std::uint64_t sum{};
+    for (SizeType slice{}; slice < slices_.size(); ++slice) {
+      sum += static_cast<std::uint64_t>(slices_[slice].IntersectionCount(mask)) << slice;
+    }
+    return sum;
+  }
+
+ private:
+  struct Words final {
+    BlockType less;
+    BlockType equal;
+  };
+
+  // O'Neil comparison of 'BlockInfo::kBitsCount' rows against 'value', most significant slice first
+  [[nodiscard]] func Compare(SizeType block, ValueType value) const noexcept -> Words {
+    if (static_cast<SizeType>(std::bit_width(value)) > slices_.size()) {
+      return {BitMask::kSet, BitMask::kReset};
+    }
+
+    Words words{BitMask::kReset, BitMask::kSet};
+    for (SizeType slice{slices_.size()}; slice-- > 0;) {
+      Step(words, slices_[slice].Data()[block], value >> slice & 1);
+    }
+    return words;
+  }
+
+  // Rows of 'block' with values in '[low, high]', both comparisons share every load of a slice word
+  [[nodiscard]] func CompareRange(SizeType block, ValueType low, ValueType high) const noexcept -> BlockType {
+    if (static_cast<SizeType>(std::bit_width(low)) > slices_.size()) {
+      return BitMask::kReset;
+    }
+    if (static_cast<SizeType>(std::bit_width(high)) > slices_.size()) {
+      return static_cast<BlockType>(~Compare(block, low).less);
+    }
+
+    Words lower{BitMask::kReset, BitMask::kSet};
+    Words upper{BitMask::kReset, BitMask::kSet};
+    for (SizeType slice{slices_.size()}; slice-- > 0;) {
+      const BlockType bits{slices_[slice].Data()[block]};
+      Step(lower, bits, low >> slice & 1);
+      Step(upper, bits, high >> slice & 1);
+    }
+    return static_cast<BlockType>(~lower.less & (upper.less | upper.equal));
+  }
+
+  // One slice of the comparison: rows still equal to the prefix become less where the value has 1 and the row 0
+  static func Step(Words& words, BlockType bits, bool value_bit) noexcept -> void {
+    if (value_bit) {
+      words.less |= static_cast<BlockType>(words.equal & ~bits);
+      words.equal &= bits;
+    } else {
+      words.equal &= static_cast<BlockType>(~bits);
+    }
+  }
+
+  template<typename Function>
+  [[nodiscard]] func Evaluate(Function function) const -> BitsetType {
+    BitsetType result(rows_);
+    const SizeType blocks{(rows_ + BlockInfo::kBitsCount - 1) / BlockInfo::kBitsCount};
+    for (SizeType block{}; block < blocks; ++block) {
+      result.Data()[block] = function(block);
+    }
+    if (blocks) {
+      result.Data()[blocks - 1] &= __bits_details::TailMask<BlockType>(rows_);
+    }
+    return result;
+  }
+
+  SizeType rows_{};
+  std::vector<BitsetType> slices_;
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
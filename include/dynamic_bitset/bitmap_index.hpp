@@ -0,0 +1,472 @@
+/**
+ * @file dynamic_bitset/bitmap_index.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Bitmap index of categorical columns and AND/OR/NOT predicate evaluation
+ * @defgroup bitmap-index Bitmap index
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm>        /* std::stable_sort, std::fill_n, std::copy_n, std::min */
+#include <bit>              /* std::popcount */
+#include <cstdint>          /* std::uint8_t */
+#include <functional>       /* std::hash, std::equal_to */
+#include <initializer_list> /* std::initializer_list */
+#include <iterator>         /* std::back_inserter */
+#include <limits>           /* std::numeric_limits */
+#include <span>             /* std::span */
+#include <stdexcept>        /* std::invalid_argument */
+#include <unordered_map>    /* std::unordered_map */
+#include <utility>          /* std::move */
+#include <vector>           /* std::vector */
+
+namespace bits {
+
+template<
+  typename Key,
+  typename Hash,
+  typename KeyEqual,
+  __bits_details::IsValidDynamicBitsetBlockType Block,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator>
+class BitmapIndex;
+
+/**
+ * @brief Tree of AND/OR/NOT over bitmaps of `BitmapIndex` keys, evaluated chunk by chunk.
+ * @details Leaves are created by `BitmapIndex::Equal()` and `BitmapIndex::In()` and may come from
+ *          different indexes over the same rows. Every node keeps an estimate of its result cardinality;
+ *          AND children are ordered from the most to the least selective, OR children the other way
+ *          around. Evaluation runs over chunks of `kChunkBits` rows and stops combining the children of
+ *          a chunk as soon as an AND becomes all zeros or an OR all ones.
+ *
+ *          Leaves point into their index, which must outlive the predicate.
+ * @ingroup bitmap-index
+ *
+ * @tparam Block Unsigned integral type used for bit storage.
+ * @tparam Allocator Allocator of blocks of evaluation results.
+ */
+template<
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class BitmapPredicate {
+  template<
+    typename Key,
+    typename Hash,
+    typename KeyEqual,
+    __bits_details::IsValidDynamicBitsetBlockType OtherBlock,
+    __bits_details::IsValidDynamicBitsetAllocatorType OtherAllocator>
+  friend class BitmapIndex;
+
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using BitsetType = DynamicBitset<BlockType, Allocator>;
+
+  /**
+   * @brief Number of rows evaluated at once, one chunk of every nesting level stays in L1 cache.
+   */
+  static constexpr SizeType kChunkBits{1 << 15};
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kChunkBlocks{kChunkBits / kBitsCount};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kSet{static_cast<BlockType>(-1)};
+    static constexpr BlockType kReset{0};
+  };
+
+  enum class Kind : std::uint8_t { kLeaf, kAnd, kOr, kNot };
+
+ public:
+  /**
+   * @public
+   * @brief Returns the number of rows the predicate is evaluated over.
+   */
+  [[nodiscard]] func Rows() const noexcept -> SizeType { return rows_; }
+
+  /**
+   * @public
+   * @brief Returns the upper bound of matching rows used to order the work, exact for leaves.
+   */
+  [[nodiscard]] func Estimate() const noexcept -> SizeType { return estimate_; }
+
+  /**
+   * @public
+   * @brief Returns the bitset of matching rows.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   *
+   * @par Example:
+   * @code{.cpp}
+   * auto rows{(region.Equal("eu") & ~status.Equal("closed")).Evaluate()};
+   * @endcode
+   */
+  [[nodiscard]] func Evaluate() const -> BitsetType {
+    BitsetType result(rows_);
+    const SizeType blocks{(rows_ + BlockInfo::kBitsCount - 1) / BlockInfo::kBitsCount};
+    std::vector<BlockType> scratch(height_ * BlockInfo::kChunkBlocks);
+    for (SizeType begin{}; begin < blocks; begin += BlockInfo::kChunkBlocks) {
+      Apply(begin, std::min(BlockInfo::kChunkBlocks, blocks - begin), result.Data() + begin, scratch.data());
+    }
+    if (blocks) {
+      result.Data()[blocks - 1] &= __bits_details::TailMask<BlockType>(rows_);
+    }
+    return result;
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of matching rows without materializing the result.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func Count() const -> SizeType {
+    if (kind_ == Kind::kLeaf) {
+      return estimate_;
+    }
+
+    const SizeType blocks{(rows_ + BlockInfo::kBitsCount - 1) / BlockInfo::kBitsCount};
+    std::vector<BlockType> scratch((height_ + 1) * BlockInfo::kChunkBlocks);
+    SizeType count{};
+    for (SizeType begin{}; begin < blocks; begin += BlockInfo::kChunkBlocks) {
+      const SizeType chunk{std::min(BlockInfo::kChunkBlocks, blocks - begin)};
+      Apply(begin, chunk, scratch.data(), scratch.data() + BlockInfo::kChunkBlocks);
+      if (begin + chunk == blocks) {
+        scratch[chunk - 1] &= __bits_details::TailMask<BlockType>(rows_);
+      }
+      for (SizeType block{}; block < chunk; ++block) {
+        count += static_cast<SizeType>(std::popcount(scratch[block]));
+      }
+    }
+    return count;
+  }
+
+  /**
+   * @public
+   * @brief Returns the conjunction of predicates over the same rows.
+   *
+   * @throws std::invalid_argument If predicates have different numbers of rows.
+   */
+  [[nodiscard]] friend func operator&(BitmapPredicate lhs, BitmapPredicate rhs) -> BitmapPredicate {
+    if (lhs.rows_ != rhs.rows_) [[unlikely]] {
+      throw std::invalid_argument{"bits::BitmapPredicate::operator&(BitmapPredicate, BitmapPredicate): invalid rows"};
+    }
+    return Combine(Kind::kAnd, std::move(lhs), std::move(rhs));
+  }
+
+  /**
+   * @public
+   * @brief Returns the disjunction of predicates over the same rows.
+   *
+   * @throws std::invalid_argument If predicates have different numbers of rows.
+   */
+  [[nodiscard]] friend func operator|(BitmapPredicate lhs, BitmapPredicate rhs) -> BitmapPredicate {
+    if (lhs.rows_ != rhs.rows_) [[unlikely]] {
+      throw std::invalid_argument{"bits::BitmapPredicate::operator|(BitmapPredicate, BitmapPredicate): invalid rows"};
+    }
+    return Combine(Kind::kOr, std::move(lhs), std::move(rhs));
+  }
+
+  /**
+   * @public
+   * @brief Returns the negation of the predicate, double negations cancel out.
+   */
+  [[nodiscard]] friend func operator~(BitmapPredicate predicate) -> BitmapPredicate {
+    if (predicate.kind_ == Kind::kNot) {
+      return std::move(predicate.children_.front());
+    }
+
+    BitmapPredicate result{Kind::kNot, predicate.rows_};
+    result.estimate_ = predicate.rows_ - (predicate.kind_ == Kind::kLeaf ? predicate.estimate_ : 0);
+    result.height_ = predicate.height_ + 1;
+    result.children_.push_back(std::move(predicate));
+    return result;
+  }
+
+ private:
+  BitmapPredicate(Kind kind, SizeType rows) : kind_{kind}, rows_{rows} { }
+
+  BitmapPredicate(const BlockType* data, SizeType rows, SizeType count)
+    : kind_{Kind::kLeaf}, data_{data}, rows_{rows}, estimate_{count} { }
+
+  [[nodiscard]] static func Combine(Kind kind, BitmapPredicate lhs, BitmapPredicate rhs) -> BitmapPredicate {
+    BitmapPredicate result{kind, lhs.rows_};
+    for (BitmapPredicate* operand : {&lhs, &rhs}) {
+      if (operand->kind_ == kind) {
+        std::move(operand->children_.begin(), operand->children_.end(), std::back_inserter(result.children_));
+      } else {
+        result.children_.push_back(std::move(*operand));
+      }
+    }
+
+    // Most selective first for AND, least selective first for OR: both saturate a chunk early
+    std::stable_sort(
+      result.children_.begin(), result.children_.end(),
+      [kind](const BitmapPredicate& left, const BitmapPredicate& right) -> bool {
+        return kind == Kind::kAnd ? left.estimate_ < right.estimate_ : left.estimate_ > right.estimate_;
+      }
+    );
+
+    result.estimate_ = kind == Kind::kAnd ? result.rows_ : 0;
+    for (const BitmapPredicate& child : result.children_) {
+      result.estimate_ = kind == Kind::kAnd ? std::min(result.estimate_, child.estimate_)
+                                            : std::min(result.rows_, result.estimate_ + child.estimate_);
+      result.height_ = std::max(result.height_, child.height_ + 1);
+    }
+    return result;
+  }
+
+  // Writes blocks [begin, begin + count) of the result to 'out', deeper levels use 'scratch'
+  func Apply(SizeType begin, SizeType count, BlockType* out, BlockType* scratch) const noexcept -> void {
+    switch (kind_) {
+      case Kind::kLeaf:
+        if (data_) {
+          std::copy_n(data_ + begin, count, out);
+        } else {
+          std::fill_n(out, count, BitMask::kReset);
+        }
+        return;
+      case Kind::kNot:
+        children_.front().Apply(begin, count, out, scratch);
+        for (SizeType block{}; block < count; ++block) {
+          out[block] = static_cast<BlockType>(~out[block]);
+        }
+        return;
+      case Kind::kAnd:
+      case Kind::kOr:
+        break;
+    }
+
+    const bool conjunction{kind_ == Kind::kAnd};
+    children_.front().Apply(begin, count, out, scratch);
+    for (SizeType child{1}; child < children_.size(); ++child) {
+      if (Saturated(conjunction, out, count)) {
+        return;
+      }
+
+      const BitmapPredicate& operand{children_[child]};
+      const BlockType* source{operand.data_ ? operand.data_ + begin : nullptr};
+      if (operand.kind_ != Kind::kLeaf) {
+        operand.Apply(begin, count, scratch, scratch + BlockInfo::kChunkBlocks);
+        source = scratch;
+      } else if (!source) {
+        // Missing key: AND clears the chunk, OR leaves it unchanged
+        if (conjunction) {
+          std::fill_n(out, count, BitMask::kReset);
+        }
+        continue;
+      }
+
+      for (SizeType block{}; block < count; ++block) {
+        out[block] = conjunction ? out[block] & source[block] : out[block] | source[block];
+      }
+    }
+  }
+
+  [[nodiscard]] static func Saturated(bool conjunction, const BlockType* out, SizeType count) noexcept -> bool {
+    BlockType summary{conjunction ? BitMask::kReset : BitMask::kSet};
+    for (SizeType block{}; block < count; ++block) {
+      summary = conjunction ? summary | out[block] : summary & out[block];
+    }
+    return summary == (conjunction ? BitMask::kReset : BitMask::kSet);
+  }
+
+  Kind kind_;
+  const BlockType* data_{};
+  SizeType rows_;
+  SizeType estimate_{};
+  SizeType height_{};
+  std::vector<BitmapPredicate> children_;
+};
+
+/**
+ * @brief Index of a categorical column with one bitset of rows per distinct key.
+ * @details All bitsets are built in one pass over the column. Lookups return `BitmapPredicate` leaves
+ *          that combine with `&`, `|` and `~`, also with leaves of other indexes over the same rows.
+ * @ingroup bitmap-index
+ *
+ * @tparam Key Type of the column values.
+ * @tparam Hash Hash of keys.
+ * @tparam KeyEqual Equality of keys.
+ * @tparam Block Unsigned integral type used for bit storage.
+ * @tparam Allocator Allocator of blocks.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * std::vector<std::string> regions{"eu", "us", "eu", "asia"};
+ * std::vector<int> statuses{1, 2, 3, 1};
+ * bits::BitmapIndex<std::string> region{regions};
+ * bits::BitmapIndex<int> status{statuses};
+ * auto query{region.Equal("eu") & ~status.In({2, 3})};
+ * auto matches{query.Count()}; // matches == 1, row 0
+ * @endcode
+ */
+template<
+  typename Key,
+  typename Hash = std::hash<Key>,
+  typename KeyEqual = std::equal_to<Key>,
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class BitmapIndex {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using key_type = Key;
+  using KeyType = key_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using BitsetType = DynamicBitset<BlockType, Allocator>;
+  using PredicateType = BitmapPredicate<BlockType, Allocator>;
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+  };
+
+  struct Entry final {
+    BitsetType bits;
+    SizeType count{};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs an empty index.
+   */
+  BitmapIndex() = default;
+
+  /**
+   * @public
+   * @brief Constructs the index of `column`, row `i` has key `column[i]`.
+   * @details Consecutive equal keys reuse the previous lookup, so sorted or clustered columns are cheaper.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit BitmapIndex(std::span<const KeyType> column) : rows_{column.size()} {
+    Entry* entry{};
+    const KeyType* previous{};
+    for (SizeType row{}; row < rows_; ++row) {
+      if (!previous || !KeyEqual{}(*previous, column[row])) {
+        auto iterator{entries_.find(column[row])};
+        if (iterator == entries_.end()) {
+          iterator = entries_.emplace(column[row], Entry{BitsetType(rows_)}).first;
+        }
+        entry = &iterator->second;
+        previous = &column[row];
+      }
+      entry->bits.Data()[row / BlockInfo::kBitsCount] |= static_cast<BlockType>(
+        BlockType{1} << row % BlockInfo::kBitsCount
+      );
+      ++entry->count;
+    }
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of rows.
+   */
+  [[nodiscard]] func Rows() const noexcept -> SizeType { return rows_; }
+
+  /**
+   * @public
+   * @brief Returns the number of distinct keys.
+   */
+  [[nodiscard]] func Cardinality() const noexcept -> SizeType { return entries_.size(); }
+
+  /**
+   * @public
+   * @brief Returns the number of rows with `key`.
+   */
+  [[nodiscard]] func Count(const KeyType& key) const -> SizeType {
+    const auto iterator{entries_.find(key)};
+    return iterator == entries_.end() ? 0 : iterator->second.count;
+  }
+
+  /**
+   * @public
+   * @brief Returns the bitset of rows with `key`, `nullptr` if the key does not occur.
+   */
+  [[nodiscard]] func Find(const KeyType& key) const -> const BitsetType* {
+    const auto iterator{entries_.find(key)};
+    return iterator == entries_.end() ? nullptr : &iterator->second.bits;
+  }
+
+  /**
+   * @public
+   * @brief Returns the predicate "column equals `key`", matching nothing if the key does not occur.
+   */
+  [[nodiscard]] func Equal(const KeyType& key) const -> PredicateType {
+    const auto iterator{entries_.find(key)};
+    if (iterator == entries_.end()) {
+      return PredicateType{nullptr, rows_, 0};
+    }
+    return PredicateType{iterator->second.bits.Data(), rows_, iterator->second.count};
+  }
+
+  /**
+   * @public
+   * @brief Returns the predicate "column is one of `keys`".
+   *
+   * @throws std::invalid_argument If `keys` is empty.
+   */
+  [[nodiscard]] func In(std::initializer_list<KeyType> keys) const -> PredicateType {
+    if (!keys.size()) [[unlikely]] {
+      throw std::invalid_argument{"bits::BitmapIndex::In(std::initializer_list<KeyType>): no keys"};
+    }
+
+    PredicateType result{Equal(*keys.begin())};
+    for (auto key{keys.begin() + 1}; key != keys.end(); ++key) {
+      result = std::move(result) | Equal(*key);
+    }
+    return result;
+  }
+
+ private:
+  SizeType rows_{};
+  std::unordered_map<KeyType, Entry, Hash, KeyEqual> entries_;
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
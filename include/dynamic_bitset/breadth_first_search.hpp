@@ -0,0 +1,436 @@
+/**
+ * @file dynamic_bitset/breadth_first_search.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Direction-optimizing breadth-first search over `DynamicBitset` frontiers
+ * @defgroup breadth-first-search Breadth-first search
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+#include "execution.hpp"
+
+// Parallel backend (TBB) headers use `func` as an identifier, include them before the macro definition
+#include <algorithm>   /* std::for_each, std::min */
+#include <atomic>      /* std::atomic_ref */
+#include <bit>         /* std::countr_zero, std::popcount */
+#include <concepts>    /* std::unsigned_integral */
+#include <cstdint>     /* std::uint8_t, std::uint32_t */
+#include <execution>   /* std::execution::seq */
+#include <limits>      /* std::numeric_limits */
+#include <span>        /* std::span */
+#include <stdexcept>   /* std::invalid_argument, std::out_of_range */
+#include <type_traits> /* std::is_same_v, std::remove_cvref_t */
+#include <utility>     /* std::swap */
+#include <vector>      /* std::vector */
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+namespace bits {
+
+/**
+ * @brief Level-synchronous BFS keeping the current frontier, the next frontier and visited vertices as bitsets.
+ * @details Every `Step()` expands one level in one of two directions:
+ *          - top-down walks the edges of a sparse queue of frontier vertices and claims unvisited targets;
+ *          - bottom-up scans unvisited vertices (`~visited`, block by block) and stops at the first
+ *            neighbour found in the frontier bitset.
+ *
+ *          The search switches to bottom-up when the frontier touches more than `1 / kAlpha` of the
+ *          unexplored edges, and back to top-down once a shrinking frontier holds less than `1 / kBeta` of
+ *          the vertices. Execution policy overloads split both directions into chunks; parallel top-down
+ *          claims vertices with atomic `fetch_or`, bottom-up chunks own whole blocks and need no atomics.
+ *
+ *          The graph is given in CSR form and must be undirected, every edge stored in both directions,
+ *          because bottom-up looks for parents among the neighbours of a vertex. It must outlive the search.
+ * @ingroup breadth-first-search
+ *
+ * @tparam Vertex Unsigned integral type of vertex ids in the adjacency array.
+ * @tparam Block Unsigned integral type used for bit storage.
+ * @tparam Allocator Allocator of blocks.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * // Path 0 - 1 - 2
+ * std::vector<std::size_t> offsets{0, 1, 3, 4};
+ * std::vector<std::uint32_t> targets{1, 0, 2, 1};
+ * bits::BreadthFirstSearch<> bfs{offsets, targets};
+ * bfs.Reset(0);
+ * while (bfs.Step()) {
+ *   // bfs.Frontier() holds the vertices at distance bfs.Level()
+ * }
+ * auto reached{bfs.Visited().Count()}; // reached == 3
+ * @endcode
+ */
+template<
+  std::unsigned_integral Vertex = std::uint32_t,
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class BreadthFirstSearch {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using vertex_type = Vertex;
+  using VertexType = vertex_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using BitsetType = DynamicBitset<BlockType, Allocator>;
+
+  /**
+   * @brief Direction of the last expanded level.
+   */
+  enum class Direction : std::uint8_t { kTopDown, kBottomUp };
+
+  /**
+   * @brief Top-down switches to bottom-up once frontier edges exceed unexplored edges divided by `kAlpha`.
+   */
+  static constexpr SizeType kAlpha{14};
+
+  /**
+   * @brief Bottom-up switches to top-down once a shrinking frontier is smaller than vertices divided by `kBeta`.
+   */
+  static constexpr SizeType kBeta{24};
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kChunkBlocks{64};
+    static constexpr SizeType kChunkVertices{1024};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kBit{1};
+    static constexpr BlockType kSet{static_cast<BlockType>(-1)};
+  };
+
+  struct Chunk final {
+    std::vector<VertexType> vertices;
+    SizeType count{};
+    SizeType edges{};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Prepares a search over the CSR graph: neighbours of `v` are `targets[offsets[v]..offsets[v + 1])`.
+   *
+   * @throws std::invalid_argument If `offsets` is empty, `offsets.back() != targets.size()` or `Vertex`
+   *         cannot represent every vertex.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  BreadthFirstSearch(std::span<const SizeType> offsets, std::span<const VertexType> targets)
+    : offsets_{offsets},
+      targets_{targets},
+      vertices_{offsets.empty() ? 0 : offsets.size() - 1},
+      visited_(vertices_),
+      current_(vertices_),
+      next_(vertices_) {
+    if (offsets.empty() || offsets.back() != targets.size()) [[unlikely]] {
+      throw std::invalid_argument{
+        "bits::BreadthFirstSearch::BreadthFirstSearch(std::span<const SizeType>, std::span<const VertexType>): "
+        "invalid CSR graph"
+      };
+    }
+    if (vertices_ && vertices_ - 1 > std::numeric_limits<VertexType>::max()) [[unlikely]] {
+      throw std::invalid_argument{
+        "bits::BreadthFirstSearch::BreadthFirstSearch(std::span<const SizeType>, std::span<const VertexType>): "
+        "vertex type is too narrow"
+      };
+    }
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of vertices.
+   */
+  [[nodiscard]] func Vertices() const noexcept -> SizeType { return vertices_; }
+
+  /**
+   * @public
+   * @brief Returns the distance of the vertices in `Frontier()` from the source.
+   */
+  [[nodiscard]] func Level() const noexcept -> SizeType { return level_; }
+
+  /**
+   * @public
+   * @brief Returns the direction used by the last `Step()`.
+   */
+  [[nodiscard]] func LastDirection() const noexcept -> Direction { return last_direction_; }
+
+  /**
+   * @public
+   * @brief Returns the vertices discovered by the last `Step()`, the source after `Reset()`.
+   */
+  [[nodiscard]] func Frontier() const noexcept -> const BitsetType& { return current_; }
+
+  /**
+   * @public
+   * @brief Returns the number of vertices in `Frontier()`.
+   */
+  [[nodiscard]] func FrontierSize() const noexcept -> SizeType { return frontier_size_; }
+
+  /**
+   * @public
+   * @brief Returns all vertices discovered since `Reset()`.
+   */
+  [[nodiscard]] func Visited() const noexcept -> const BitsetType& { return visited_; }
+
+  /**
+   * @public
+   * @brief Returns the number of vertices in `Visited()`.
+   */
+  [[nodiscard]] func Reached() const noexcept -> SizeType { return reached_; }
+
+  /**
+   * @public
+   * @brief Starts a new search from `source`.
+   *
+   * @throws std::out_of_range If `source >= Vertices()`.
+   */
+  func Reset(VertexType source) -> void {
+    if (source >= vertices_) [[unlikely]] {
+      throw std::out_of_range{"bits::BreadthFirstSearch::Reset(VertexType): index is out of range"};
+    }
+
+    visited_.Reset();
+    current_.Reset();
+    visited_.Set(source, true);
+    current_.Set(source, true);
+    queue_.assign(1, source);
+    direction_ = last_direction_ = Direction::kTopDown;
+    growing_ = true;
+    level_ = 0;
+    reached_ = frontier_size_ = 1;
+    frontier_edges_ = Degree(source);
+    unexplored_edges_ = targets_.size() - frontier_edges_;
+  }
+
+  /**
+   * @public
+   * @brief Expands the next level sequentially.
+   * @return The number of vertices discovered, `0` once the search is complete.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func Step() -> SizeType { return Step(std::execution::seq); }
+
+  /**
+   * @public
+   * @brief Expands the next level using `policy`.
+   * @return The number of vertices discovered, `0` once the search is complete.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  template<__bits_details::IsExecutionPolicy Policy>
+  func Step(Policy&& policy) -> SizeType {
+    if (!frontier_size_) {
+      return 0;
+    }
+
+    const SizeType previous_size{frontier_size_};
+    if (direction_ == Direction::kTopDown) {
+      if (frontier_edges_ > unexplored_edges_ / kAlpha) {
+        direction_ = Direction::kBottomUp;
+      }
+    } else if (frontier_size_ < vertices_ / kBeta && !growing_) {
+      direction_ = Direction::kTopDown;
+      queue_.resize(frontier_size_);
+      static_cast<void>(current_.ToIndices(std::span<VertexType>{queue_}));
+    }
+
+    if (direction_ == Direction::kTopDown) {
+      TopDown(policy);
+    } else {
+      BottomUp(policy);
+    }
+
+    last_direction_ = direction_;
+    growing_ = frontier_size_ > previous_size;
+    reached_ += frontier_size_;
+    unexplored_edges_ -= frontier_edges_;
+    level_ += frontier_size_ ? 1 : 0;
+    return frontier_size_;
+  }
+
+  /**
+   * @public
+   * @brief Runs the whole search from `source` sequentially.
+   * @return The number of reached vertices.
+   *
+   * @throws std::out_of_range If `source >= Vertices()`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func Run(VertexType source) -> SizeType { return Run(std::execution::seq, source); }
+
+  /**
+   * @public
+   * @brief Runs the whole search from `source` using `policy`.
+   * @return The number of reached vertices.
+   *
+   * @throws std::out_of_range If `source >= Vertices()`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  template<__bits_details::IsExecutionPolicy Policy>
+  func Run(Policy&& policy, VertexType source) -> SizeType {
+    Reset(source);
+    while (Step(policy)) {
+    }
+    return reached_;
+  }
+
+ private:
+  [[nodiscard]] func Degree(SizeType vertex) const noexcept -> SizeType {
+    return offsets_[vertex + 1] - offsets_[vertex];
+  }
+
+  [[nodiscard]] static func Bit(SizeType vertex) noexcept -> BlockType {
+    return static_cast<BlockType>(BitMask::kBit << vertex % BlockInfo::kBitsCount);
+  }
+
+  // Claims the unvisited neighbours of the queued vertices, the frontier bitset is updated sparsely
+  template<typename Policy>
+  func TopDown(Policy& policy) -> void {
+    next_queue_.clear();
+    frontier_size_ = frontier_edges_ = 0;
+    BlockType* visited{visited_.Data()};
+
+    if constexpr (std::is_same_v<std::remove_cvref_t<Policy>, std::execution::sequenced_policy>) {
+      for (const VertexType vertex : queue_) {
+        for (SizeType edge{offsets_[vertex]}; edge < offsets_[vertex + 1]; ++edge) {
+          const VertexType target{targets_[edge]};
+          const BlockType bit{Bit(target)};
+          if (!(visited[target / BlockInfo::kBitsCount] & bit)) {
+            visited[target / BlockInfo::kBitsCount] |= bit;
+            next_queue_.push_back(target);
+            frontier_edges_ += Degree(target);
+          }
+        }
+      }
+    } else {
+      std::vector<Chunk> chunks((queue_.size() + BlockInfo::kChunkVertices - 1) / BlockInfo::kChunkVertices);
+      std::for_each(policy, chunks.begin(), chunks.end(), [&](Chunk& chunk) -> void {
+        const SizeType begin{static_cast<SizeType>(&chunk - chunks.data()) * BlockInfo::kChunkVertices};
+        const SizeType end{std::min(begin + BlockInfo::kChunkVertices, queue_.size())};
+        for (SizeType index{begin}; index < end; ++index) {
+          const VertexType vertex{queue_[index]};
+          for (SizeType edge{offsets_[vertex]}; edge < offsets_[vertex + 1]; ++edge) {
+            const VertexType target{targets_[edge]};
+            const BlockType bit{Bit(target)};
+            std::atomic_ref<BlockType> word{visited[target / BlockInfo::kBitsCount]};
+            if (word.load(std::memory_order_relaxed) & bit || word.fetch_or(bit, std::memory_order_relaxed) & bit) {
+              continue;
+            }
+            chunk.vertices.push_back(target);
+            chunk.edges += Degree(target);
+          }
+        }
+      });
+      for (const Chunk& chunk : chunks) {
+        next_queue_.insert(next_queue_.end(), chunk.vertices.begin(), chunk.vertices.end());
+        frontier_edges_ += chunk.edges;
+      }
+    }
+
+    for (const VertexType vertex : queue_) {
+      current_.Data()[vertex / BlockInfo::kBitsCount] &= static_cast<BlockType>(~Bit(vertex));
+    }
+    for (const VertexType vertex : next_queue_) {
+      current_.Data()[vertex / BlockInfo::kBitsCount] |= Bit(vertex);
+    }
+    frontier_size_ = next_queue_.size();
+    std::swap(queue_, next_queue_);
+  }
+
+  // Every unvisited vertex looks for a parent in the frontier, chunks own whole blocks of 'next_' and 'visited_'
+  template<typename Policy>
+  func BottomUp(Policy& policy) -> void {
+    const SizeType blocks{(vertices_ + BlockInfo::kBitsCount - 1) / BlockInfo::kBitsCount};
+    const BlockType* current{current_.Data()};
+    BlockType* visited{visited_.Data()};
+    BlockType* next{next_.Data()};
+
+    std::vector<Chunk> chunks((blocks + BlockInfo::kChunkBlocks - 1) / BlockInfo::kChunkBlocks);
+    std::for_each(policy, chunks.begin(), chunks.end(), [&](Chunk& chunk) noexcept -> void {
+      const SizeType begin{static_cast<SizeType>(&chunk - chunks.data()) * BlockInfo::kChunkBlocks};
+      const SizeType end{std::min(begin + BlockInfo::kChunkBlocks, blocks)};
+      for (SizeType block{begin}; block < end; ++block) {
+        const BlockType mask{block + 1 == blocks ? __bits_details::TailMask<BlockType>(vertices_) : BitMask::kSet};
+        BlockType found{};
+        for (auto unvisited{static_cast<BlockType>(~visited[block] & mask)}; unvisited; unvisited &= unvisited - 1) {
+          const SizeType vertex{block * BlockInfo::kBitsCount + static_cast<SizeType>(std::countr_zero(unvisited))};
+          for (SizeType edge{offsets_[vertex]}; edge < offsets_[vertex + 1]; ++edge) {
+            const VertexType parent{targets_[edge]};
+            if (current[parent / BlockInfo::kBitsCount] >> parent % BlockInfo::kBitsCount & 1) {
+              found |= static_cast<BlockType>(unvisited & -unvisited);
+              chunk.edges += Degree(vertex);
+              break;
+            }
+          }
+        }
+        next[block] = found;
+        visited[block] |= found;
+        chunk.count += static_cast<SizeType>(std::popcount(found));
+      }
+    });
+
+    frontier_size_ = frontier_edges_ = 0;
+    for (const Chunk& chunk : chunks) {
+      frontier_size_ += chunk.count;
+      frontier_edges_ += chunk.edges;
+    }
+    std::swap(current_, next_);
+  }
+
+  std::span<const SizeType> offsets_;
+  std::span<const VertexType> targets_;
+  SizeType vertices_;
+  BitsetType visited_;
+  BitsetType current_;
+  BitsetType next_;
+  std::vector<VertexType> queue_;
+  std::vector<VertexType> next_queue_;
+  Direction direction_{Direction::kTopDown};
+  Direction last_direction_{Direction::kTopDown};
+  bool growing_{true};
+  SizeType level_{};
+  SizeType reached_{};
+  SizeType frontier_size_{};
+  SizeType frontier_edges_{};
+  SizeType unexplored_edges_{};
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
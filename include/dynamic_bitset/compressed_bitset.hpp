@@ -0,0 +1,1349 @@
+/**
+ * @file dynamic_bitset/compressed_bitset.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Compressed bitmap with array, bitmap and run containers
+ * @defgroup compressed-bitset Compressed bitset
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::lower_bound, std::upper_bound, std::min, std::copy */
+#include <array>     /* std::array */
+#include <bit>       /* std::popcount, std::countr_zero, std::endian */
+#include <cstdint>   /* std::uint16_t, std::uint32_t, std::uint64_t */
+#include <cstring>   /* std::memcpy */
+#include <limits>    /* std::numeric_limits */
+#include <stdexcept> /* std::out_of_range, std::invalid_argument */
+#include <utility>   /* std::move */
+#include <vector>    /* std::vector */
+
+namespace __bits_details {
+
+/**
+ * @brief Applies `operation(word, mask)` to every word intersecting inclusive bit range `[first, last]`.
+ */
+template<typename Operation>
+constexpr func ApplyWordRange(std::uint64_t* words, std::size_t first, std::size_t last, Operation operation) noexcept
+  -> void {
+  const std::size_t first_word{first >> 6};
+  const std::size_t last_word{last >> 6};
+  const std::uint64_t first_mask{~std::uint64_t{} << (first & 63)};
+  const std::uint64_t last_mask{~std::uint64_t{} >> (63 - (last & 63))};
+
+  if (first_word == last_word) {
+    operation(words[first_word], first_mask & last_mask);
+    return;
+  }
+
+  operation(words[first_word], first_mask);
+  for (std::size_t word{first_word + 1}; word < last_word; ++word) {
+    operation(words[word], ~std::uint64_t{});
+  }
+  operation(words[last_word], last_mask);
+}
+
+}  // namespace __bits_details
+
+namespace bits {
+
+/**
+ * @brief Compressed set of bits split into 2^16-bit containers.
+ *
+ * @ingroup compressed-bitset
+ *
+ * @class CompressedBitset
+ *
+ * @details `CompressedBitset` keeps the `DynamicBitset` interface but stores only
+ *          non-empty 2^16-bit chunks. Every chunk is kept in the smallest of three
+ *          representations:
+ *          - sorted array of 16-bit offsets (up to 4096 set bits);
+ *          - plain bitmap of 1024 words;
+ *          - sorted list of inclusive runs `[first, last]`.
+ *
+ *          Bitwise operations work container by container and dispatch on the
+ *          representation pair, so sparse or run-heavy sets never expand to flat storage.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::DynamicBitset flat{1 << 20};
+ * flat.Set(10, true);
+ * bits::CompressedBitset compressed{flat};  // One array container with one value
+ * compressed.Set(1 << 19, true);
+ * auto restored{compressed.ToDynamicBitset()};
+ * @endcode
+ */
+class CompressedBitset {
+ public:
+  /**
+   * @public
+   * @brief An alias representing size type using snake case.
+   * @typedef size_type
+   */
+  using size_type = std::size_t;
+  /**
+   * @public
+   * @brief An alias representing size type using pascal case.
+   * @typedef SizeType
+   */
+  using SizeType = std::size_t;
+  /**
+   * @public
+   * @brief An alias representing logical value type using snake case.
+   * @typedef value_type
+   */
+  using value_type = bool;
+  /**
+   * @public
+   * @brief An alias representing logical value type using pascal case.
+   * @typedef ValueType
+   */
+  using ValueType = bool;
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Constants describing single container geometry.
+   *
+   * @struct ContainerInfo
+   */
+  struct ContainerInfo final {
+    /**
+     * @internal
+     * @brief Number of low bits addressed inside of a container.
+     */
+    static constexpr SizeType kKeyShift{16};
+    /**
+     * @internal
+     * @brief Number of bits covered by a container.
+     */
+    static constexpr SizeType kBitsCount{SizeType{1} << kKeyShift};
+    /**
+     * @internal
+     * @brief Mask extracting offset inside of a container.
+     */
+    static constexpr SizeType kOffsetMask{kBitsCount - 1};
+    /**
+     * @internal
+     * @brief Number of 64-bit words in bitmap representation.
+     */
+    static constexpr SizeType kWordsCount{kBitsCount / 64};
+    /**
+     * @internal
+     * @brief Maximum cardinality stored as an array (array and bitmap have equal size here).
+     */
+    static constexpr SizeType kArrayLimit{kWordsCount * sizeof(std::uint64_t) / sizeof(std::uint16_t)};
+  };
+
+  /**
+   * @internal
+   * @private
+   * @brief Buffer holding single container in bitmap form.
+   * @typedef Words
+   */
+  using Words = std::array<std::uint64_t, ContainerInfo::kWordsCount>;
+
+  /**
+   * @internal
+   * @private
+   * @brief Set of up to 2^16 bits in one of three representations.
+   *
+   * @class Container
+   */
+  class Container final {
+   public:
+    enum class Kind : std::uint8_t { kArray, kBitmap, kRun };
+
+    /**
+     * @internal
+     * @brief Inclusive range of set bits.
+     */
+    struct Run final {
+      std::uint16_t first;
+      std::uint16_t last;
+
+      constexpr func operator==(const Run& other) const noexcept -> bool = default;
+    };
+
+   public:
+    /**
+     * @internal
+     * @brief Builds container from bitmap words choosing the smallest representation.
+     */
+    [[nodiscard]] static func FromWords(const std::uint64_t* words) -> Container {
+      Container container;
+      container.AssignWords(words);
+      return container;
+    }
+
+    [[nodiscard]] constexpr func Cardinality() const noexcept -> SizeType { return cardinality_; }
+
+    /**
+     * @internal
+     * @brief Returns number of bytes owned by representation buffers.
+     */
+    [[nodiscard]] constexpr func Bytes() const noexcept -> SizeType {
+      return array_.capacity() * sizeof(std::uint16_t) + bitmap_.capacity() * sizeof(std::uint64_t) +
+             runs_.capacity() * sizeof(Run);
+    }
+
+    [[nodiscard]] constexpr func Contains(std::uint16_t value) const noexcept -> bool {
+      switch (kind_) {
+        case Kind::kArray:
+          return std::binary_search(array_.begin(), array_.end(), value);
+        case Kind::kBitmap:
+          return bitmap_[value >> 6] >> (value & 63) & 1;
+        case Kind::kRun: {
+          const SizeType run{RunUpperBound(value)};
+          return run && runs_[run - 1].last >= value;
+        }
+      }
+      return false;
+    }
+
+    /**
+     * @internal
+     * @brief Returns the first value not less than `offset` or `ContainerInfo::kBitsCount`.
+     */
+    [[nodiscard]] constexpr func FindFrom(SizeType offset) const noexcept -> SizeType {
+      switch (kind_) {
+        case Kind::kArray: {
+          const auto value{std::lower_bound(array_.begin(), array_.end(), offset)};
+          return value == array_.end() ? ContainerInfo::kBitsCount : *value;
+        }
+        case Kind::kBitmap:
+          return ScanWords(bitmap_.data(), offset, true);
+        case Kind::kRun: {
+          SizeType run{RunUpperBound(static_cast<std::uint16_t>(offset))};
+          if (run && runs_[run - 1].last >= offset) {
+            return offset;
+          }
+          return run == runs_.size() ? ContainerInfo::kBitsCount : runs_[run].first;
+        }
+      }
+      return ContainerInfo::kBitsCount;
+    }
+
+    constexpr func Add(std::uint16_t value) -> void {
+      switch (kind_) {
+        case Kind::kArray: {
+          const auto position{std::lower_bound(array_.begin(), array_.end(), value)};
+          if (position != array_.end() && *position == value) {
+            return;
+          }
+          if (array_.size() == ContainerInfo::kArrayLimit) {
+            ToBitmap();
+            Add(value);
+            return;
+          }
+          array_.insert(position, value);
+          ++cardinality_;
+          return;
+        }
+        case Kind::kBitmap: {
+          std::uint64_t& word{bitmap_[value >> 6]};
+          const std::uint64_t mask{std::uint64_t{1} << (value & 63)};
+          cardinality_ += !(word & mask);
+          word |= mask;
+          return;
+        }
+        case Kind::kRun:
+          AddToRuns(value);
+          return;
+      }
+    }
+
+    constexpr func Remove(std::uint16_t value) -> void {
+      switch (kind_) {
+        case Kind::kArray: {
+          const auto position{std::lower_bound(array_.begin(), array_.end(), value)};
+          if (position != array_.end() && *position == value) {
+            array_.erase(position);
+            --cardinality_;
+          }
+          return;
+        }
+        case Kind::kBitmap: {
+          std::uint64_t& word{bitmap_[value >> 6]};
+          const std::uint64_t mask{std::uint64_t{1} << (value & 63)};
+          if (word & mask) {
+            word &= ~mask;
+            if (--cardinality_ <= ContainerInfo::kArrayLimit) {
+              Optimize();
+            }
+          }
+          return;
+        }
+        case Kind::kRun:
+          RemoveFromRuns(value);
+          return;
+      }
+    }
+
+    /**
+     * @internal
+     * @brief Intersects container with `other` in place.
+     */
+    func And(const Container& other) -> void {
+      if (kind_ == Kind::kArray && other.kind_ == Kind::kArray) {
+        AssignArray(
+          array_.size() + other.array_.size() > kMergeLimit ? FilterArray<true>(array_, other)
+                                                            : MergeArrays<false, false, true>(array_, other.array_)
+        );
+      } else if (kind_ == Kind::kArray) {
+        AssignArray(FilterArray<true>(array_, other));
+      } else if (other.kind_ == Kind::kArray) {
+        AssignArray(FilterArray<true>(other.array_, *this));
+      } else if (kind_ == Kind::kRun && other.kind_ == Kind::kRun) {
+        std::vector<Run> result;
+        for (SizeType lhs{}, rhs{}; lhs < runs_.size() && rhs < other.runs_.size();) {
+          const auto first{std::max(runs_[lhs].first, other.runs_[rhs].first)};
+          const auto last{std::min(runs_[lhs].last, other.runs_[rhs].last)};
+          if (first <= last) {
+            result.push_back({first, last});
+          }
+          runs_[lhs].last < other.runs_[rhs].last ? ++lhs : ++rhs;
+        }
+        AssignRuns(std::move(result));
+      } else {
+        ToBitmap();
+        if (other.kind_ == Kind::kBitmap) {
+          for (SizeType word{}; word < ContainerInfo::kWordsCount; ++word) {
+            bitmap_[word] &= other.bitmap_[word];
+          }
+        } else {
+          // Clear the gaps between runs
+          SizeType next{};
+          for (const Run& run : other.runs_) {
+            if (run.first > next) {
+              __bits_details::ApplyWordRange(bitmap_.data(), next, run.first - 1U, ClearBits);
+            }
+            next = run.last + SizeType{1};
+          }
+          if (next < ContainerInfo::kBitsCount) {
+            __bits_details::ApplyWordRange(bitmap_.data(), next, ContainerInfo::kOffsetMask, ClearBits);
+          }
+        }
+        Optimize();
+      }
+    }
+
+    /**
+     * @internal
+     * @brief Unites container with `other` in place.
+     */
+    func Or(const Container& other) -> void {
+      if (kind_ == Kind::kArray && other.kind_ == Kind::kArray && array_.size() + other.array_.size() <= kUniteLimit) {
+        AssignArray(MergeArrays<true, true, true>(array_, other.array_));
+      } else if (kind_ == Kind::kArray && other.kind_ == Kind::kArray) {
+        UniteArrays(other, SetBits);
+      } else if (kind_ == Kind::kRun && other.kind_ == Kind::kRun) {
+        std::vector<Run> result;
+        result.reserve(runs_.size() + other.runs_.size());
+        for (SizeType lhs{}, rhs{}; lhs < runs_.size() || rhs < other.runs_.size();) {
+          const bool take_lhs{
+            rhs == other.runs_.size() || (lhs < runs_.size() && runs_[lhs].first < other.runs_[rhs].first)
+          };
+          const Run run{take_lhs ? runs_[lhs++] : other.runs_[rhs++]};
+          if (!result.empty() && SizeType{result.back().last} + 1 >= run.first) {
+            result.back().last = std::max(result.back().last, run.last);
+          } else {
+            result.push_back(run);
+          }
+        }
+        AssignRuns(std::move(result));
+      } else {
+        ApplyToBitmap(other, SetBits);
+      }
+    }
+
+    /**
+     * @internal
+     * @brief Computes symmetric difference with `other` in place.
+     */
+    func Xor(const Container& other) -> void {
+      if (kind_ == Kind::kArray && other.kind_ == Kind::kArray && array_.size() + other.array_.size() <= kUniteLimit) {
+        AssignArray(MergeArrays<true, true, false>(array_, other.array_));
+      } else if (kind_ == Kind::kArray && other.kind_ == Kind::kArray) {
+        UniteArrays(other, FlipBits);
+      } else {
+        ApplyToBitmap(other, FlipBits);
+      }
+    }
+
+    /**
+     * @internal
+     * @brief Removes values of `other` from container in place.
+     */
+    func AndNot(const Container& other) -> void {
+      if (kind_ == Kind::kArray && other.kind_ == Kind::kArray && array_.size() + other.array_.size() <= kMergeLimit) {
+        AssignArray(MergeArrays<true, false, false>(array_, other.array_));
+      } else if (kind_ == Kind::kArray) {
+        AssignArray(FilterArray<false>(array_, other));
+      } else {
+        ApplyToBitmap(other, ClearBits);
+      }
+    }
+
+    /**
+     * @internal
+     * @brief Returns bitmap words, materializing array and run containers in `buffer`.
+     */
+    [[nodiscard]] func ToWords(Words& buffer) const noexcept -> const std::uint64_t* {
+      if (kind_ == Kind::kBitmap) {
+        return bitmap_.data();
+      }
+
+      buffer.fill(0);
+      if (kind_ == Kind::kArray) {
+        for (const std::uint16_t value : array_) {
+          buffer[value >> 6] |= std::uint64_t{1} << (value & 63);
+        }
+      } else {
+        for (const Run& run : runs_) {
+          __bits_details::ApplyWordRange(buffer.data(), run.first, run.last, SetBits);
+        }
+      }
+      return buffer.data();
+    }
+
+    /**
+     * @internal
+     * @brief Converts container to the smallest representation and releases unused memory.
+     */
+    func Optimize() -> void {
+      Words buffer;
+      AssignWords(ToWords(buffer));
+    }
+
+    [[nodiscard]] func operator==(const Container& other) const noexcept -> bool {
+      if (cardinality_ != other.cardinality_) {
+        return false;
+      }
+      if (kind_ == other.kind_) {
+        return array_ == other.array_ && bitmap_ == other.bitmap_ && runs_ == other.runs_;
+      }
+
+      Words lhs_buffer;
+      Words rhs_buffer;
+      const std::uint64_t* lhs{ToWords(lhs_buffer)};
+      const std::uint64_t* rhs{other.ToWords(rhs_buffer)};
+      return std::equal(lhs, lhs + ContainerInfo::kWordsCount, rhs);
+    }
+
+   private:
+    /**
+     * @internal
+     * @brief Combined size of two arrays below which a plain merge beats the scratch bitmap.
+     */
+    static constexpr SizeType kMergeLimit{64};
+    /**
+     * @internal
+     * @brief Combined size of two arrays below which a plain merge beats decoding a scratch bitmap.
+     */
+    static constexpr SizeType kUniteLimit{512};
+
+    static constexpr func SetBits(std::uint64_t& word, std::uint64_t mask) noexcept -> void { word |= mask; }
+    static constexpr func ClearBits(std::uint64_t& word, std::uint64_t mask) noexcept -> void { word &= ~mask; }
+    static constexpr func FlipBits(std::uint64_t& word, std::uint64_t mask) noexcept -> void { word ^= mask; }
+
+    /**
+     * @internal
+     * @brief Returns index of the first run starting after `value`.
+     */
+    [[nodiscard]] constexpr func RunUpperBound(std::uint16_t value) const noexcept -> SizeType {
+      return static_cast<SizeType>(
+        std::upper_bound(
+          runs_.begin(), runs_.end(), value, [](std::uint16_t key, const Run& run) noexcept -> bool { return key < run.first; }
+        ) -
+        runs_.begin()
+      );
+    }
+
+    /**
+     * @internal
+     * @brief Returns the first offset not less than `offset` with bit equal to `value` or `ContainerInfo::kBitsCount`.
+     */
+    [[nodiscard]] static constexpr func ScanWords(const std::uint64_t* words, SizeType offset, bool value) noexcept
+      -> SizeType {
+      const std::uint64_t invert{value ? std::uint64_t{} : ~std::uint64_t{}};
+      SizeType word{offset >> 6};
+      std::uint64_t bits{(words[word] ^ invert) & ~std::uint64_t{} << (offset & 63)};
+      while (!bits) {
+        if (++word == ContainerInfo::kWordsCount) {
+          return ContainerInfo::kBitsCount;
+        }
+        bits = words[word] ^ invert;
+      }
+      return (word << 6) + std::countr_zero(bits);
+    }
+
+    /**
+     * @internal
+     * @brief Replaces content with bitmap `words` stored in the smallest representation.
+     * @note `words` may point to the own bitmap storage.
+     */
+    func AssignWords(const std::uint64_t* words) -> void {
+      // Separate loops without carried state vectorize into wide popcounts
+      SizeType cardinality{};
+      for (SizeType word{}; word < ContainerInfo::kWordsCount; ++word) {
+        cardinality += std::popcount(words[word]);
+      }
+      SizeType runs{static_cast<SizeType>(std::popcount(words[0] & ~(words[0] << 1)))};
+      for (SizeType word{1}; word < ContainerInfo::kWordsCount; ++word) {
+        runs += std::popcount(words[word] & ~(words[word] << 1 | words[word - 1] >> 63));
+      }
+
+      std::vector<std::uint16_t> array;
+      std::vector<Run> run_list;
+      if (runs * sizeof(Run) < std::min(cardinality * sizeof(std::uint16_t), sizeof(Words))) {
+        run_list.reserve(runs);
+        for (SizeType first{ScanWords(words, 0, true)}; first < ContainerInfo::kBitsCount;) {
+          const SizeType last{ScanWords(words, first, false) - 1};
+          run_list.push_back({static_cast<std::uint16_t>(first), static_cast<std::uint16_t>(last)});
+          first = last < ContainerInfo::kOffsetMask ? ScanWords(words, last + 1, true) : ContainerInfo::kBitsCount;
+        }
+        kind_ = Kind::kRun;
+        bitmap_ = std::vector<std::uint64_t>{};
+      } else if (cardinality <= ContainerInfo::kArrayLimit) {
+        array.resize(cardinality);
+        std::uint16_t* out{array.data()};
+        for (SizeType word{}; word < ContainerInfo::kWordsCount; ++word) {
+          for (std::uint64_t bits{words[word]}; bits; bits &= bits - 1) {
+            *out++ = static_cast<std::uint16_t>((word << 6) + std::countr_zero(bits));
+          }
+        }
+        kind_ = Kind::kArray;
+        bitmap_ = std::vector<std::uint64_t>{};
+      } else {
+        if (words != bitmap_.data()) {
+          bitmap_.assign(words, words + ContainerInfo::kWordsCount);
+        }
+        kind_ = Kind::kBitmap;
+      }
+
+      array_ = std::move(array);
+      runs_ = std::move(run_list);
+      cardinality_ = static_cast<std::uint32_t>(cardinality);
+    }
+
+    /**
+     * @internal
+     * @brief Branchless merge of sorted arrays.
+     * @details Keeps values present only in `lhs`, only in `rhs` and in both
+     *          according to template flags (AND, OR, XOR and AND NOT are covered).
+     */
+    template<bool KeepLhs, bool KeepRhs, bool KeepBoth>
+    [[nodiscard]] static func MergeArrays(const std::vector<std::uint16_t>& lhs, const std::vector<std::uint16_t>& rhs)
+      -> std::vector<std::uint16_t> {
+      SizeType limit{KeepLhs ? lhs.size() : std::min(lhs.size(), rhs.size())};
+      if constexpr (KeepRhs) {
+        limit = lhs.size() + rhs.size();
+      }
+
+      std::vector<std::uint16_t> result(limit);
+      std::uint16_t* out{result.data()};
+      SizeType lhs_index{};
+      SizeType rhs_index{};
+      while (lhs_index < lhs.size() && rhs_index < rhs.size()) {
+        const std::uint16_t lhs_value{lhs[lhs_index]};
+        const std::uint16_t rhs_value{rhs[rhs_index]};
+        *out = std::min(lhs_value, rhs_value);
+        out += (KeepLhs && lhs_value < rhs_value) || (KeepRhs && rhs_value < lhs_value) ||
+               (KeepBoth && lhs_value == rhs_value);
+        lhs_index += lhs_value <= rhs_value;
+        rhs_index += rhs_value <= lhs_value;
+      }
+      if constexpr (KeepLhs) {
+        out = std::copy(lhs.begin() + static_cast<std::ptrdiff_t>(lhs_index), lhs.end(), out);
+      }
+      if constexpr (KeepRhs) {
+        out = std::copy(rhs.begin() + static_cast<std::ptrdiff_t>(rhs_index), rhs.end(), out);
+      }
+
+      result.resize(static_cast<SizeType>(out - result.data()));
+      return result;
+    }
+
+    /**
+     * @internal
+     * @brief Keeps values of `values` that are (`Contained == true`) or are not present in `other`.
+     * @details Array `other` is marked in a scratch bitmap first, so every
+     *          membership test is a single independent load instead of a search.
+     */
+    template<bool Contained>
+    [[nodiscard]] static func FilterArray(const std::vector<std::uint16_t>& values, const Container& other)
+      -> std::vector<std::uint16_t> {
+      if (other.kind_ != Kind::kArray) {
+        return FilterArray<Contained>(values, [&other](std::uint16_t value) noexcept -> bool {
+          return other.Contains(value);
+        });
+      }
+
+      Words scratch;
+      scratch.fill(0);
+      for (const std::uint16_t value : other.array_) {
+        scratch[value >> 6] |= std::uint64_t{1} << (value & 63);
+      }
+      return FilterArray<Contained>(values, [&scratch](std::uint16_t value) noexcept -> bool {
+        return scratch[value >> 6] >> (value & 63) & 1;
+      });
+    }
+
+    template<bool Contained, typename Predicate>
+    [[nodiscard]] static func FilterArray(const std::vector<std::uint16_t>& values, Predicate contains)
+      -> std::vector<std::uint16_t> {
+      std::vector<std::uint16_t> result(values.size());
+      std::uint16_t* out{result.data()};
+      for (const std::uint16_t value : values) {
+        *out = value;
+        out += contains(value) == Contained;
+      }
+
+      result.resize(static_cast<SizeType>(out - result.data()));
+      return result;
+    }
+
+    func ToBitmap() -> void {
+      if (kind_ == Kind::kBitmap) {
+        return;
+      }
+
+      Words buffer;
+      const std::uint64_t* words{ToWords(buffer)};
+      bitmap_.assign(words, words + ContainerInfo::kWordsCount);
+      array_ = std::vector<std::uint16_t>{};
+      runs_ = std::vector<Run>{};
+      kind_ = Kind::kBitmap;
+    }
+
+    func AssignArray(std::vector<std::uint16_t>&& values) -> void {
+      array_ = std::move(values);
+      cardinality_ = static_cast<std::uint32_t>(array_.size());
+      kind_ = Kind::kArray;
+      bitmap_ = std::vector<std::uint64_t>{};
+      runs_ = std::vector<Run>{};
+      if (array_.size() > ContainerInfo::kArrayLimit) {
+        Optimize();
+      } else if (array_.capacity() > 2 * array_.size()) {
+        array_.shrink_to_fit();
+      }
+    }
+
+    func AssignRuns(std::vector<Run>&& runs) -> void {
+      runs_ = std::move(runs);
+      kind_ = Kind::kRun;
+      cardinality_ = 0;
+      for (const Run& run : runs_) {
+        cardinality_ += run.last - run.first + 1U;
+      }
+      if (runs_.size() * sizeof(Run) >= std::min<SizeType>(cardinality_ * sizeof(std::uint16_t), sizeof(Words))) {
+        Optimize();
+      }
+    }
+
+    /**
+     * @internal
+     * @brief Applies bitwise `operation` with `other` on bitmap form of the container.
+     */
+    template<typename Operation>
+    func ApplyToBitmap(const Container& other, Operation operation) -> void {
+      ToBitmap();
+      switch (other.kind_) {
+        case Kind::kArray:
+          for (const std::uint16_t value : other.array_) {
+            operation(bitmap_[value >> 6], std::uint64_t{1} << (value & 63));
+          }
+          break;
+        case Kind::kBitmap:
+          for (SizeType word{}; word < ContainerInfo::kWordsCount; ++word) {
+            operation(bitmap_[word], other.bitmap_[word]);
+          }
+          break;
+        case Kind::kRun:
+          for (const Run& run : other.runs_) {
+            __bits_details::ApplyWordRange(bitmap_.data(), run.first, run.last, operation);
+          }
+          break;
+      }
+      Optimize();
+    }
+
+    /**
+     * @internal
+     * @brief Combines two arrays in a scratch bitmap and decodes the sorted result.
+     */
+    template<typename Operation>
+    func UniteArrays(const Container& other, Operation operation) -> void {
+      Words scratch;
+      scratch.fill(0);
+      for (const std::uint16_t value : array_) {
+        scratch[value >> 6] |= std::uint64_t{1} << (value & 63);
+      }
+      for (const std::uint16_t value : other.array_) {
+        operation(scratch[value >> 6], std::uint64_t{1} << (value & 63));
+      }
+      AssignWords(scratch.data());
+    }
+
+    func AddToRuns(std::uint16_t value) -> void {
+      const SizeType next{RunUpperBound(value)};
+      if (next && runs_[next - 1].last >= value) {
+        return;
+      }
+
+      const bool extends_previous{next && runs_[next - 1].last + 1U == value};
+      const bool extends_next{next < runs_.size() && runs_[next].first == value + 1U};
+      if (extends_previous && extends_next) {
+        runs_[next - 1].last = runs_[next].last;
+        runs_.erase(runs_.begin() + static_cast<std::ptrdiff_t>(next));
+      } else if (extends_previous) {
+        runs_[next - 1].last = value;
+      } else if (extends_next) {
+        runs_[next].first = value;
+      } else {
+        runs_.insert(runs_.begin() + static_cast<std::ptrdiff_t>(next), Run{value, value});
+      }
+      ++cardinality_;
+    }
+
+    func RemoveFromRuns(std::uint16_t value) -> void {
+      const SizeType next{RunUpperBound(value)};
+      if (!next || runs_[next - 1].last < value) {
+        return;
+      }
+
+      Run& run{runs_[next - 1]};
+      if (run.first == run.last) {
+        runs_.erase(runs_.begin() + static_cast<std::ptrdiff_t>(next - 1));
+      } else if (run.first == value) {
+        ++run.first;
+      } else if (run.last == value) {
+        --run.last;
+      } else {
+        const Run tail{static_cast<std::uint16_t>(value + 1U), run.last};
+        run.last = static_cast<std::uint16_t>(value - 1U);
+        runs_.insert(runs_.begin() + static_cast<std::ptrdiff_t>(next), tail);
+      }
+      --cardinality_;
+    }
+
+   private:
+    Kind kind_{Kind::kArray};
+    std::uint32_t cardinality_{};
+    std::vector<std::uint16_t> array_;
+    std::vector<std::uint64_t> bitmap_;
+    std::vector<Run> runs_;
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs empty `CompressedBitset`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  CompressedBitset() noexcept = default;
+
+  /**
+   * @public
+   * @brief Constructs `CompressedBitset` with `bits` unset bits.
+   * @details No memory is allocated until the first bit is set.
+   *
+   * @param[in] bits Number of bits.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  explicit CompressedBitset(SizeType bits) noexcept : bits_{bits} { }
+
+  /**
+   * @public
+   * @brief Compresses the content of `DynamicBitset`.
+   * @details Each 2^16-bit chunk is loaded as words once and stored in the smallest
+   *          representation; chunks without set bits are skipped.
+   *
+   * @tparam Block Unsigned integral type used for bit storage of `bits`.
+   * @tparam Allocator Allocator type of `bits`.
+   * @param[in] bits Source `DynamicBitset` object.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset flat{1 << 20, 0b1011};
+   * bits::CompressedBitset compressed{flat}; // Size() == 1 << 20, Count() == 3
+   * @endcode
+   */
+  template<typename Block, typename Allocator>
+  explicit CompressedBitset(const DynamicBitset<Block, Allocator>& bits) : bits_{bits.Size()} {
+    static_assert(std::numeric_limits<Block>::digits <= 64, "Block must not be wider than 64 bits");
+
+    constexpr SizeType kBlockBits{std::numeric_limits<Block>::digits};
+    constexpr SizeType kBlocksPerContainer{ContainerInfo::kBitsCount / kBlockBits};
+    const SizeType blocks{(bits_ + kBlockBits - 1) / kBlockBits};
+    const Block* data{bits.Data()};
+    Words words;
+
+    for (SizeType key{}; key << ContainerInfo::kKeyShift < bits_; ++key) {
+      const SizeType first_block{key * kBlocksPerContainer};
+      const SizeType block_count{std::min(kBlocksPerContainer, blocks - first_block)};
+
+      words.fill(0);
+      if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(words.data(), data + first_block, block_count * sizeof(Block));
+      } else {
+        for (SizeType block{}; block < block_count; ++block) {
+          words[block * kBlockBits >> 6] |= std::uint64_t{data[first_block + block]} << (block * kBlockBits & 63);
+        }
+      }
+
+      // Drop unused bits of the last block
+      const SizeType bits_in_container{bits_ - (key << ContainerInfo::kKeyShift)};
+      if (bits_in_container < ContainerInfo::kBitsCount) {
+        __bits_details::ApplyWordRange(
+          words.data(),
+          bits_in_container,
+          ContainerInfo::kOffsetMask,
+          [](std::uint64_t& word, std::uint64_t mask) noexcept -> void { word &= ~mask; }
+        );
+      }
+
+      Container container{Container::FromWords(words.data())};
+      if (container.Cardinality()) {
+        keys_.push_back(key);
+        containers_.push_back(std::move(container));
+      }
+    }
+  }
+
+  /**
+   * @public
+   * @brief Decompresses the content into a new `DynamicBitset`.
+   *
+   * @tparam Block Unsigned integral type used for bit storage of the result.
+   * @tparam Allocator Allocator type of the result.
+   * @param[in] allocator Allocator used by the result.
+   * @return `DynamicBitset` with `Size()` bits equal to the content of `this` object.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::CompressedBitset compressed{100};
+   * compressed.Set(42, true);
+   * auto flat{compressed.ToDynamicBitset<unsigned char>()}; // flat.Size() == 100, flat.Test(42) == true
+   * @endcode
+   */
+  template<typename Block = std::size_t, typename Allocator = std::allocator<Block>>
+  [[nodiscard]] func ToDynamicBitset(const Allocator& allocator = Allocator{}) const -> DynamicBitset<Block, Allocator> {
+    static_assert(std::numeric_limits<Block>::digits <= 64, "Block must not be wider than 64 bits");
+
+    constexpr SizeType kBlockBits{std::numeric_limits<Block>::digits};
+    constexpr SizeType kBlocksPerContainer{ContainerInfo::kBitsCount / kBlockBits};
+    DynamicBitset<Block, Allocator> bits(bits_, 0, allocator);
+    if (!bits_) {
+      return bits;
+    }
+
+    const SizeType blocks{(bits_ + kBlockBits - 1) / kBlockBits};
+    Block* data{bits.Data()};
+    Words buffer;
+
+    for (SizeType index{}; index < keys_.size(); ++index) {
+      const SizeType first_block{keys_[index] * kBlocksPerContainer};
+      const SizeType block_count{std::min(kBlocksPerContainer, blocks - first_block)};
+      const std::uint64_t* words{containers_[index].ToWords(buffer)};
+
+      if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(data + first_block, words, block_count * sizeof(Block));
+      } else {
+        for (SizeType block{}; block < block_count; ++block) {
+          data[first_block + block] = static_cast<Block>(words[block * kBlockBits >> 6] >> (block * kBlockBits & 63));
+        }
+      }
+    }
+
+    return bits;
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of bits.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Size() const noexcept -> SizeType { return bits_; }
+
+  /**
+   * @public
+   * @brief Checks if the `CompressedBitset` has no bits (`Size() == 0`).
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Empty() const noexcept -> bool { return !bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of set bits.
+   * @note Complexity: O(c), where c is the number of non-empty containers.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Count() const noexcept -> SizeType {
+    SizeType count{};
+    for (const Container& container : containers_) {
+      count += container.Cardinality();
+    }
+    return count;
+  }
+
+  /**
+   * @public
+   * @brief Checks if any bit is set.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Any() const noexcept -> bool { return !containers_.empty(); }
+
+  /**
+   * @public
+   * @brief Checks if none of the bits is set.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func None() const noexcept -> bool { return containers_.empty(); }
+
+  /**
+   * @public
+   * @brief Checks if all bits are set. Returns `false` for empty object like `DynamicBitset::All()`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func All() const noexcept -> bool { return bits_ && Count() == bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of bytes owned by the object including its containers.
+   * @details Used to compare memory footprint with flat `DynamicBitset` storage.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func MemoryUsage() const noexcept -> SizeType {
+    SizeType bytes{sizeof(*this) + keys_.capacity() * sizeof(SizeType) + containers_.capacity() * sizeof(Container)};
+    for (const Container& container : containers_) {
+      bytes += container.Bytes();
+    }
+    return bytes;
+  }
+
+  /**
+   * @public
+   * @brief Returns the value of bit with `index`.
+   * @note Complexity: O(log c + log k), where c is the number of containers and
+   *       k is the size of the container representation.
+   *
+   * @param[in] index The zero-based index of the bit.
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if `index >= Size()`.
+   */
+  [[nodiscard]] func Test(SizeType index) const noexcept -> bool {
+    BITS_DYNAMIC_BITSET_ASSERT(index < bits_);
+
+    const SizeType position{FindContainer(index >> ContainerInfo::kKeyShift)};
+    return position < keys_.size() && keys_[position] == index >> ContainerInfo::kKeyShift &&
+           containers_[position].Contains(static_cast<std::uint16_t>(index & ContainerInfo::kOffsetMask));
+  }
+
+  /**
+   * @public
+   * @brief Set the bit with `index` to `value`. Implies range check.
+   *
+   * @param[in] index The zero-based index of the bit to set/unset.
+   * @param[in] value The boolean value `true/false`.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func Set(SizeType index, bool value = false) -> CompressedBitset& {
+    if (index >= bits_) {
+      throw std::out_of_range{"bits::CompressedBitset::Set(SizeType, bool = false): index is out of range"};
+    }
+
+    if (!value) {
+      ResetBit(index);
+      return *this;
+    }
+
+    const SizeType key{index >> ContainerInfo::kKeyShift};
+    const SizeType position{FindContainer(key)};
+    if (position == keys_.size() || keys_[position] != key) {
+      keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(position), key);
+      containers_.insert(containers_.begin() + static_cast<std::ptrdiff_t>(position), Container{});
+    }
+    containers_[position].Add(static_cast<std::uint16_t>(index & ContainerInfo::kOffsetMask));
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Set bit with `index` to `false`. Implies range checking.
+   *
+   * @param[in] index The zero-based index of the bit to reset.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func Reset(SizeType index) -> CompressedBitset& {
+    if (index >= bits_) {
+      throw std::out_of_range{"bits::CompressedBitset::Reset(SizeType): index is out of range"};
+    }
+
+    ResetBit(index);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Set all bits to `false` keeping `Size()` and releases container memory.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  func Reset() noexcept -> CompressedBitset& {
+    keys_ = std::vector<SizeType>{};
+    containers_ = std::vector<Container>{};
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Removes all bits and releases memory (`Size() == 0`).
+   *
+   * @throws None (no-throw guarantee).
+   */
+  func Clear() noexcept -> void {
+    Reset();
+    bits_ = 0;
+  }
+
+  /**
+   * @public
+   * @brief Converts every container to its smallest representation and releases unused memory.
+   * @details Point updates keep the current representation of a container, so long
+   *          series of `Set()`/`Reset()` calls may leave it suboptimal.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func ShrinkToFit() -> void {
+    for (Container& container : containers_) {
+      container.Optimize();
+    }
+    keys_.shrink_to_fit();
+    containers_.shrink_to_fit();
+  }
+
+  /**
+   * @public
+   * @brief Returns the index of the first set bit or `Size()` if there is no such bit.
+   * @see DynamicBitset::FindFirst()
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func FindFirst() const noexcept -> SizeType { return FindFrom(0); }
+
+  /**
+   * @public
+   * @brief Returns the index of the first set bit after `index` or `Size()` if there is no such bit.
+   * @details Empty 2^16-bit chunks are not stored, so they are skipped without scanning.
+   * @see DynamicBitset::FindNext()
+   *
+   * @param[in] index The zero-based index of the bit to start search after.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func FindNext(SizeType index) const noexcept -> SizeType {
+    return index + 1 < bits_ ? FindFrom(index + 1) : bits_;
+  }
+
+  /**
+   * @public
+   * @brief Performs bitwise AND operation on all bits.
+   * @details Containers present only in one operand are dropped without being read.
+   *
+   * @param[in] other Another `CompressedBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func operator&=(const CompressedBitset& other) -> CompressedBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::CompressedBitset::operator&=(): invalid storage size"};
+    }
+
+    Merge(other, false, false, [](Container& lhs, const Container& rhs) -> void { lhs.And(rhs); });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Performs bitwise OR operation on all bits.
+   *
+   * @param[in] other Another `CompressedBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func operator|=(const CompressedBitset& other) -> CompressedBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::CompressedBitset::operator|=(): invalid storage size"};
+    }
+
+    Merge(other, true, true, [](Container& lhs, const Container& rhs) -> void { lhs.Or(rhs); });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Performs bitwise XOR operation on all bits.
+   *
+   * @param[in] other Another `CompressedBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func operator^=(const CompressedBitset& other) -> CompressedBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::CompressedBitset::operator^=(): invalid storage size"};
+    }
+
+    Merge(other, true, true, [](Container& lhs, const Container& rhs) -> void { lhs.Xor(rhs); });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Clears all bits that are set in `other` (`this & ~other`).
+   *
+   * @param[in] other Another `CompressedBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::CompressedBitset a{8};
+   * bits::CompressedBitset b{8};
+   * a.Set(1, true).Set(2, true);
+   * b.Set(2, true);
+   * a.AndNot(b); // Only bit 1 remains set
+   * @endcode
+   */
+  func AndNot(const CompressedBitset& other) -> CompressedBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::CompressedBitset::AndNot(const CompressedBitset&): invalid storage size"};
+    }
+
+    Merge(other, true, false, [](Container& lhs, const Container& rhs) -> void { lhs.AndNot(rhs); });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Checks if two objects have equal size and equal set bits regardless of representation.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func operator==(const CompressedBitset& other) const noexcept -> bool {
+    return bits_ == other.bits_ && keys_ == other.keys_ && containers_ == other.containers_;
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Returns position of the first container with key not less than `key`.
+   */
+  [[nodiscard]] func FindContainer(SizeType key) const noexcept -> SizeType {
+    return static_cast<SizeType>(std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin());
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns the index of the first set bit in `[index, Size())` or `Size()`.
+   */
+  [[nodiscard]] func FindFrom(SizeType index) const noexcept -> SizeType {
+    const SizeType key{index >> ContainerInfo::kKeyShift};
+    SizeType position{FindContainer(key)};
+
+    if (position < keys_.size() && keys_[position] == key) {
+      const SizeType offset{containers_[position].FindFrom(index & ContainerInfo::kOffsetMask)};
+      if (offset < ContainerInfo::kBitsCount) {
+        return (key << ContainerInfo::kKeyShift) + offset;
+      }
+      ++position;
+    }
+
+    // Stored containers are never empty
+    return position < keys_.size() ? (keys_[position] << ContainerInfo::kKeyShift) + containers_[position].FindFrom(0)
+                                   : bits_;
+  }
+
+  func ResetBit(SizeType index) -> void {
+    const SizeType key{index >> ContainerInfo::kKeyShift};
+    const SizeType position{FindContainer(key)};
+    if (position == keys_.size() || keys_[position] != key) {
+      return;
+    }
+
+    containers_[position].Remove(static_cast<std::uint16_t>(index & ContainerInfo::kOffsetMask));
+    if (!containers_[position].Cardinality()) {
+      keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(position));
+      containers_.erase(containers_.begin() + static_cast<std::ptrdiff_t>(position));
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Merges container lists by key applying `operation` to containers present in both.
+   *
+   * @param[in] other Right hand side operand.
+   * @param[in] keep_lhs Keep containers present only in `this` object.
+   * @param[in] keep_rhs Copy containers present only in `other` object.
+   * @param[in] operation Container operation, result may become empty.
+   */
+  template<typename Operation>
+  func Merge(const CompressedBitset& other, bool keep_lhs, bool keep_rhs, Operation operation) -> void {
+    std::vector<SizeType> keys;
+    std::vector<Container> containers;
+    keys.reserve(keep_rhs ? keys_.size() + other.keys_.size() : keys_.size());
+    containers.reserve(keys.capacity());
+
+    SizeType lhs{};
+    SizeType rhs{};
+    while (lhs < keys_.size() || rhs < other.keys_.size()) {
+      if (rhs == other.keys_.size() || (lhs < keys_.size() && keys_[lhs] < other.keys_[rhs])) {
+        if (keep_lhs) {
+          keys.push_back(keys_[lhs]);
+          containers.push_back(std::move(containers_[lhs]));
+        }
+        ++lhs;
+      } else if (lhs == keys_.size() || other.keys_[rhs] < keys_[lhs]) {
+        if (keep_rhs) {
+          keys.push_back(other.keys_[rhs]);
+          containers.push_back(other.containers_[rhs]);
+        }
+        ++rhs;
+      } else {
+        operation(containers_[lhs], other.containers_[rhs]);
+        if (containers_[lhs].Cardinality()) {
+          keys.push_back(keys_[lhs]);
+          containers.push_back(std::move(containers_[lhs]));
+        }
+        ++lhs;
+        ++rhs;
+      }
+    }
+
+    keys_ = std::move(keys);
+    containers_ = std::move(containers);
+  }
+
+ private:
+  SizeType bits_{};
+  std::vector<SizeType> keys_;
+  std::vector<Container> containers_;
+};
+
+}  // namespace bits
+
+/**
+ * @brief Performs a bitwise AND between two `CompressedBitset` objects.
+ * @see bits::CompressedBitset::operator&=
+ * @ingroup compressed-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails (std::allocator).
+ */
+[[nodiscard]] inline func operator&(const bits::CompressedBitset& lhs, const bits::CompressedBitset& rhs)
+  -> bits::CompressedBitset {
+  auto bits{lhs};
+  bits &= rhs;
+  return bits;
+}
+
+/**
+ * @brief Performs a bitwise OR between two `CompressedBitset` objects.
+ * @see bits::CompressedBitset::operator|=
+ * @ingroup compressed-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails (std::allocator).
+ */
+[[nodiscard]] inline func operator|(const bits::CompressedBitset& lhs, const bits::CompressedBitset& rhs)
+  -> bits::CompressedBitset {
+  auto bits{lhs};
+  bits |= rhs;
+  return bits;
+}
+
+/**
+ * @brief Performs a bitwise XOR between two `CompressedBitset` objects.
+ * @see bits::CompressedBitset::operator^=
+ * @ingroup compressed-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails (std::allocator).
+ */
+[[nodiscard]] inline func operator^(const bits::CompressedBitset& lhs, const bits::CompressedBitset& rhs)
+  -> bits::CompressedBitset {
+  auto bits{lhs};
+  bits ^= rhs;
+  return bits;
+}
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
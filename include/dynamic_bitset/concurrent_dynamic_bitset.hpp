@@ -0,0 +1,477 @@
+/**
+ * @file dynamic_bitset/concurrent_dynamic_bitset.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Growing bitset made of independently allocated atomic shards
+ * @defgroup concurrent-dynamic-bitset Concurrent dynamic bitset
+ */
+
+#pragma once
+
+#include "atomic_dynamic_bitset.hpp"
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::min */
+#include <array>     /* std::array */
+#include <atomic>    /* std::atomic, std::memory_order */
+#include <bit>       /* std::bit_width, std::has_single_bit */
+#include <limits>    /* std::numeric_limits */
+#include <memory>    /* std::unique_ptr, std::make_unique */
+#include <stdexcept> /* std::invalid_argument, std::out_of_range */
+#include <utility>   /* std::pair */
+
+namespace bits {
+
+/**
+ * @brief Bitset which grows while several threads set bits in it.
+ * @details Bits are stored in fixed size shards (`AtomicDynamicBitset`) allocated on first write.
+ *          Shards are found through a directory of geometrically growing segments, so growth
+ *          never moves existing shards and no operation takes a lock: readers and writers of
+ *          allocated shards only touch atomic words, a new shard or segment is published with
+ *          a single compare-exchange.
+ *          Writing a bit past `Size()` grows the set, bits past `Size()` read as `false`.
+ *          Whole-set operations (`Count()`, `Snapshot()`, `Reset()`) are not atomic as a whole.
+ * @ingroup concurrent-dynamic-bitset
+ *
+ * @tparam Block Unsigned integral type used for bit storage.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::ConcurrentDynamicBitset<> seen;
+ * // From any ingestion thread
+ * seen.Set(document_id);
+ * // Later
+ * auto flat{seen.Snapshot()}; // bits::DynamicBitset<>
+ * @endcode
+ */
+template<__bits_details::IsValidDynamicBitsetBlockType Block = size_t>
+class ConcurrentDynamicBitset {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using value_type = bool;
+  using ValueType = value_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using shard_type = AtomicDynamicBitset<BlockType>;
+  using ShardType = shard_type;
+
+  /**
+   * @brief Default number of bits in one shard (8 KiB of storage).
+   */
+  static constexpr SizeType kDefaultShardBits{SizeType{1} << 16};
+
+ private:
+  using Slot = std::atomic<ShardType*>;
+
+  /**
+   * @internal
+   * @private
+   * @brief Segment `k` of the directory holds `2^k` shard slots.
+   */
+  static constexpr SizeType kSegmentsCount{std::numeric_limits<SizeType>::digits};
+
+ public:
+  /**
+   * @public
+   * @brief Constructs `ConcurrentDynamicBitset` with `bits` unset bits.
+   * @details No storage is allocated until the first bit is set.
+   *
+   * @param[in] bits Initial number of bits.
+   * @param[in] shard_bits Number of bits in one shard, power of two not less than block width.
+   *
+   * @throws std::invalid_argument If `shard_bits` is not a power of two or less than block width.
+   */
+  explicit ConcurrentDynamicBitset(SizeType bits = 0, SizeType shard_bits = kDefaultShardBits)
+    : shard_bits_{shard_bits}, shard_shift_{static_cast<SizeType>(std::bit_width(shard_bits) - 1)}, bits_{bits} {
+    if (!std::has_single_bit(shard_bits) || shard_bits < std::numeric_limits<BlockType>::digits) {
+      throw std::invalid_argument{
+        "bits::ConcurrentDynamicBitset::ConcurrentDynamicBitset(SizeType, SizeType): invalid shard size"
+      };
+    }
+  }
+
+  ConcurrentDynamicBitset(const ConcurrentDynamicBitset&) = delete;
+  func operator=(const ConcurrentDynamicBitset&)->ConcurrentDynamicBitset& = delete;
+
+  /**
+   * @public
+   * @brief Releases all shards.
+   *
+   * @warning No thread may access the object concurrently.
+   */
+  ~ConcurrentDynamicBitset() {
+    for (SizeType segment{}; segment < kSegmentsCount; ++segment) {
+      Slot* slots{segments_[segment].load(std::memory_order_acquire)};
+      if (!slots) {
+        continue;
+      }
+      for (SizeType slot{}; slot < SizeType{1} << segment; ++slot) {
+        delete slots[slot].load(std::memory_order_relaxed);
+      }
+      delete[] slots;
+    }
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of bits.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Size() const noexcept -> SizeType { return bits_.load(std::memory_order_acquire); }
+
+  /**
+   * @public
+   * @brief Checks if the `ConcurrentDynamicBitset` has no bits (`Size() == 0`).
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Empty() const noexcept -> bool { return !Size(); }
+
+  /**
+   * @public
+   * @brief Returns the number of bits in one shard.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func ShardBits() const noexcept -> SizeType { return shard_bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of allocated shards.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func NumShards() const noexcept -> SizeType { return shards_.load(std::memory_order_relaxed); }
+
+  /**
+   * @public
+   * @brief Returns the number of bytes allocated for shards and directory segments.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func MemoryUsage() const noexcept -> SizeType {
+    SizeType bytes{sizeof(*this)};
+    for (SizeType segment{}; segment < kSegmentsCount; ++segment) {
+      if (segments_[segment].load(std::memory_order_relaxed)) {
+        bytes += sizeof(Slot) << segment;
+      }
+    }
+    return bytes + NumShards() * (sizeof(ShardType) + (shard_bits_ >> 3));
+  }
+
+  /**
+   * @public
+   * @brief Returns the value of bit with `index`, `false` if `index >= Size()`.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the load.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Test(SizeType index, std::memory_order order = std::memory_order_acquire) const noexcept -> bool {
+    const ShardType* shard{FindShard(index >> shard_shift_)};
+    return shard && shard->Test(index & (shard_bits_ - 1), order);
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `true` and returns its previous value.
+   * @details Grows the set to `index + 1` bits if needed.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the read-modify-write operation.
+   * @return Previous value of the bit.
+   *
+   * @throws std::bad_alloc If shard allocation fails.
+   */
+  func TestAndSet(SizeType index, std::memory_order order = std::memory_order_acq_rel) -> bool {
+    Grow(index + 1);
+    return GetShard(index >> shard_shift_).TestAndSet(index & (shard_bits_ - 1), order);
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `true`.
+   * @details Grows the set to `index + 1` bits if needed.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the read-modify-write operation.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::bad_alloc If shard allocation fails.
+   */
+  func Set(SizeType index, std::memory_order order = std::memory_order_release) -> ConcurrentDynamicBitset& {
+    Grow(index + 1);
+    GetShard(index >> shard_shift_).Set(index & (shard_bits_ - 1), order);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `false` and returns its previous value.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the read-modify-write operation.
+   * @return Previous value of the bit.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func TestAndReset(SizeType index, std::memory_order order = std::memory_order_acq_rel) -> bool {
+    if (index >= Size()) [[unlikely]] {
+      throw std::out_of_range{
+        "bits::ConcurrentDynamicBitset::TestAndReset(SizeType, std::memory_order): index is out of range"
+      };
+    }
+
+    ShardType* shard{FindShard(index >> shard_shift_)};
+    return shard && shard->TestAndReset(index & (shard_bits_ - 1), order);
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `false`.
+   * @details Unallocated shards hold unset bits and stay unallocated.
+   *
+   * @param[in] index The zero-based index of the bit.
+   * @param[in] order Memory order of the read-modify-write operation.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func Reset(SizeType index, std::memory_order order = std::memory_order_release) -> ConcurrentDynamicBitset& {
+    if (index >= Size()) [[unlikely]] {
+      throw std::out_of_range{
+        "bits::ConcurrentDynamicBitset::Reset(SizeType, std::memory_order): index is out of range"
+      };
+    }
+
+    if (ShardType* shard{FindShard(index >> shard_shift_)}; shard) {
+      shard->Reset(index & (shard_bits_ - 1), order);
+    }
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Appends a bit and returns its index.
+   * @details Every concurrent call gets its own index.
+   *
+   * @param[in] value The value of the new bit.
+   * @return Index of the appended bit.
+   *
+   * @throws std::bad_alloc If shard allocation fails.
+   */
+  func PushBack(bool value) -> SizeType {
+    const SizeType index{bits_.fetch_add(1, std::memory_order_acq_rel)};
+    if (value) {
+      GetShard(index >> shard_shift_).Set(index & (shard_bits_ - 1));
+    }
+    return index;
+  }
+
+  /**
+   * @public
+   * @brief Grows the set to `bits` unset bits, smaller sizes are ignored.
+   * @details No storage is allocated.
+   *
+   * @param[in] bits New number of bits.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  func Resize(SizeType bits) noexcept -> void { Grow(bits); }
+
+  /**
+   * @public
+   * @brief Sets all bits to `false` with relaxed stores, keeps shards allocated.
+   * @note Not atomic as a whole, concurrent updates of the bits may survive.
+   *
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  func Reset() noexcept -> ConcurrentDynamicBitset& {
+    ForEachShard([](SizeType, ShardType& shard) noexcept -> void { shard.Reset(); });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of set bits.
+   * @note Not atomic as a whole, every block is loaded once with relaxed order.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Count() const noexcept -> SizeType {
+    SizeType count{};
+    ForEachShard([&count](SizeType, const ShardType& shard) noexcept -> void { count += shard.Count(); });
+    return count;
+  }
+
+  /**
+   * @public
+   * @brief Copies the bits into a plain `DynamicBitset`.
+   * @details Size is loaded first, bits of allocated shards are loaded with acquire order.
+   *          The result contains every update which happened before the call and may
+   *          contain any subset of concurrent updates.
+   *
+   * @tparam Allocator Allocator type of the result.
+   * @param[in] allocator Allocator used by the result.
+   * @return `DynamicBitset` with `Size()` bits.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  template<typename Allocator = std::allocator<BlockType>>
+  [[nodiscard]] func Snapshot(const Allocator& allocator = Allocator{}) const -> DynamicBitset<BlockType, Allocator> {
+    const SizeType bits{Size()};
+    DynamicBitset<BlockType, Allocator> result(bits, 0, allocator);
+    if (!bits) {
+      return result;
+    }
+
+    // Blocks of unallocated shards stay zero
+    const SizeType shard_blocks{shard_bits_ / std::numeric_limits<BlockType>::digits};
+    ForEachShard([&](SizeType shard_index, const ShardType& shard) noexcept -> void {
+      const SizeType first_block{shard_index * shard_blocks};
+      if (first_block < result.NumBlocks()) {
+        shard.LoadBlocks(result.Data() + first_block, std::min(shard_blocks, result.NumBlocks() - first_block));
+      }
+    });
+
+    // Bits set concurrently past the loaded size
+    if (const SizeType remaining_bits{bits % std::numeric_limits<BlockType>::digits}; remaining_bits) {
+      const auto tail_mask{static_cast<BlockType>(~(static_cast<BlockType>(-1) << remaining_bits))};
+      result.Data()[result.NumBlocks() - 1] &= tail_mask;
+    }
+    return result;
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Returns directory segment and slot offset of the shard.
+   */
+  [[nodiscard]] static constexpr func Locate(SizeType shard_index) noexcept -> std::pair<SizeType, SizeType> {
+    const SizeType slot_index{shard_index + 1};
+    const auto segment{static_cast<SizeType>(std::bit_width(slot_index) - 1)};
+    return {segment, slot_index - (SizeType{1} << segment)};
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns allocated shard or `nullptr`.
+   */
+  [[nodiscard]] func FindShard(SizeType shard_index) const noexcept -> ShardType* {
+    const auto [segment, offset]{Locate(shard_index)};
+    const Slot* slots{segments_[segment].load(std::memory_order_acquire)};
+    return slots ? slots[offset].load(std::memory_order_acquire) : nullptr;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns the shard, allocates the shard and its directory segment on first access.
+   * @details Threads racing on the allocation publish with compare-exchange, losers free their copy.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func GetShard(SizeType shard_index) -> ShardType& {
+    const auto [segment, offset]{Locate(shard_index)};
+    Slot* slots{segments_[segment].load(std::memory_order_acquire)};
+    if (!slots) [[unlikely]] {
+      auto fresh{std::make_unique<Slot[]>(SizeType{1} << segment)};
+      if (segments_[segment].compare_exchange_strong(slots, fresh.get(), std::memory_order_acq_rel)) {
+        slots = fresh.release();
+      }
+    }
+
+    ShardType* shard{slots[offset].load(std::memory_order_acquire)};
+    if (!shard) [[unlikely]] {
+      auto fresh{std::make_unique<ShardType>(shard_bits_)};
+      if (slots[offset].compare_exchange_strong(shard, fresh.get(), std::memory_order_acq_rel)) {
+        shard = fresh.release();
+        shards_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    return *shard;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Grows `Size()` to at least `bits`.
+   */
+  func Grow(SizeType bits) noexcept -> void {
+    SizeType current{bits_.load(std::memory_order_relaxed)};
+    while (current < bits && !bits_.compare_exchange_weak(current, bits, std::memory_order_acq_rel)) {
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Calls `function(shard_index, shard)` for every allocated shard.
+   */
+  template<typename Function>
+  func ForEachShard(Function function) const -> void {
+    for (SizeType segment{}; segment < kSegmentsCount; ++segment) {
+      const Slot* slots{segments_[segment].load(std::memory_order_acquire)};
+      if (!slots) {
+        continue;
+      }
+      for (SizeType offset{}; offset < SizeType{1} << segment; ++offset) {
+        if (ShardType* shard{slots[offset].load(std::memory_order_acquire)}; shard) {
+          function((SizeType{1} << segment) + offset - 1, *shard);
+        }
+      }
+    }
+  }
+
+ private:
+  std::array<std::atomic<Slot*>, kSegmentsCount> segments_{};
+  std::atomic<SizeType> shards_{};
+  SizeType shard_bits_;
+  SizeType shard_shift_;
+  std::atomic<SizeType> bits_;
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
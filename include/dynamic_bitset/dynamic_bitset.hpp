@@ -110,17 +110,28 @@
 
 #include <algorithm>   /* std::copy, std::fill */
 #include <array>       /* std::array */
+#include <atomic>      /* std::atomic */
 #include <bit>         /* std::popcount */
+#include <charconv>    /* std::to_chars */
 #include <climits>     /* CHAR_BIT */
 #include <concepts>    /* std::unsigned_integral */
 #include <cstdint>     /* std::size_t, std::ptrdiff_t */
+#include <cstring>     /* std::memcpy */
 #include <format>      /* std::format */
 #include <iterator>    /* iterator_traits, Iterator concepts */
+#include <limits>      /* std::numeric_limits */
 #include <memory>      /* std::allocator<T> */
+#include <span>        /* std::span */
 #include <stdexcept>   /* std::out_of_range, std::length_error, std::invalid_argument */
+#include <string>      /* std::string */
 #include <string_view> /* std::string_view */
+#include <type_traits> /* std::is_constant_evaluated */
 #include <utility>     /* std::exchange */
 
+#if defined(__SSSE3__) || defined(__AVX2__) || defined(__AVX512BW__)
+  #include <immintrin.h> /* x86 SIMD intrinsics */
+#endif
+
 #if CHAR_BIT != 8
   #error "bits::DynamicBitset only works on platforms with 8 bits per byte."
 #endif
@@ -166,265 +177,342 @@ template<typename BlockIterator, typename TargetBlock>
 concept IsValidDynamicBitsetBlockIterator =
   std::is_convertible_v<decltype(*std::declval<BlockIterator>()), TargetBlock>;
 
-constexpr std::array<std::string_view, 256> kStrBytesMapping{
-  "00000000"
-  "00000001"
-  "00000010"
-  "00000011"
-  "00000100"
-  "00000101"
-  "00000110"
-  "00000111"
-  "00001000"
-  "00001001"
-  "00001010"
-  "00001011"
-  "00001100"
-  "00001101"
-  "00001110"
-  "00001111"
-  "00010000"
-  "00010001"
-  "00010010"
-  "00010011"
-  "00010100"
-  "00010101"
-  "00010110"
-  "00010111"
-  "00011000"
-  "00011001"
-  "00011010"
-  "00011011"
-  "00011100"
-  "00011101"
-  "00011110"
-  "00011111"
-  "00100000"
-  "00100001"
-  "00100010"
-  "00100011"
-  "00100100"
-  "00100101"
-  "00100110"
-  "00100111"
-  "00101000"
-  "00101001"
-  "00101010"
-  "00101011"
-  "00101100"
-  "00101101"
-  "00101110"
-  "00101111"
-  "00110000"
-  "00110001"
-  "00110010"
-  "00110011"
-  "00110100"
-  "00110101"
-  "00110110"
-  "00110111"
-  "00111000"
-  "00111001"
-  "00111010"
-  "00111011"
-  "00111100"
-  "00111101"
-  "00111110"
-  "00111111"
-  "01000000"
-  "01000001"
-  "01000010"
-  "01000011"
-  "01000100"
-  "01000101"
-  "01000110"
-  "01000111"
-  "01001000"
-  "01001001"
-  "01001010"
-  "01001011"
-  "01001100"
-  "01001101"
-  "01001110"
-  "01001111"
-  "01010000"
-  "01010001"
-  "01010010"
-  "01010011"
-  "01010100"
-  "01010101"
-  "01010110"
-  "01010111"
-  "01011000"
-  "01011001"
-  "01011010"
-  "01011011"
-  "01011100"
-  "01011101"
-  "01011110"
-  "01011111"
-  "01100000"
-  "01100001"
-  "01100010"
-  "01100011"
-  "01100100"
-  "01100101"
-  "01100110"
-  "01100111"
-  "01101000"
-  "01101001"
-  "01101010"
-  "01101011"
-  "01101100"
-  "01101101"
-  "01101110"
-  "01101111"
-  "01110000"
-  "01110001"
-  "01110010"
-  "01110011"
-  "01110100"
-  "01110101"
-  "01110110"
-  "01110111"
-  "01111000"
-  "01111001"
-  "01111010"
-  "01111011"
-  "01111100"
-  "01111101"
-  "01111110"
-  "01111111"
-  "10000000"
-  "10000001"
-  "10000010"
-  "10000011"
-  "10000100"
-  "10000101"
-  "10000110"
-  "10000111"
-  "10001000"
-  "10001001"
-  "10001010"
-  "10001011"
-  "10001100"
-  "10001101"
-  "10001110"
-  "10001111"
-  "10010000"
-  "10010001"
-  "10010010"
-  "10010011"
-  "10010100"
-  "10010101"
-  "10010110"
-  "10010111"
-  "10011000"
-  "10011001"
-  "10011010"
-  "10011011"
-  "10011100"
-  "10011101"
-  "10011110"
-  "10011111"
-  "10100000"
-  "10100001"
-  "10100010"
-  "10100011"
-  "10100100"
-  "10100101"
-  "10100110"
-  "10100111"
-  "10101000"
-  "10101001"
-  "10101010"
-  "10101011"
-  "10101100"
-  "10101101"
-  "10101110"
-  "10101111"
-  "10110000"
-  "10110001"
-  "10110010"
-  "10110011"
-  "10110100"
-  "10110101"
-  "10110110"
-  "10110111"
-  "10111000"
-  "10111001"
-  "10111010"
-  "10111011"
-  "10111100"
-  "10111101"
-  "10111110"
-  "10111111"
-  "11000000"
-  "11000001"
-  "11000010"
-  "11000011"
-  "11000100"
-  "11000101"
-  "11000110"
-  "11000111"
-  "11001000"
-  "11001001"
-  "11001010"
-  "11001011"
-  "11001100"
-  "11001101"
-  "11001110"
-  "11001111"
-  "11010000"
-  "11010001"
-  "11010010"
-  "11010011"
-  "11010100"
-  "11010101"
-  "11010110"
-  "11010111"
-  "11011000"
-  "11011001"
-  "11011010"
-  "11011011"
-  "11011100"
-  "11011101"
-  "11011110"
-  "11011111"
-  "11100000"
-  "11100001"
-  "11100010"
-  "11100011"
-  "11100100"
-  "11100101"
-  "11100110"
-  "11100111"
-  "11101000"
-  "11101001"
-  "11101010"
-  "11101011"
-  "11101100"
-  "11101101"
-  "11101110"
-  "11101111"
-  "11110000"
-  "11110001"
-  "11110010"
-  "11110011"
-  "11110100"
-  "11110101"
-  "11110110"
-  "11110111"
-  "11111000"
-  "11111001"
-  "11111010"
-  "11111011"
-  "11111100"
-  "11111101"
-  "11111110"
-  "11111111"
+/**
+ * @brief Lowercase hexadecimal digits indexed by nibble value.
+ */
+constexpr std::string_view kHexDigits{"0123456789abcdef"};
+
+/**
+ * @brief Expands packed bytes into ASCII '0'/'1' characters.
+ * @details Writes `bytes_count * 8` characters to `out` in LSB -> MSB order
+ *          for every byte. Uses the widest available x86 SIMD extension
+ *          (AVX-512BW: 64 chars, AVX2: 32 chars, SSSE3: 16 chars per step)
+ *          and finishes with a SWAR broadcast+compare producing 8 chars per byte.
+ *
+ * @param[in] bytes Pointer to the first byte to expand.
+ * @param[in] bytes_count Number of bytes to expand.
+ * @param[out] out Destination buffer with room for `bytes_count * 8` characters.
+ */
+inline func ExpandBitsToChars(const unsigned char* bytes, std::size_t bytes_count, char* out) noexcept -> void {
+#if defined(__AVX512BW__)
+  for (; bytes_count >= sizeof(std::uint64_t); bytes_count -= sizeof(std::uint64_t)) {
+    std::uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    _mm512_storeu_si512(out, _mm512_mask_blend_epi8(word, _mm512_set1_epi8('0'), _mm512_set1_epi8('1')));
+    bytes += sizeof(std::uint64_t);
+    out += std::numeric_limits<std::uint64_t>::digits;
+  }
+#endif
+#if defined(__AVX2__)
+  {
+    const __m256i broadcast{_mm256_setr_epi8(
+      0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3
+    )};
+    const __m256i select{_mm256_set1_epi64x(static_cast<long long>(0x80'40'20'10'08'04'02'01ULL))};
+    for (; bytes_count >= sizeof(std::uint32_t); bytes_count -= sizeof(std::uint32_t)) {
+      std::uint32_t word;
+      std::memcpy(&word, bytes, sizeof(word));
+      __m256i chars{_mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(word)), broadcast)};
+      chars = _mm256_cmpeq_epi8(_mm256_and_si256(chars, select), select);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_sub_epi8(_mm256_set1_epi8('0'), chars));
+      bytes += sizeof(std::uint32_t);
+      out += std::numeric_limits<std::uint32_t>::digits;
+    }
+  }
+#endif
+#if defined(__SSSE3__)
+  {
+    const __m128i broadcast{_mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1)};
+    const __m128i select{_mm_set1_epi64x(static_cast<long long>(0x80'40'20'10'08'04'02'01ULL))};
+    for (; bytes_count >= sizeof(std::uint16_t); bytes_count -= sizeof(std::uint16_t)) {
+      std::uint16_t word;
+      std::memcpy(&word, bytes, sizeof(word));
+      __m128i chars{_mm_shuffle_epi8(_mm_set1_epi16(static_cast<short>(word)), broadcast)};
+      chars = _mm_cmpeq_epi8(_mm_and_si128(chars, select), select);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_sub_epi8(_mm_set1_epi8('0'), chars));
+      bytes += sizeof(std::uint16_t);
+      out += std::numeric_limits<std::uint16_t>::digits;
+    }
+  }
+#endif
+  for (; bytes_count; --bytes_count) {
+    // Broadcast the byte to all 8 lanes, keep bit `i` in lane `i` and turn non-zero lanes into 0x01
+    std::uint64_t chars{(*bytes++ * 0x01'01'01'01'01'01'01'01ULL) & 0x80'40'20'10'08'04'02'01ULL};
+    chars = ((chars + 0x7f'7f'7f'7f'7f'7f'7f'7fULL) & 0x80'80'80'80'80'80'80'80ULL) >> 7 | 0x30'30'30'30'30'30'30'30ULL;
+    std::memcpy(out, &chars, sizeof(chars));
+    out += std::numeric_limits<unsigned char>::digits;
+  }
+}
+
+/**
+ * @brief Expands packed bytes into lowercase hexadecimal digits.
+ * @details Writes `bytes_count * 2` characters to `out`, low nibble first,
+ *          so that digit `k` encodes bits `[4k, 4k + 4)`. Uses SSSE3 shuffle
+ *          lookup (32 chars per step) when available and SWAR for the rest.
+ *
+ * @param[in] bytes Pointer to the first byte to expand.
+ * @param[in] bytes_count Number of bytes to expand.
+ * @param[out] out Destination buffer with room for `bytes_count * 2` characters.
+ */
+inline func ExpandNibblesToHex(const unsigned char* bytes, std::size_t bytes_count, char* out) noexcept -> void {
+#if defined(__SSSE3__)
+  {
+    const __m128i digits{_mm_loadu_si128(reinterpret_cast<const __m128i*>(kHexDigits.data()))};
+    const __m128i nibble_mask{_mm_set1_epi8(0x0f)};
+    for (; bytes_count >= sizeof(__m128i); bytes_count -= sizeof(__m128i)) {
+      const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes))};
+      const __m128i low{_mm_and_si128(block, nibble_mask)};
+      const __m128i high{_mm_and_si128(_mm_srli_epi16(block, 4), nibble_mask)};
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(digits, _mm_unpacklo_epi8(low, high)));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + 1, _mm_shuffle_epi8(digits, _mm_unpackhi_epi8(low, high)));
+      bytes += sizeof(__m128i);
+      out += sizeof(__m128i) << 1;
+    }
+  }
+#endif
+  for (; bytes_count >= sizeof(std::uint32_t); bytes_count -= sizeof(std::uint32_t)) {
+    std::uint32_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    // Spread every nibble into its own byte (low nibble first) and map [0, 15] -> "0-9a-f"
+    std::uint64_t nibbles{word};
+    nibbles = (nibbles | nibbles << 16) & 0x00'00'ff'ff'00'00'ff'ffULL;
+    nibbles = (nibbles | nibbles << 8) & 0x00'ff'00'ff'00'ff'00'ffULL;
+    nibbles = (nibbles | nibbles << 4) & 0x0f'0f'0f'0f'0f'0f'0f'0fULL;
+    const std::uint64_t letters{((nibbles + 0x76'76'76'76'76'76'76'76ULL) & 0x80'80'80'80'80'80'80'80ULL) >> 7};
+    const std::uint64_t chars{nibbles + 0x30'30'30'30'30'30'30'30ULL + letters * ('a' - '0' - 10)};
+    std::memcpy(out, &chars, sizeof(chars));
+    bytes += sizeof(std::uint32_t);
+    out += sizeof(std::uint32_t) << 1;
+  }
+  for (; bytes_count; --bytes_count, ++bytes) {
+    *out++ = kHexDigits[*bytes & 0x0f];
+    *out++ = kHexDigits[*bytes >> 4];
+  }
+}
+
+/**
+ * @brief Hexadecimal character to nibble value mapping (`0xff` for invalid characters).
+ */
+constexpr auto kHexDigitValues{[] consteval {
+  std::array<unsigned char, 256> values{};
+  values.fill(0xff);
+  for (unsigned char digit{}; digit < 16; ++digit) {
+    values[static_cast<unsigned char>(kHexDigits[digit])] = digit;
+    values[static_cast<unsigned char>("0123456789ABCDEF"[digit])] = digit;
+  }
+  return values;
+}()};
+
+/**
+ * @brief Packs hexadecimal digits (either case) into bytes, low nibble first.
+ * @details Inverse operation for `ExpandNibblesToHex`. Odd trailing digit is
+ *          stored in the low nibble of the last byte.
+ *
+ * @param[in] hex Hexadecimal digits to pack.
+ * @param[out] out Destination buffer with room for `ceil(hex.size() / 2)` bytes.
+ *
+ * @throws std::invalid_argument If `hex` contains non-hexadecimal character.
+ */
+inline func PackHexToNibbles(std::string_view hex, unsigned char* out) -> void {
+  const auto* digits{reinterpret_cast<const unsigned char*>(hex.data())};
+  const std::size_t pairs{hex.size() >> 1};
+  unsigned char invalid{};
+
+  for (std::size_t pair{}; pair < pairs; ++pair) {
+    const unsigned char low{kHexDigitValues[digits[pair << 1]]};
+    const unsigned char high{kHexDigitValues[digits[(pair << 1) + 1]]};
+    invalid |= low | high;
+    out[pair] = static_cast<unsigned char>(low | high << 4);
+  }
+  if (hex.size() & 1) {
+    out[pairs] = kHexDigitValues[digits[hex.size() - 1]];
+    invalid |= out[pairs];
+  }
+
+  // Valid nibbles never set bits above the lowest four
+  if (invalid & 0xf0) {
+    throw std::invalid_argument{"bits::DynamicBitset::FromHexString(std::string_view): invalid hexadecimal digit"};
+  }
+}
+
+}  // namespace __bits_details
+
+namespace bits {
+
+/**
+ * @brief Interface for running whole-bitset operations on several threads.
+ * @details `DynamicBitset` splits large storage into cache line aligned chunks
+ *          and hands them to the installed executor as independent tasks.
+ *          Implement it to plug an existing thread pool, or use `bits::ThreadPoolExecutor`
+ *          from `dynamic_bitset/thread_pool.hpp`.
+ * @see SetParallelExecutor()
+ */
+class ParallelExecutor {
+ public:
+  /**
+   * @brief Task entry point, called once for every task index in `[0, tasks)`.
+   */
+  using TaskType = void (*)(void* context, std::size_t task) noexcept;
+
+  virtual ~ParallelExecutor() = default;
+
+  /**
+   * @brief Returns the number of threads which run tasks simultaneously.
+   */
+  [[nodiscard]] virtual func Concurrency() const noexcept -> std::size_t = 0;
+
+  /**
+   * @brief Runs `task(context, index)` for every index in `[0, tasks)` and returns when all of them finished.
+   * @details Tasks are independent and may run in any order on any thread, including the calling one.
+   *          Must be safe to call from several threads and from inside a running task.
+   */
+  virtual func Run(std::size_t tasks, TaskType task, void* context) noexcept -> void = 0;
 };
 
+/**
+ * @brief Default storage size in bytes from which whole-bitset operations run in parallel.
+ */
+inline constexpr std::size_t kDefaultParallelThreshold{std::size_t{1} << 24};
+
+}  // namespace bits
+
+namespace __bits_details {
+
+/**
+ * @brief Executor used by whole-bitset operations, `nullptr` keeps them sequential.
+ */
+inline std::atomic<bits::ParallelExecutor*> g_parallel_executor{};
+
+/**
+ * @brief Storage size in bytes from which the installed executor is used.
+ */
+inline std::atomic<std::size_t> g_parallel_threshold{bits::kDefaultParallelThreshold};
+
+/**
+ * @brief Cache line size used for chunk boundaries.
+ */
+constexpr std::size_t kCacheLineSize{64};
+
+/**
+ * @brief Returns mask of the bits in use in the last block of `bits` bits.
+ */
+template<typename Block>
+[[nodiscard]] constexpr func TailMask(std::size_t bits) noexcept -> Block {
+  const std::size_t remaining_bits{bits % std::numeric_limits<Block>::digits};
+  return remaining_bits ? static_cast<Block>(~(static_cast<Block>(-1) << remaining_bits)) : static_cast<Block>(-1);
+}
+
+/**
+ * @brief Writes indices of set bits of blocks `[begin, end)` to `out` in increasing order.
+ * @details Bits past `bits` in the last block are skipped. With AVX-512F and 32 or 64 bit indices
+ *          every 16 or 8 bits of a block are decoded by one VPCOMPRESS store, otherwise set bits
+ *          are extracted one by one with `std::countr_zero`.
+ *
+ * @param[in] data Pointer to the first block of the bitset.
+ * @param[in] begin First block to decode.
+ * @param[in] end Block after the last one to decode.
+ * @param[in] bits Number of bits in the bitset.
+ * @param[out] out Destination with room for all set bits of the range.
+ * @return Pointer past the last written index.
+ */
+template<typename Index, typename Block>
+constexpr func DecodeSetBits(
+  const Block* data, std::size_t begin, std::size_t end, std::size_t bits, Index* out
+) noexcept -> Index* {
+  constexpr std::size_t kBitsCount{std::numeric_limits<Block>::digits};
+  const std::size_t last_block{(bits - 1) / kBitsCount};
+  for (std::size_t block{begin}; block < end; ++block) {
+    auto word{static_cast<Block>(data[block] & (block == last_block ? TailMask<Block>(bits) : static_cast<Block>(-1)))};
+    if (!word) {
+      continue;
+    }
+    const std::size_t base{block * kBitsCount};
+#if defined(__AVX512F__)
+    if !consteval {
+      if constexpr (sizeof(Index) == sizeof(std::uint32_t)) {
+        const __m512i lanes{_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)};
+        for (std::size_t offset{}; offset < kBitsCount; offset += 16) {
+          if (const auto mask{static_cast<__mmask16>(word >> offset)}; mask) {
+            const __m512i indices{_mm512_add_epi32(lanes, _mm512_set1_epi32(static_cast<int>(base + offset)))};
+            _mm512_mask_compressstoreu_epi32(out, mask, indices);
+            out += std::popcount(mask);
+          }
+        }
+        continue;
+      } else if constexpr (sizeof(Index) == sizeof(std::uint64_t)) {
+        const __m512i lanes{_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7)};
+        for (std::size_t offset{}; offset < kBitsCount; offset += 8) {
+          if (const auto mask{static_cast<__mmask8>(word >> offset)}; mask) {
+            const __m512i indices{_mm512_add_epi64(lanes, _mm512_set1_epi64(static_cast<long long>(base + offset)))};
+            _mm512_mask_compressstoreu_epi64(out, mask, indices);
+            out += std::popcount(mask);
+          }
+        }
+        continue;
+      }
+    }
+#endif
+    for (; word; word &= static_cast<Block>(word - 1)) {
+      *out++ = static_cast<Index>(base + static_cast<std::size_t>(std::countr_zero(word)));
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief Runs `function(begin, end)` over cache line aligned chunks of `[0, blocks)` on the installed executor.
+ * @details Chunk boundaries are aligned to cache lines of the `data` address, so no two
+ *          tasks write the same cache line. Sums values returned by the chunks.
+ *
+ * @param[in] data Pointer to the first block, used for chunk alignment.
+ * @param[in] blocks Number of blocks to process.
+ * @param[in] function Callable `(std::size_t begin, std::size_t end) -> std::size_t`.
+ * @param[out] result Sum of the chunk results.
+ * @return `false` if no executor installed or the range is below the threshold, nothing is done then.
+ */
+template<typename Block, typename Function>
+func ParallelReduceBlocks(const Block* data, std::size_t blocks, Function& function, std::size_t& result) -> bool {
+  bits::ParallelExecutor* executor{g_parallel_executor.load(std::memory_order_acquire)};
+  if (!executor || blocks * sizeof(Block) < g_parallel_threshold.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
+  constexpr std::size_t kLineBlocks{sizeof(Block) < kCacheLineSize ? kCacheLineSize / sizeof(Block) : 1};
+  const std::size_t concurrency{executor->Concurrency()};
+  if (concurrency < 2 || blocks <= kLineBlocks * concurrency) {
+    return false;
+  }
+
+  struct Context {
+    Function& function;
+    std::atomic<std::size_t> result;
+    std::size_t head;
+    std::size_t chunk;
+    std::size_t blocks;
+  } context{function, 0, 0, 0, blocks};
+
+  // First chunk ends at the first cache line boundary past `head`, other chunks span whole lines
+  const auto misalignment{reinterpret_cast<std::uintptr_t>(data) / sizeof(Block) % kLineBlocks};
+  context.head = std::min(blocks, (kLineBlocks - misalignment) % kLineBlocks);
+  const std::size_t lines{(blocks - context.head + kLineBlocks - 1) / kLineBlocks};
+  context.chunk = (lines + concurrency - 1) / concurrency * kLineBlocks;
+  const std::size_t tasks{(blocks - context.head + context.chunk - 1) / context.chunk};
+
+  executor->Run(
+    tasks,
+    [](void* erased, std::size_t task) noexcept -> void {
+      auto& self{*static_cast<Context*>(erased)};
+      const std::size_t begin{task ? self.head + task * self.chunk : 0};
+      const std::size_t end{std::min(self.blocks, self.head + (task + 1) * self.chunk)};
+      self.result.fetch_add(self.function(begin, end), std::memory_order_relaxed);
+    },
+    &context
+  );
+
+  result = context.result.load(std::memory_order_relaxed);
+  return true;
+}
+
 }  // namespace __bits_details
 
 /**
@@ -433,6 +521,39 @@ constexpr std::array<std::string_view, 256> kStrBytesMapping{
  */
 namespace bits {
 
+/**
+ * @brief Installs executor for whole-bitset operations of every `DynamicBitset`.
+ * @details `Count()`, `Set()`, `Reset()`, `Flip()`, `operator&=`, `operator|=`, `operator^=` and `operator==`
+ *          split storage of at least `threshold` bytes into cache line aligned chunks and run them
+ *          on `executor`. The executor must outlive its installation.
+ *
+ * @param[in] executor Executor to use, `nullptr` turns parallel execution off (default).
+ * @param[in] threshold Minimal storage size in bytes processed in parallel.
+ *
+ * @throws None (no-throw guarantee).
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::ThreadPoolExecutor pool;
+ * bits::SetParallelExecutor(&pool);
+ * bits::DynamicBitset huge(std::size_t{1} << 34);
+ * huge.Set(); // Filled by all pool threads
+ * bits::SetParallelExecutor(nullptr);
+ * @endcode
+ */
+inline func SetParallelExecutor(ParallelExecutor* executor, std::size_t threshold = kDefaultParallelThreshold) noexcept
+  -> void {
+  __bits_details::g_parallel_threshold.store(threshold, std::memory_order_relaxed);
+  __bits_details::g_parallel_executor.store(executor, std::memory_order_release);
+}
+
+/**
+ * @brief Returns executor installed with `SetParallelExecutor()`, `nullptr` if none.
+ */
+[[nodiscard]] inline func GetParallelExecutor() noexcept -> ParallelExecutor* {
+  return __bits_details::g_parallel_executor.load(std::memory_order_acquire);
+}
+
 template<
   __bits_details::IsValidDynamicBitsetBlockType Block,
   __bits_details::IsValidDynamicBitsetAllocatorType Allocator>
@@ -1183,6 +1304,46 @@ class DynamicBitset {
     return (bits >> BlockInfo::kByteDivConst) + (bits & BlockInfo::kByteModConst ? 1 : 0);
   }
 
+  /**
+   * @internal
+   * @private
+   * @brief Sums `function(begin, end)` over block ranges covering `[0, blocks)`.
+   * @details Runs on the executor installed with `SetParallelExecutor()` for large storage,
+   *          calls `function(0, blocks)` otherwise and during constant evaluation.
+   *
+   * @param[in] blocks Number of blocks to process.
+   * @param[in] function Callable `(SizeType begin, SizeType end) -> SizeType`, must not throw.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  template<typename Function>
+  [[nodiscard]] constexpr func ReduceBlocks(SizeType blocks, Function function) const noexcept -> SizeType {
+    if !consteval {
+      SizeType result{};
+      if (__bits_details::ParallelReduceBlocks(storage_, blocks, function, result)) {
+        return result;
+      }
+    }
+
+    return function(0, blocks);
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Calls `function(begin, end)` over block ranges covering `[0, blocks)`.
+   * @see ReduceBlocks()
+   *
+   * @throws None (no-throw guarantee).
+   */
+  template<typename Function>
+  constexpr func ForEachBlocks(SizeType blocks, Function function) const noexcept -> void {
+    static_cast<void>(ReduceBlocks(blocks, [&function](SizeType begin, SizeType end) constexpr noexcept -> SizeType {
+      function(begin, end);
+      return 0;
+    }));
+  }
+
   /**
    * @internal
    * @private
@@ -1203,6 +1364,33 @@ class DynamicBitset {
     }
   }
 
+  /**
+   * @internal
+   * @private
+   * @brief Returns the index of the first set bit in `[index, Size())` or `Size()`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func FindFrom(SizeType index) const noexcept -> SizeType {
+    if (index >= bits_) {
+      return bits_;
+    }
+
+    SizeType block_index{index >> BlockInfo::kByteDivConst};
+    const SizeType last_block{CalculateCapacity(bits_)};
+    BlockType block{static_cast<BlockType>(storage_[block_index] & BitMask::kSet << (index & BlockInfo::kByteModConst))};
+
+    while (!block) {
+      if (++block_index == last_block) {
+        return bits_;
+      }
+      block = storage_[block_index];
+    }
+
+    const SizeType found{(block_index << BlockInfo::kByteDivConst) + std::countr_zero(block)};
+    return found < bits_ ? found : bits_;
+  }
+
   [[nodiscard]] constexpr func ResizeFactor() const noexcept -> bool {
     return (bits_ >> BlockInfo::kByteDivConst) >= blocks_;
   }
@@ -1676,13 +1864,17 @@ class DynamicBitset {
       return 0;
     }
 
-    Pointer end{storage_ + CalculateCapacity(bits_) - 1};
-    SizeType bit_count{};
-
-    for (Pointer begin{storage_}; begin < end; ++begin) {
-      bit_count += std::popcount(*begin);
-    }
+    SizeType bit_count{
+      ReduceBlocks(CalculateCapacity(bits_) - 1, [this](SizeType begin, SizeType end) constexpr noexcept -> SizeType {
+        SizeType count{};
+        for (; begin < end; ++begin) {
+          count += std::popcount(storage_[begin]);
+        }
+        return count;
+      })
+    };
 
+    Pointer end{storage_ + CalculateCapacity(bits_) - 1};
     SizeType remaining_bits{bits_ & BlockInfo::kByteModConst};
     if (!remaining_bits) {
       remaining_bits = BlockInfo::kBitsCount;
@@ -1697,6 +1889,49 @@ class DynamicBitset {
     return bit_count;
   }
 
+  /**
+   * @public
+   * @brief Returns the number of bits set in both `this` and `other`.
+   * @details Same as `(copy &= other).Count()` without the copy.
+   * @ingroup dynamic-bitset-main
+   *
+   * @param[in] other Another `DynamicBitset` object.
+   * @return The count of bits set in both objects.
+   *
+   * @throws `std::invalid_argument` if `this` object size is not equal to `other` object size.
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset a{4, 0b0111};
+   * bits::DynamicBitset b{4, 0b1110};
+   * auto common{a.IntersectionCount(b)}; // common == 2
+   * @endcode
+   */
+  [[nodiscard]] constexpr func IntersectionCount(const DynamicBitset& other) const -> SizeType {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::DynamicBitset::IntersectionCount(): invalid storage size"};
+    }
+    if (!bits_) {
+      return 0;
+    }
+
+    const SizeType last{CalculateCapacity(bits_) - 1};
+    const SizeType bit_count{
+      ReduceBlocks(last, [this, &other](SizeType begin, SizeType end) constexpr noexcept -> SizeType {
+        SizeType count{};
+        for (; begin < end; ++begin) {
+          count += std::popcount(static_cast<BlockType>(storage_[begin] & other.storage_[begin]));
+        }
+        return count;
+      })
+    };
+
+    return bit_count + static_cast<SizeType>(std::popcount(
+                         static_cast<BlockType>(storage_[last] & other.storage_[last] &
+                                                __bits_details::TailMask<BlockType>(bits_))
+                       ));
+  }
+
   /**
    * @public
    * @brief Reduces the Capacity to store the minimum required blocks.
@@ -1858,6 +2093,101 @@ class DynamicBitset {
     return true;
   }
 
+  /**
+   * @public
+   * @brief Returns the index of the first set bit.
+   * @see FindNext()
+   * @ingroup dynamic-bitset-bitops
+   *
+   * @return Index of the first bit with value `true` or `Size()` if there is no such bit.
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset bits{8, 0b0010'0100};
+   * auto first{bits.FindFirst()}; // first == 2
+   * @endcode
+   */
+  [[nodiscard]] constexpr func FindFirst() const noexcept -> SizeType { return FindFrom(0); }
+
+  /**
+   * @public
+   * @brief Returns the index of the first set bit after `index`.
+   * @details Scans the storage block by block, so the search skips
+   *          `BlockInfo::kBitsCount` unset bits per step.
+   * @see FindFirst()
+   * @ingroup dynamic-bitset-bitops
+   *
+   * @param[in] index The zero-based index of the bit to start search after.
+   * @return Index of the next bit with value `true` or `Size()` if there is no such bit.
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset bits{8, 0b0010'0100};
+   * for (auto index{bits.FindFirst()}; index < bits.Size(); index = bits.FindNext(index)) {
+   *   // index == 2, index == 5
+   * }
+   * @endcode
+   */
+  [[nodiscard]] constexpr func FindNext(SizeType index) const noexcept -> SizeType {
+    return index + 1 < bits_ ? FindFrom(index + 1) : bits_;
+  }
+
+  /**
+   * @public
+   * @brief Writes indices of all set bits to `out` in increasing order.
+   * @details Single pass: blocks are decoded unchecked while `out` has room for all their bits,
+   *          only the remaining ones are counted first. Uses AVX-512 VPCOMPRESS for 32 and 64 bit
+   *          indices when compiled with AVX-512F.
+   * @see FindFirst()
+   * @ingroup dynamic-bitset-bitops
+   *
+   * @tparam Index Unsigned integral type of the output indices.
+   * @param[out] out Destination span, must have room for `Count()` indices.
+   * @return Number of written indices, equal to `Count()`.
+   *
+   * @throws std::invalid_argument If `Index` can not represent `Size() - 1`.
+   * @throws std::out_of_range If `out.size() < Count()`, contents of `out` are unspecified then.
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset bits{8, 0b0010'0100};
+   * std::vector<std::uint32_t> indices(bits.Count());
+   * bits.ToIndices(std::span{indices}); // indices == {2, 5}
+   * @endcode
+   */
+  template<std::unsigned_integral Index>
+  constexpr func ToIndices(std::span<Index> out) const -> SizeType {
+    if (bits_ && bits_ - 1 > std::numeric_limits<Index>::max()) [[unlikely]] {
+      throw std::invalid_argument{"bits::DynamicBitset::ToIndices(std::span<Index>): index type is too narrow"};
+    }
+
+    const SizeType blocks{CalculateCapacity(bits_)};
+    Index* cursor{out.data()};
+    Index* const last{out.data() + out.size()};
+    SizeType block{};
+    // Decode unchecked while `out` has room for every bit of the decoded blocks
+    for (SizeType safe{}; block < blocks; block = safe) {
+      safe = std::min(blocks, block + static_cast<SizeType>(last - cursor) / BlockInfo::kBitsCount);
+      if (safe == block) {
+        break;
+      }
+      cursor = __bits_details::DecodeSetBits(storage_, block, safe, bits_, cursor);
+    }
+    for (; block < blocks; ++block) {
+      const auto mask{block + 1 == blocks ? __bits_details::TailMask<Block>(bits_) : static_cast<Block>(BitMask::kSet)};
+      if (static_cast<SizeType>(std::popcount(static_cast<Block>(storage_[block] & mask))) >
+          static_cast<SizeType>(last - cursor)) [[unlikely]] {
+        throw std::out_of_range{"bits::DynamicBitset::ToIndices(std::span<Index>): output span is too small"};
+      }
+      cursor = __bits_details::DecodeSetBits(storage_, block, block + 1, bits_, cursor);
+    }
+    return static_cast<SizeType>(cursor - out.data());
+  }
+
   /**
    * @public
    * @brief Checks if the `DynamicBitset` is empty.
@@ -2116,7 +2446,9 @@ class DynamicBitset {
       throw std::out_of_range{"bits::DynamicBitset::Set() -> invalid number of bits"};
     }
 
-    std::fill(storage_, storage_ + CalculateCapacity(bits_), BitMask::kSet);
+    ForEachBlocks(CalculateCapacity(bits_), [this](SizeType begin, SizeType end) constexpr noexcept -> void {
+      std::fill(storage_ + begin, storage_ + end, BitMask::kSet);
+    });
     return *this;
   }
 
@@ -2170,7 +2502,9 @@ class DynamicBitset {
       throw std::out_of_range{"bits::DynamicBitset::Reset() -> invalid number of bits"};
     }
 
-    std::fill(storage_, storage_ + CalculateCapacity(bits_), BitMask::kReset);
+    ForEachBlocks(CalculateCapacity(bits_), [this](SizeType begin, SizeType end) constexpr noexcept -> void {
+      std::fill(storage_ + begin, storage_ + end, BitMask::kReset);
+    });
     return *this;
   }
 
@@ -2226,8 +2560,10 @@ class DynamicBitset {
       throw std::out_of_range{"bits::DynamicBitset::Flip() -> invalid number of bits"};
     }
 
-    std::for_each(storage_, storage_ + CalculateCapacity(bits_), [](BlockType& block) constexpr noexcept -> void {
-      block ^= BitMask::kSet;
+    ForEachBlocks(CalculateCapacity(bits_), [this](SizeType begin, SizeType end) constexpr noexcept -> void {
+      std::for_each(storage_ + begin, storage_ + end, [](BlockType& block) constexpr noexcept -> void {
+        block ^= BitMask::kSet;
+      });
     });
 
     return *this;
@@ -2649,11 +2985,11 @@ class DynamicBitset {
       throw std::invalid_argument{"bits::DynamicBitset::operator&=(): invalid storage size"};
     }
 
-    std::for_each(
-      storage_,
-      storage_ + CalculateCapacity(bits_),
-      [other_block = other.storage_](auto& block) constexpr mutable noexcept -> void { block &= *other_block++; }
-    );
+    ForEachBlocks(CalculateCapacity(bits_), [this, &other](SizeType begin, SizeType end) constexpr noexcept -> void {
+      for (; begin < end; ++begin) {
+        storage_[begin] &= other.storage_[begin];
+      }
+    });
 
     return *this;
   }
@@ -2689,11 +3025,11 @@ class DynamicBitset {
       throw std::invalid_argument{"bits::DynamicBitset::operator|=(): invalid storage size"};
     }
 
-    std::for_each(
-      storage_,
-      storage_ + CalculateCapacity(bits_),
-      [other_block = other.storage_](auto& block) constexpr mutable noexcept -> void { block |= *other_block++; }
-    );
+    ForEachBlocks(CalculateCapacity(bits_), [this, &other](SizeType begin, SizeType end) constexpr noexcept -> void {
+      for (; begin < end; ++begin) {
+        storage_[begin] |= other.storage_[begin];
+      }
+    });
 
     return *this;
   }
@@ -2729,11 +3065,11 @@ class DynamicBitset {
       throw std::invalid_argument{"bits::DynamicBitset::operator^=(): invalid storage size"};
     }
 
-    std::for_each(
-      storage_,
-      storage_ + CalculateCapacity(bits_),
-      [other_block = other.storage_](auto& block) constexpr mutable noexcept -> void { block ^= *other_block++; }
-    );
+    ForEachBlocks(CalculateCapacity(bits_), [this, &other](SizeType begin, SizeType end) constexpr noexcept -> void {
+      for (; begin < end; ++begin) {
+        storage_[begin] ^= other.storage_[begin];
+      }
+    });
 
     return *this;
   }
@@ -2903,19 +3239,21 @@ class DynamicBitset {
       return true;
     }
 
-    if (!std::equal(storage_, storage_ + CalculateCapacity(bits_) - 1, other.storage_)) {
+    const auto mismatch{[this, &other](SizeType begin, SizeType end) constexpr noexcept -> SizeType {
+      return static_cast<SizeType>(!std::equal(storage_ + begin, storage_ + end, other.storage_ + begin));
+    }};
+    if (ReduceBlocks(CalculateCapacity(bits_) - 1, mismatch)) {
       return false;
     }
 
     const Pointer last_block{storage_ + CalculateCapacity(bits_) - 1};
     const Pointer other_last_block{other.storage_ + CalculateCapacity(other.bits_) - 1};
-    const BlockType remaining_bits{static_cast<BlockType>(bits_ & BlockInfo::kByteModConst)};
-    for (BlockType current_bit{1}; current_bit <= remaining_bits; current_bit <<= 1) {
-      if (!((*last_block & current_bit) & *other_last_block)) {
-        return false;
-      }
-    }
-    return true;
+    const SizeType remaining_bits{bits_ & BlockInfo::kByteModConst};
+    // Bits past Size() in the last block are unspecified
+    const auto tail_mask{
+      static_cast<BlockType>(remaining_bits ? ~(BitMask::kSet << remaining_bits) : BitMask::kSet)
+    };
+    return !((*last_block ^ *other_last_block) & tail_mask);
   }
 
   /**
@@ -2965,24 +3303,134 @@ class DynamicBitset {
    */
   [[nodiscard]] constexpr func ToString() const -> std::string {
     std::string str_bits(bits_, '\0');
-    const unsigned char* last_byte_block{reinterpret_cast<unsigned char*>(storage_ + CalculateCapacity(bits_))};
-    auto str_byte_block{str_bits.begin()};
-    for (unsigned char* byte_block{reinterpret_cast<unsigned char*>(storage_)}; byte_block != last_byte_block;
-         ++byte_block) {
-      std::ranges::copy(__bits_details::kStrBytesMapping[*byte_block], str_byte_block);
-      str_byte_block += std::numeric_limits<unsigned char>::digits;
-    }
-    const SizeType remaining_bits{bits_ & (std::numeric_limits<unsigned char>::digits - 1)};
-    for (SizeType current_bit{}; current_bit < remaining_bits; ++current_bit) {
-      *str_byte_block++ =
-        (storage_[current_bit >> BlockInfo::kByteDivConst] >> (current_bit & BlockInfo::kByteModConst) &
-         BitMask::kBit) |
-        '0';
+    if (!bits_) {
+      return str_bits;
+    }
+
+    const auto* bytes{reinterpret_cast<const unsigned char*>(storage_)};
+    const SizeType full_bytes{bits_ >> 3};
+    __bits_details::ExpandBitsToChars(bytes, full_bytes, str_bits.data());
+
+    if (const SizeType remaining_bits{bits_ & 7}; remaining_bits) {
+      char last_chars[std::numeric_limits<unsigned char>::digits];
+      __bits_details::ExpandBitsToChars(bytes + full_bytes, 1, last_chars);
+      std::copy_n(last_chars, remaining_bits, str_bits.data() + (full_bytes << 3));
     }
 
     return str_bits;
   }
 
+  /**
+   * @public
+   * @brief Converts the bitset to a compact hexadecimal string representation.
+   * @details Every character encodes 4 consecutive bits, so the output is
+   *          4 times shorter than `ToString()`. Digit `k` holds bits `[4k, 4k + 4)`
+   *          with bit `4k` as the least significant bit of the digit.
+   * @see FromHexString()
+   * @ingroup dynamic-bitset-format
+   *
+   * @return A new `std::string` of `ceil(Size() / 4)` lowercase hexadecimal digits.
+   *
+   * @throws std::bad_alloc If memory allocation during `std::string` construction fails.
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset bits{12, 0b0000'0001'1111};
+   * auto s{bits.ToHexString()}; // "f10"
+   * @endcode
+   */
+  [[nodiscard]] constexpr func ToHexString() const -> std::string {
+    std::string str_hex((bits_ >> 2) + (bits_ & 3 ? 1 : 0), '\0');
+    if (!bits_) {
+      return str_hex;
+    }
+
+    const auto* bytes{reinterpret_cast<const unsigned char*>(storage_)};
+    const SizeType full_bytes{bits_ >> 3};
+    __bits_details::ExpandNibblesToHex(bytes, full_bytes, str_hex.data());
+
+    if (const SizeType remaining_bits{bits_ & 7}; remaining_bits) {
+      const unsigned char last_byte{static_cast<unsigned char>(bytes[full_bytes] & ((1U << remaining_bits) - 1))};
+      char last_chars[2];
+      __bits_details::ExpandNibblesToHex(&last_byte, 1, last_chars);
+      std::copy_n(last_chars, str_hex.size() - (full_bytes << 1), str_hex.data() + (full_bytes << 1));
+    }
+
+    return str_hex;
+  }
+
+  /**
+   * @public
+   * @static
+   * @brief Constructs `DynamicBitset` from the hexadecimal representation.
+   * @details Inverse operation for `ToHexString()`. Accepts both lowercase
+   *          and uppercase digits. Resulting `Size()` equals `hex.size() * 4`.
+   * @see ToHexString()
+   * @ingroup dynamic-bitset-format
+   *
+   * @param[in] hex Hexadecimal digits, digit `k` holds bits `[4k, 4k + 4)`.
+   * @param[in] allocator The allocator to use for memory allocations.
+   * @return New `DynamicBitset` object.
+   *
+   * @throws std::invalid_argument If `hex` contains non-hexadecimal character.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * auto bits{bits::DynamicBitset<>::FromHexString("f1")}; // Size() == 8, Sequence: [1, 1, 1, 1, 1, 0, 0, 0]
+   * @endcode
+   */
+  [[nodiscard]] static constexpr func FromHexString(
+    std::string_view hex, const AllocatorType& allocator = AllocatorType{}
+  ) -> DynamicBitset {
+    return FromHexString(hex, hex.size() << 2, allocator);
+  }
+
+  /**
+   * @public
+   * @static
+   * @brief Constructs `DynamicBitset` with exact size from the hexadecimal representation.
+   * @details Inverse operation for `ToHexString()` that restores sizes which
+   *          are not multiple of 4. Bits of the last digit beyond `bits` are ignored.
+   * @see ToHexString()
+   * @ingroup dynamic-bitset-format
+   *
+   * @param[in] hex Hexadecimal digits, digit `k` holds bits `[4k, 4k + 4)`.
+   * @param[in] bits Number of bits in the resulting object.
+   * @param[in] allocator The allocator to use for memory allocations.
+   * @return New `DynamicBitset` object with `Size() == bits`.
+   *
+   * @throws std::invalid_argument If `hex` contains non-hexadecimal character or
+   *         `hex.size() != ceil(bits / 4)`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset bits{10, 0b11'0000'0101};
+   * auto copy{bits::DynamicBitset<>::FromHexString(bits.ToHexString(), bits.Size())}; // copy == bits
+   * @endcode
+   */
+  [[nodiscard]] static constexpr func FromHexString(
+    std::string_view hex, SizeType bits, const AllocatorType& allocator = AllocatorType{}
+  ) -> DynamicBitset {
+    if (hex.size() != (bits >> 2) + (bits & 3 ? 1 : 0)) {
+      throw std::invalid_argument{"bits::DynamicBitset::FromHexString(std::string_view, SizeType): invalid size"};
+    }
+
+    DynamicBitset result{bits, 0, allocator};
+    if (!bits) {
+      return result;
+    }
+
+    auto* bytes{reinterpret_cast<unsigned char*>(result.storage_)};
+    __bits_details::PackHexToNibbles(hex, bytes);
+    if (const SizeType remaining_bits{bits & 7}; remaining_bits) {
+      bytes[bits >> 3] &= static_cast<unsigned char>((1U << remaining_bits) - 1);
+    }
+
+    return result;
+  }
+
  private:
   Pointer storage_{nullptr};
   SizeType bits_{};
@@ -3146,22 +3594,246 @@ namespace std {
 
 /**
  * @brief Enables `std::format` support for `DynamicBitset`.
+ * @details Formats the object directly into the output iterator in fixed-size
+ *          chunks, no intermediate `std::string` is allocated.
+ *          Supported format specification: `[[fill]align][width][.precision][type]`:
+ *          - `align` is one of `<` (default), `^`, `>`;
+ *          - `precision` limits the output to the first `precision` bits;
+ *          - `type` is one of:
+ *            - `b` (default) - one '0'/'1' character per bit, same as `ToString()`;
+ *            - `x` - hexadecimal digits, same as `ToHexString()`;
+ *            - `r` - comma separated runs of set bits, e.g. `0-3,8,10-11`.
  * @struct formatter
  * @ingroup dynamic-bitset-format
  *
  * @tparam Block Unsigned integral type used for bit storage (e.g., `uint8_t`).
  * @tparam Allocator Allocator type meeting Cpp17Allocator requirements.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::DynamicBitset bits{12, 0b1101'0000'1111};
+ * std::format("{}", bits);     // "111100001011"
+ * std::format("{:x}", bits);   // "f0d"
+ * std::format("{:r}", bits);   // "0-3,8,10-11"
+ * std::format("{:.4}", bits);  // "1111"
+ * std::format("{:>6.2}", bits); // "    11"
+ * @endcode
  */
 template<typename Block, typename Allocator>
-struct formatter<bits::DynamicBitset<Block, Allocator>> : public formatter<string> {
-  [[nodiscard]] func format(
-    const bits::DynamicBitset<Block, Allocator> bits,  //
-    format_context& ctx
-  ) const
-    /* clang-format off */ -> decltype(formatter<string>::format(bits.ToString(), ctx)) /* clang-format on */
-  {
-    return formatter<string>::format(bits.ToString(), ctx);
+struct formatter<bits::DynamicBitset<Block, Allocator>> {
+ private:
+  /**
+   * @internal
+   * @brief Number of characters buffered before writing to the output iterator.
+   */
+  static constexpr size_t kChunkSize{512};
+
+  enum class Alignment : char { kLeft, kCenter, kRight };
+
+ public:
+  constexpr func parse(format_parse_context& ctx) -> format_parse_context::iterator {
+    auto it{ctx.begin()};
+    const auto end{ctx.end()};
+    const auto to_alignment{[](char symbol, Alignment& alignment) constexpr noexcept -> bool {
+      switch (symbol) {
+        case '<':
+          alignment = Alignment::kLeft;
+          return true;
+        case '^':
+          alignment = Alignment::kCenter;
+          return true;
+        case '>':
+          alignment = Alignment::kRight;
+          return true;
+        default:
+          return false;
+      }
+    }};
+
+    if (it != end && it + 1 != end && *it != '}' && to_alignment(*(it + 1), alignment_)) {
+      fill_ = *it;
+      it += 2;
+    } else if (it != end && to_alignment(*it, alignment_)) {
+      ++it;
+    }
+
+    for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+      width_ = width_ * 10 + static_cast<size_t>(*it - '0');
+    }
+
+    if (it != end && *it == '.') {
+      if (++it == end || *it < '0' || *it > '9') {
+        throw format_error{"bits::DynamicBitset formatter: missing precision value"};
+      }
+      precision_ = 0;
+      for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+        precision_ = precision_ * 10 + static_cast<size_t>(*it - '0');
+      }
+    }
+
+    if (it != end && (*it == 'b' || *it == 'x' || *it == 'r')) {
+      type_ = *it++;
+    }
+
+    if (it != end && *it != '}') {
+      throw format_error{"bits::DynamicBitset formatter: invalid format specification"};
+    }
+
+    return it;
+  }
+
+  template<typename FormatContext>
+  func format(const bits::DynamicBitset<Block, Allocator>& bits, FormatContext& ctx) const ->
+    typename FormatContext::iterator {
+    const size_t bits_limit{std::min<size_t>(bits.Size(), precision_)};
+    auto out{ctx.out()};
+
+    size_t length{};
+    switch (type_) {
+      case 'x':
+        length = (bits_limit >> 2) + (bits_limit & 3 ? 1 : 0);
+        break;
+      case 'r':
+        length = width_ ? WriteRuns(bits, bits_limit, [](const char*, size_t) constexpr noexcept -> void { }) : 0;
+        break;
+      default:
+        length = bits_limit;
+        break;
+    }
+
+    const size_t padding{width_ > length ? width_ - length : 0};
+    const size_t padding_before{
+      alignment_ == Alignment::kRight ? padding : alignment_ == Alignment::kCenter ? padding >> 1 : 0
+    };
+    out = std::fill_n(out, padding_before, fill_);
+
+    const auto writer{[&out](const char* chars, size_t count) -> void { out = std::copy_n(chars, count, out); }};
+    switch (type_) {
+      case 'x':
+        WriteHex(bits, bits_limit, writer);
+        break;
+      case 'r':
+        WriteRuns(bits, bits_limit, writer);
+        break;
+      default:
+        WriteBinary(bits, bits_limit, writer);
+        break;
+    }
+
+    return std::fill_n(out, padding - padding_before, fill_);
   }
+
+ private:
+  template<typename Writer>
+  static func WriteBinary(const bits::DynamicBitset<Block, Allocator>& bits, size_t bits_limit, const Writer& writer)
+    -> void {
+    constexpr size_t kChunkBytes{kChunkSize >> 3};
+    const auto* bytes{reinterpret_cast<const unsigned char*>(bits.Data())};
+    char chunk[kChunkSize];
+
+    for (size_t full_bytes{bits_limit >> 3}; full_bytes;) {
+      const size_t chunk_bytes{std::min(full_bytes, kChunkBytes)};
+      __bits_details::ExpandBitsToChars(bytes, chunk_bytes, chunk);
+      writer(chunk, chunk_bytes << 3);
+      bytes += chunk_bytes;
+      full_bytes -= chunk_bytes;
+    }
+    if (const size_t remaining_bits{bits_limit & 7}; remaining_bits) {
+      __bits_details::ExpandBitsToChars(bytes, 1, chunk);
+      writer(chunk, remaining_bits);
+    }
+  }
+
+  template<typename Writer>
+  static func WriteHex(const bits::DynamicBitset<Block, Allocator>& bits, size_t bits_limit, const Writer& writer)
+    -> void {
+    constexpr size_t kChunkBytes{kChunkSize >> 1};
+    const auto* bytes{reinterpret_cast<const unsigned char*>(bits.Data())};
+    char chunk[kChunkSize];
+
+    for (size_t full_bytes{bits_limit >> 3}; full_bytes;) {
+      const size_t chunk_bytes{std::min(full_bytes, kChunkBytes)};
+      __bits_details::ExpandNibblesToHex(bytes, chunk_bytes, chunk);
+      writer(chunk, chunk_bytes << 1);
+      bytes += chunk_bytes;
+      full_bytes -= chunk_bytes;
+    }
+    if (const size_t remaining_bits{bits_limit & 7}; remaining_bits) {
+      const unsigned char last_byte{static_cast<unsigned char>(*bytes & ((1U << remaining_bits) - 1))};
+      __bits_details::ExpandNibblesToHex(&last_byte, 1, chunk);
+      writer(chunk, remaining_bits > 4 ? 2 : 1);
+    }
+  }
+
+  /**
+   * @internal
+   * @brief Returns the position of the first bit equal to `value` in `[from, bits_limit)` or `bits_limit`.
+   */
+  static constexpr func ScanBits(const Block* blocks, size_t from, size_t bits_limit, bool value) noexcept -> size_t {
+    constexpr size_t kBitsCount{numeric_limits<Block>::digits};
+    const Block invert{value ? Block{} : numeric_limits<Block>::max()};
+    size_t index{from / kBitsCount};
+    auto block{static_cast<Block>((blocks[index] ^ invert) & (numeric_limits<Block>::max() << (from % kBitsCount)))};
+
+    while (!block) {
+      if (++index * kBitsCount >= bits_limit) {
+        return bits_limit;
+      }
+      block = static_cast<Block>(blocks[index] ^ invert);
+    }
+
+    return std::min(index * kBitsCount + static_cast<size_t>(countr_zero(block)), bits_limit);
+  }
+
+  /**
+   * @internal
+   * @brief Writes runs of set bits and returns the number of written characters.
+   */
+  template<typename Writer>
+  static func WriteRuns(const bits::DynamicBitset<Block, Allocator>& bits, size_t bits_limit, const Writer& writer)
+    -> size_t {
+    if (!bits_limit) {
+      return 0;
+    }
+
+    constexpr size_t kMaxRunChars{(numeric_limits<size_t>::digits10 + 1) * 2 + 2};
+    char chunk[kChunkSize];
+    size_t chunk_size{};
+    size_t length{};
+
+    for (size_t bit{ScanBits(bits.Data(), 0, bits_limit, true)}; bit < bits_limit;) {
+      const size_t run_end{ScanBits(bits.Data(), bit, bits_limit, false)};
+
+      if (chunk_size + kMaxRunChars > kChunkSize) {
+        writer(chunk, chunk_size);
+        chunk_size = 0;
+      }
+
+      char* position{chunk + chunk_size};
+      if (length) {
+        *position++ = ',';
+      }
+      position = to_chars(position, chunk + kChunkSize, bit).ptr;
+      if (run_end - bit > 1) {
+        *position++ = '-';
+        position = to_chars(position, chunk + kChunkSize, run_end - 1).ptr;
+      }
+      length += static_cast<size_t>(position - (chunk + chunk_size));
+      chunk_size = static_cast<size_t>(position - chunk);
+
+      bit = run_end < bits_limit ? ScanBits(bits.Data(), run_end, bits_limit, true) : bits_limit;
+    }
+    writer(chunk, chunk_size);
+
+    return length;
+  }
+
+ private:
+  size_t width_{};
+  size_t precision_{numeric_limits<size_t>::max()};
+  char fill_{' '};
+  char type_{'b'};
+  Alignment alignment_{Alignment::kLeft};
 };
 
 /**
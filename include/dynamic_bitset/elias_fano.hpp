@@ -0,0 +1,369 @@
+/**
+ * @file dynamic_bitset/elias_fano.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Elias-Fano encoding of monotone sequences with random access and successor queries
+ * @defgroup elias-fano Elias-Fano sequence
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <bit>       /* std::bit_width, std::countr_zero, std::popcount */
+#include <cstdint>   /* std::uint64_t */
+#include <limits>    /* std::numeric_limits */
+#include <span>      /* std::span */
+#include <stdexcept> /* std::out_of_range, std::invalid_argument */
+#include <utility>   /* std::pair */
+#include <vector>    /* std::vector */
+
+#if defined(__BMI2__)
+  #include <immintrin.h> /* _pdep_u64 */
+#endif
+
+namespace __bits_details {
+
+/**
+ * @brief Returns the position of the set bit of rank `rank` (zero-based) in `word`.
+ * @details Deposits a single bit to the `rank`-th set bit with BMI2 PDEP, otherwise clears `rank` lowest
+ *          set bits.
+ *
+ * @warning **Undefined Behaviour** if `rank >= std::popcount(word)`.
+ */
+[[nodiscard]] inline func SelectInWord(std::uint64_t word, std::size_t rank) noexcept -> std::size_t {
+#if defined(__BMI2__)
+  return static_cast<std::size_t>(std::countr_zero(_pdep_u64(std::uint64_t{1} << rank, word)));
+#else
+  for (; rank; --rank) {
+    word &= word - 1;
+  }
+  return static_cast<std::size_t>(std::countr_zero(word));
+#endif
+}
+
+}  // namespace __bits_details
+
+namespace bits {
+
+/**
+ * @brief Non-decreasing sequence of integers below `Universe()` in Elias-Fano encoding.
+ * @details Every value is split into `l = floor(log2(Universe() / Size()))` lower bits, packed into
+ *          64-bit words, and the upper bits, stored in unary in a `DynamicBitset`: value `i` sets bit
+ *          `(value >> l) + i`. The encoding takes at most `2 + l` bits per value plus the select index,
+ *          one sampled position per `BlockInfo::kSelectSample` ones and zeros of the upper bits.
+ *
+ *          `Access(i)` selects the `i`-th one of the upper bits from the nearest sample. `NextGEQ(x)`
+ *          selects the zero closing the bucket before `x >> l` and scans the bucket, which holds about
+ *          two values on average.
+ * @ingroup elias-fano
+ *
+ * @tparam Block Unsigned integral type used for the upper bits.
+ * @tparam Allocator Allocator of blocks.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::DynamicBitset<> ids{1'000};
+ * ids.Set(3, true).Set(500, true).Set(999, true);
+ * bits::EliasFano<> sequence{ids};
+ * auto second{sequence.Access(1)};             // second == 500
+ * auto [index, value]{sequence.NextGEQ(501)};  // index == 2, value == 999
+ * @endcode
+ */
+template<
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class EliasFano {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using value_type = std::size_t;
+  using ValueType = value_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using BitsetType = DynamicBitset<BlockType, Allocator>;
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kWordBits{64};
+    static constexpr SizeType kSelectSample{256};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kSet{static_cast<BlockType>(-1)};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs an empty sequence.
+   */
+  EliasFano() = default;
+
+  /**
+   * @public
+   * @brief Encodes positions of set bits of `bits` in increasing order, `Universe() == bits.Size()`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit EliasFano(const BitsetType& bits) {
+    Encode(bits.Size(), bits.Count(), [&bits, index{bits.FindFirst()}]() mutable -> ValueType {
+      const ValueType value{index};
+      index = bits.FindNext(index);
+      return value;
+    });
+  }
+
+  /**
+   * @public
+   * @brief Encodes non-decreasing `values` below `universe`.
+   *
+   * @throws std::invalid_argument If `values` are not sorted or a value is not less than `universe`.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  EliasFano(ValueType universe, std::span<const ValueType> values) {
+    for (SizeType index{}; index < values.size(); ++index) {
+      if (values[index] >= universe || (index && values[index] < values[index - 1])) {
+        throw std::invalid_argument{
+          "bits::EliasFano::EliasFano(ValueType, std::span<const ValueType>): values are not sorted or out of range"
+        };
+      }
+    }
+    Encode(universe, values.size(), [values, index{SizeType{}}]() mutable -> ValueType { return values[index++]; });
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of encoded values.
+   */
+  [[nodiscard]] func Size() const noexcept -> SizeType { return size_; }
+
+  /**
+   * @public
+   * @brief Returns the exclusive upper bound of the encoded values.
+   */
+  [[nodiscard]] func Universe() const noexcept -> ValueType { return universe_; }
+
+  /**
+   * @public
+   * @brief Returns the number of lower bits stored per value.
+   */
+  [[nodiscard]] func LowerBits() const noexcept -> SizeType { return lower_bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of bytes used by the object, its bit arrays and the select index.
+   */
+  [[nodiscard]] func MemoryUsage() const noexcept -> SizeType {
+    return sizeof(*this) + lower_.capacity() * sizeof(std::uint64_t) + upper_.NumBlocks() * sizeof(BlockType) +
+           (ones_.capacity() + zeros_.capacity()) * sizeof(SizeType);
+  }
+
+  /**
+   * @public
+   * @brief Returns the value with `index`.
+   *
+   * @throws std::out_of_range If `index >= Size()`.
+   */
+  [[nodiscard]] func Access(SizeType index) const -> ValueType {
+    if (index >= size_) {
+      throw std::out_of_range{"bits::EliasFano::Access(SizeType): index is out of range"};
+    }
+
+    return (Select<true>(index) - index) << lower_bits_ | Lower(index);
+  }
+
+  /**
+   * @public
+   * @brief Returns the index and the value of the first value not less than `value`.
+   *
+   * @return `{index, Access(index)}` or `{Size(), Universe()}` if all values are less than `value`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func NextGEQ(ValueType value) const noexcept -> std::pair<SizeType, ValueType> {
+    if (value >= universe_ || !size_) {
+      return {size_, universe_};
+    }
+
+    const ValueType high{value >> lower_bits_};
+    // Bucket `high` starts after the zero closing bucket `high - 1`
+    SizeType position{high ? Select<false>(high - 1) + 1 : 0};
+    SizeType index{position - high};
+    for (; index < size_ && upper_.Test(position); ++index, ++position) {
+      const ValueType current{high << lower_bits_ | Lower(index)};
+      if (current >= value) {
+        return {index, current};
+      }
+    }
+    if (index == size_) {
+      return {size_, universe_};
+    }
+
+    // The first value of a later bucket
+    position = upper_.FindNext(position);
+    return {index, (position - index) << lower_bits_ | Lower(index)};
+  }
+
+  /**
+   * @public
+   * @brief Decodes the sequence into a `DynamicBitset` of `Universe()` bits, repeated values collapse.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func ToDynamicBitset() const -> BitsetType {
+    BitsetType bits(universe_);
+    SizeType index{};
+    for (SizeType position{upper_.FindFirst()}; position < upper_.Size(); position = upper_.FindNext(position)) {
+      bits.Set((position - index) << lower_bits_ | Lower(index), true);
+      ++index;
+    }
+    return bits;
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Writes `count` values produced by `next()` and builds the select index.
+   */
+  template<typename Generator>
+  func Encode(ValueType universe, SizeType count, Generator next) -> void {
+    universe_ = universe;
+    size_ = count;
+    lower_bits_ = count && universe > count ? static_cast<SizeType>(std::bit_width(universe / count)) - 1 : 0;
+    if (!count) {
+      // Upper bits would cover the whole universe with nothing to select
+      return;
+    }
+    // One padding word lets `Lower()` read two words unconditionally
+    lower_.assign(count * lower_bits_ / BlockInfo::kWordBits + 2, 0);
+    upper_ = BitsetType(count + (universe >> lower_bits_) + 1);
+
+    const std::uint64_t mask{(std::uint64_t{1} << lower_bits_) - 1};
+    for (SizeType index{}; index < count; ++index) {
+      const ValueType value{next()};
+      upper_.Set((value >> lower_bits_) + index, true);
+      if (lower_bits_) {
+        const SizeType offset{index * lower_bits_};
+        const SizeType shift{offset % BlockInfo::kWordBits};
+        lower_[offset / BlockInfo::kWordBits] |= (value & mask) << shift;
+        if (shift + lower_bits_ > BlockInfo::kWordBits) {
+          lower_[offset / BlockInfo::kWordBits + 1] |= (value & mask) >> (BlockInfo::kWordBits - shift);
+        }
+      }
+    }
+    BuildSamples();
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Samples the positions of every `BlockInfo::kSelectSample`-th one and zero of the upper bits.
+   */
+  func BuildSamples() -> void {
+    ones_.clear();
+    zeros_.clear();
+    const SizeType blocks{(upper_.Size() + BlockInfo::kBitsCount - 1) / BlockInfo::kBitsCount};
+    SizeType ones{};
+    SizeType zeros{};
+    for (SizeType block{}; block < blocks; ++block) {
+      const BlockType tail{block + 1 == blocks ? __bits_details::TailMask<BlockType>(upper_.Size()) : BitMask::kSet};
+      const auto word{static_cast<BlockType>(upper_.Data()[block] & tail)};
+      const auto inverted{static_cast<BlockType>(~upper_.Data()[block] & tail)};
+      Sample(ones_, ones, block, word);
+      Sample(zeros_, zeros, block, inverted);
+    }
+  }
+
+  static func Sample(std::vector<SizeType>& samples, SizeType& seen, SizeType block, BlockType word) -> void {
+    const auto count{static_cast<SizeType>(std::popcount(word))};
+    for (SizeType rank{samples.size() * BlockInfo::kSelectSample}; rank < seen + count;
+         rank += BlockInfo::kSelectSample) {
+      samples.push_back(block * BlockInfo::kBitsCount + __bits_details::SelectInWord(word, rank - seen));
+    }
+    seen += count;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns the position of the one (`Ones`) or zero of the upper bits with rank `rank`.
+   * @details Starts at the nearest sample and skips whole blocks by popcount.
+   */
+  template<bool Ones>
+  [[nodiscard]] func Select(SizeType rank) const noexcept -> SizeType {
+    const std::vector<SizeType>& samples{Ones ? ones_ : zeros_};
+    const SizeType sample{samples[rank / BlockInfo::kSelectSample]};
+    SizeType remaining{rank % BlockInfo::kSelectSample};
+    SizeType block{sample / BlockInfo::kBitsCount};
+    auto word{static_cast<BlockType>(Load<Ones>(block) & BitMask::kSet << sample % BlockInfo::kBitsCount)};
+    for (auto count{static_cast<SizeType>(std::popcount(word))}; remaining >= count;
+         count = static_cast<SizeType>(std::popcount(word))) {
+      remaining -= count;
+      word = Load<Ones>(++block);
+    }
+    return block * BlockInfo::kBitsCount + __bits_details::SelectInWord(word, remaining);
+  }
+
+  template<bool Ones>
+  [[nodiscard]] func Load(SizeType block) const noexcept -> BlockType {
+    return Ones ? upper_.Data()[block] : static_cast<BlockType>(~upper_.Data()[block]);
+  }
+
+  [[nodiscard]] func Lower(SizeType index) const noexcept -> ValueType {
+    const SizeType offset{index * lower_bits_};
+    const SizeType shift{offset % BlockInfo::kWordBits};
+    const std::uint64_t* word{lower_.data() + offset / BlockInfo::kWordBits};
+    // Two shifts keep the count below 64 when `shift == 0`
+    const std::uint64_t bits{word[0] >> shift | word[1] << 1 << (BlockInfo::kWordBits - 1 - shift)};
+    return static_cast<ValueType>(bits & ((std::uint64_t{1} << lower_bits_) - 1));
+  }
+
+  SizeType size_{};
+  ValueType universe_{};
+  SizeType lower_bits_{};
+  std::vector<std::uint64_t> lower_;
+  BitsetType upper_;
+  std::vector<SizeType> ones_;
+  std::vector<SizeType> zeros_;
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
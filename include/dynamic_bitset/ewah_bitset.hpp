@@ -0,0 +1,753 @@
+/**
+ * @file dynamic_bitset/ewah_bitset.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Word-aligned run-length compressed bitmap (EWAH)
+ * @defgroup ewah-bitset EWAH bitset
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::min */
+#include <bit>       /* std::popcount, std::endian */
+#include <cstdint>   /* std::uint64_t */
+#include <cstring>   /* std::memcpy, std::memset */
+#include <limits>    /* std::numeric_limits */
+#include <memory>    /* std::allocator */
+#include <stdexcept> /* std::invalid_argument */
+#include <vector>    /* std::vector */
+
+namespace bits {
+
+/**
+ * @brief Append-only bitmap compressed with Enhanced Word-Aligned Hybrid (EWAH) scheme.
+ * @details The bits are split into 64-bit words. Words with all bits equal (clean words)
+ *          are collapsed into runs and other words (literals) are stored verbatim.
+ *          The stream is a sequence of marker words, each followed by its literal words:
+ *
+ *          | bits 0 | bits 1..32 | bits 33..63 |
+ *          | :---: | :---: | :---: |
+ *          | run value | run length in words | number of literals after the run |
+ *
+ *          Bitwise operations and population count walk both streams at once and
+ *          process a whole run in O(1), so their cost is proportional to the compressed size.
+ *          The last incomplete word is kept uncompressed until it is filled by appends.
+ * @ingroup ewah-bitset
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::EwahBitset flags;
+ * flags.AppendRun(false, 1'000'000);
+ * flags.PushBack(true);
+ * flags.Count();        // 1
+ * flags.MemoryUsage();  // A few words instead of ~122KB
+ * @endcode
+ */
+class EwahBitset {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using value_type = bool;
+  using ValueType = value_type;
+  using word_type = std::uint64_t;
+  using WordType = word_type;
+
+ private:
+  /**
+   * @internal
+   * @brief Layout of the marker word.
+   */
+  struct MarkerInfo {
+    static constexpr SizeType kWordBits{64};
+    static constexpr SizeType kWordDivConst{6};
+    static constexpr SizeType kWordModConst{kWordBits - 1};
+    static constexpr WordType kClean{std::numeric_limits<WordType>::max()};
+    static constexpr WordType kRunBit{1};
+    static constexpr SizeType kRunLengthShift{1};
+    static constexpr WordType kMaxRunLength{(WordType{1} << 32) - 1};
+    static constexpr SizeType kLiteralsShift{33};
+    static constexpr WordType kMaxLiterals{(WordType{1} << 31) - 1};
+  };
+
+  [[nodiscard]] static constexpr func RunBit(WordType marker) noexcept -> bool { return marker & MarkerInfo::kRunBit; }
+
+  [[nodiscard]] static constexpr func RunLength(WordType marker) noexcept -> SizeType {
+    return static_cast<SizeType>(marker >> MarkerInfo::kRunLengthShift & MarkerInfo::kMaxRunLength);
+  }
+
+  [[nodiscard]] static constexpr func Literals(WordType marker) noexcept -> SizeType {
+    return static_cast<SizeType>(marker >> MarkerInfo::kLiteralsShift);
+  }
+
+  [[nodiscard]] static constexpr func Fill(bool value) noexcept -> WordType { return value ? MarkerInfo::kClean : 0; }
+
+  /**
+   * @internal
+   * @brief Sequential reader of the compressed stream.
+   * @details The current segment is either a run (`InRun()`) or a sequence of literals,
+   *          `Available()` returns the number of words left in the segment.
+   */
+  class Cursor {
+   public:
+    explicit constexpr Cursor(const std::vector<WordType>& buffer) noexcept
+      : word_{buffer.data()}, end_{buffer.data() + buffer.size()} {
+      Load();
+    }
+
+    [[nodiscard]] constexpr func Done() const noexcept -> bool { return !run_ && !literals_; }
+
+    [[nodiscard]] constexpr func InRun() const noexcept -> bool { return run_; }
+
+    [[nodiscard]] constexpr func RunValue() const noexcept -> bool { return run_value_; }
+
+    [[nodiscard]] constexpr func Available() const noexcept -> SizeType { return run_ ? run_ : literals_; }
+
+    [[nodiscard]] constexpr func Words() const noexcept -> const WordType* { return word_; }
+
+    /**
+     * @brief Skips `count` words of the current segment, `count <= Available()`.
+     */
+    constexpr func Advance(SizeType count) noexcept -> void {
+      if (run_) {
+        run_ -= count;
+      } else {
+        word_ += count;
+        literals_ -= count;
+      }
+      if (!run_ && !literals_) {
+        Load();
+      }
+    }
+
+   private:
+    constexpr func Load() noexcept -> void {
+      while (!run_ && !literals_ && word_ != end_) {
+        const WordType marker{*word_++};
+        run_value_ = RunBit(marker);
+        run_ = RunLength(marker);
+        literals_ = Literals(marker);
+      }
+    }
+
+   private:
+    const WordType* word_;
+    const WordType* end_;
+    SizeType run_{};
+    SizeType literals_{};
+    bool run_value_{};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs empty `EwahBitset`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  EwahBitset() noexcept = default;
+
+  /**
+   * @public
+   * @brief Compresses the content of `DynamicBitset`.
+   * @details The source is read word by word, consecutive clean words are merged into one run.
+   *
+   * @tparam Block Unsigned integral type used for bit storage of `bits`.
+   * @tparam Allocator Allocator type of `bits`.
+   * @param[in] bits Source `DynamicBitset` object.
+   * @return `EwahBitset` with the same `Size()` and set bits.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset flat{1 << 20, 0b1011};
+   * auto compressed{bits::EwahBitset::Compress(flat)}; // Size() == 1 << 20, Count() == 3
+   * @endcode
+   */
+  template<typename Block, typename Allocator>
+  [[nodiscard]] static func Compress(const DynamicBitset<Block, Allocator>& bits) -> EwahBitset {
+    static_assert(std::numeric_limits<Block>::digits <= 64, "Block must not be wider than 64 bits");
+
+    constexpr SizeType kBlockBits{std::numeric_limits<Block>::digits};
+    constexpr SizeType kBlocksPerWord{MarkerInfo::kWordBits / kBlockBits};
+    const Block* data{bits.Data()};
+    const auto load{[data](SizeType first_block, SizeType block_count) noexcept -> WordType {
+      WordType word{};
+      if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(&word, data + first_block, block_count * sizeof(Block));
+      } else {
+        for (SizeType block{}; block < block_count; ++block) {
+          word |= WordType{data[first_block + block]} << (block * kBlockBits & MarkerInfo::kWordModConst);
+        }
+      }
+      return word;
+    }};
+
+    EwahBitset compressed;
+    const SizeType words{bits.Size() >> MarkerInfo::kWordDivConst};
+    // Upper bound of the stream size, the excess is released at the end
+    compressed.buffer_.reserve(words + words / MarkerInfo::kMaxLiterals + 1);
+    for (SizeType word{}; word < words;) {
+      const WordType value{load(word * kBlocksPerWord, kBlocksPerWord)};
+      if (value && value != MarkerInfo::kClean) {
+        compressed.AddWord(value);
+        ++word;
+        continue;
+      }
+
+      SizeType run{1};
+      while (word + run < words && load((word + run) * kBlocksPerWord, kBlocksPerWord) == value) {
+        ++run;
+      }
+      compressed.AddRun(value, run);
+      word += run;
+    }
+
+    compressed.buffer_.shrink_to_fit();
+    compressed.bits_ = bits.Size();
+    if (const SizeType tail_bits{bits.Size() & MarkerInfo::kWordModConst}; tail_bits) {
+      // Bits past Size() in the last block are unspecified
+      compressed.tail_ = load(words * kBlocksPerWord, (tail_bits + kBlockBits - 1) / kBlockBits) &
+                         ~(MarkerInfo::kClean << tail_bits);
+    }
+    return compressed;
+  }
+
+  /**
+   * @public
+   * @brief Decompresses the content into a new `DynamicBitset`.
+   *
+   * @tparam Block Unsigned integral type used for bit storage of the result.
+   * @tparam Allocator Allocator type of the result.
+   * @param[in] allocator Allocator used by the result.
+   * @return `DynamicBitset` with `Size()` bits equal to the content of `this` object.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  template<typename Block = std::size_t, typename Allocator = std::allocator<Block>>
+  [[nodiscard]] func Decompress(const Allocator& allocator = Allocator{}) const -> DynamicBitset<Block, Allocator> {
+    static_assert(std::numeric_limits<Block>::digits <= 64, "Block must not be wider than 64 bits");
+
+    constexpr SizeType kBlockBits{std::numeric_limits<Block>::digits};
+    constexpr SizeType kBlocksPerWord{MarkerInfo::kWordBits / kBlockBits};
+    DynamicBitset<Block, Allocator> bits(bits_, 0, allocator);
+    Block* data{bits.Data()};
+    const auto store{[data](SizeType first_block, SizeType block_count, WordType word) noexcept -> void {
+      if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(data + first_block, &word, block_count * sizeof(Block));
+      } else {
+        for (SizeType block{}; block < block_count; ++block) {
+          data[first_block + block] = static_cast<Block>(word >> (block * kBlockBits & MarkerInfo::kWordModConst));
+        }
+      }
+    }};
+
+    SizeType word{};
+    for (Cursor cursor{buffer_}; !cursor.Done(); cursor.Advance(cursor.Available())) {
+      const SizeType count{cursor.Available()};
+      if (!cursor.InRun()) {
+        for (SizeType literal{}; literal < count; ++literal) {
+          store((word + literal) * kBlocksPerWord, kBlocksPerWord, cursor.Words()[literal]);
+        }
+      } else if (cursor.RunValue()) {
+        if constexpr (std::endian::native == std::endian::little) {
+          std::memset(data + word * kBlocksPerWord, 0xFF, count * sizeof(WordType));
+        } else {
+          for (SizeType filled{}; filled < count; ++filled) {
+            store((word + filled) * kBlocksPerWord, kBlocksPerWord, MarkerInfo::kClean);
+          }
+        }
+      }
+      word += count;
+    }
+
+    if (const SizeType tail_bits{bits_ & MarkerInfo::kWordModConst}; tail_bits) {
+      store(word * kBlocksPerWord, (tail_bits + kBlockBits - 1) / kBlockBits, tail_);
+    }
+    return bits;
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of bits.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Size() const noexcept -> SizeType { return bits_; }
+
+  /**
+   * @public
+   * @brief Checks if the `EwahBitset` has no bits (`Size() == 0`).
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Empty() const noexcept -> bool { return !bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of set bits.
+   * @note Complexity: O(m + l), where m is the number of markers and l is the number of literal words.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Count() const noexcept -> SizeType {
+    SizeType count{static_cast<SizeType>(std::popcount(tail_))};
+    for (Cursor cursor{buffer_}; !cursor.Done(); cursor.Advance(cursor.Available())) {
+      if (cursor.InRun()) {
+        count += cursor.RunValue() ? cursor.Available() << MarkerInfo::kWordDivConst : 0;
+        continue;
+      }
+      for (SizeType literal{}; literal < cursor.Available(); ++literal) {
+        count += static_cast<SizeType>(std::popcount(cursor.Words()[literal]));
+      }
+    }
+    return count;
+  }
+
+  /**
+   * @public
+   * @brief Checks if any bit is set.
+   * @note Complexity: O(m), literal words are never zero.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Any() const noexcept -> bool {
+    if (tail_) {
+      return true;
+    }
+    for (Cursor cursor{buffer_}; !cursor.Done(); cursor.Advance(cursor.Available())) {
+      if (!cursor.InRun() || cursor.RunValue()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @public
+   * @brief Checks if none of the bits is set.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func None() const noexcept -> bool { return !Any(); }
+
+  /**
+   * @public
+   * @brief Checks if all bits are set. Returns `false` for empty object like `DynamicBitset::All()`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func All() const noexcept -> bool { return bits_ && Count() == bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of bytes owned by the object including the compressed stream.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func MemoryUsage() const noexcept -> SizeType {
+    return sizeof(*this) + buffer_.capacity() * sizeof(WordType);
+  }
+
+  /**
+   * @public
+   * @brief Appends the bit with `value` to the end.
+   * @note Complexity: amortized O(1).
+   *
+   * @param[in] value The boolean value `true/false`.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func PushBack(bool value) -> void { AppendBits(value, 1); }
+
+  /**
+   * @public
+   * @brief Appends `count` lowest bits of `bits` to the end, starting with the least significant one.
+   * @details Higher bits of `bits` are ignored.
+   *
+   * @param[in] bits Word with bits to append.
+   * @param[in] count Number of bits to append, `count <= 64`.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   *
+   * @warning **Undefined Behaviour** if `count > 64`.
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::EwahBitset flags;
+   * flags.AppendBits(0b1101, 3); // 1, 0, 1
+   * @endcode
+   */
+  func AppendBits(WordType bits, SizeType count) -> void {
+    BITS_DYNAMIC_BITSET_ASSERT(count <= MarkerInfo::kWordBits);
+
+    if (!count) {
+      return;
+    }
+
+    const SizeType offset{bits_ & MarkerInfo::kWordModConst};
+    if (count < MarkerInfo::kWordBits) {
+      bits &= ~(MarkerInfo::kClean << count);
+    }
+    tail_ |= bits << offset;
+    bits_ += count;
+
+    if (offset + count >= MarkerInfo::kWordBits) {
+      AddWord(tail_);
+      tail_ = offset ? bits >> (MarkerInfo::kWordBits - offset) : 0;
+    }
+  }
+
+  /**
+   * @public
+   * @brief Appends `count` bits with `value` to the end.
+   * @note Complexity: O(1) amortized for whole words, a run of any length costs at most one marker.
+   *
+   * @param[in] value The boolean value `true/false`.
+   * @param[in] count Number of bits to append.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func AppendRun(bool value, SizeType count) -> void {
+    if (const SizeType offset{bits_ & MarkerInfo::kWordModConst}; offset) {
+      const SizeType head{std::min(count, MarkerInfo::kWordBits - offset)};
+      AppendBits(Fill(value), head);
+      count -= head;
+    }
+
+    const SizeType words{count >> MarkerInfo::kWordDivConst};
+    AddRun(Fill(value), words);
+    bits_ += words << MarkerInfo::kWordDivConst;
+    AppendBits(Fill(value), count & MarkerInfo::kWordModConst);
+  }
+
+  /**
+   * @public
+   * @brief Removes all bits and releases memory (`Size() == 0`).
+   *
+   * @throws None (no-throw guarantee).
+   */
+  func Clear() noexcept -> void {
+    buffer_ = std::vector<WordType>{};
+    marker_ = 0;
+    bits_ = 0;
+    tail_ = 0;
+  }
+
+  /**
+   * @public
+   * @brief Releases unused capacity of the compressed stream.
+   *
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func ShrinkToFit() -> void { buffer_.shrink_to_fit(); }
+
+  /**
+   * @public
+   * @brief Performs bitwise AND operation on all bits without decompression.
+   *
+   * @param[in] other Another `EwahBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func operator&=(const EwahBitset& other) -> EwahBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::EwahBitset::operator&=(): invalid storage size"};
+    }
+
+    *this = Combine(*this, other, [](WordType lhs, WordType rhs) noexcept -> WordType { return lhs & rhs; });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Performs bitwise OR operation on all bits without decompression.
+   *
+   * @param[in] other Another `EwahBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func operator|=(const EwahBitset& other) -> EwahBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::EwahBitset::operator|=(): invalid storage size"};
+    }
+
+    *this = Combine(*this, other, [](WordType lhs, WordType rhs) noexcept -> WordType { return lhs | rhs; });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Performs bitwise XOR operation on all bits without decompression.
+   *
+   * @param[in] other Another `EwahBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func operator^=(const EwahBitset& other) -> EwahBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::EwahBitset::operator^=(): invalid storage size"};
+    }
+
+    *this = Combine(*this, other, [](WordType lhs, WordType rhs) noexcept -> WordType { return lhs ^ rhs; });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Clears all bits that are set in `other` (`this & ~other`) without decompression.
+   *
+   * @param[in] other Another `EwahBitset` object.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::invalid_argument If `Size() != other.Size()`.
+   * @throws std::bad_alloc If memory allocation fails (std::allocator).
+   */
+  func AndNot(const EwahBitset& other) -> EwahBitset& {
+    if (bits_ != other.bits_) {
+      throw std::invalid_argument{"bits::EwahBitset::AndNot(const EwahBitset&): invalid storage size"};
+    }
+
+    *this = Combine(*this, other, [](WordType lhs, WordType rhs) noexcept -> WordType { return lhs & ~rhs; });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Checks if two objects have equal size and equal bits.
+   * @details The encoding is canonical: clean words are always merged into runs.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func operator==(const EwahBitset& other) const noexcept -> bool {
+    return bits_ == other.bits_ && tail_ == other.tail_ && buffer_ == other.buffer_;
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Starts a new marker word with empty run and no literals.
+   */
+  func NewMarker() -> void {
+    marker_ = buffer_.size();
+    buffer_.push_back(0);
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Appends `count` clean words equal to `fill` to the stream.
+   */
+  func AddRun(WordType fill, SizeType count) -> void {
+    if (!count) {
+      return;
+    }
+
+    const bool value{fill != 0};
+    if (buffer_.empty() || Literals(buffer_[marker_]) ||
+        (RunLength(buffer_[marker_]) && RunBit(buffer_[marker_]) != value)) {
+      NewMarker();
+    }
+
+    for (;;) {
+      WordType& marker{buffer_[marker_]};
+      const SizeType taken{std::min<SizeType>(count, MarkerInfo::kMaxRunLength - RunLength(marker))};
+      // The marker holds no literals and either an empty run or a run of `value`
+      marker = (marker | static_cast<WordType>(value)) + (static_cast<WordType>(taken) << MarkerInfo::kRunLengthShift);
+      count -= taken;
+      if (!count) {
+        return;
+      }
+      NewMarker();
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Appends `count` literal words to the stream, inverted if `invert` is `true`.
+   *
+   * @warning Words must not be clean, otherwise the encoding is not canonical.
+   */
+  func AddLiterals(const WordType* words, SizeType count, bool invert) -> void {
+    const WordType mask{Fill(invert)};
+    if (buffer_.empty()) {
+      NewMarker();
+    }
+
+    while (count) {
+      if (Literals(buffer_[marker_]) == MarkerInfo::kMaxLiterals) {
+        NewMarker();
+      }
+
+      const SizeType taken{std::min<SizeType>(count, MarkerInfo::kMaxLiterals - Literals(buffer_[marker_]))};
+      buffer_[marker_] += static_cast<WordType>(taken) << MarkerInfo::kLiteralsShift;
+      for (SizeType word{}; word < taken; ++word) {
+        buffer_.push_back(words[word] ^ mask);
+      }
+      words += taken;
+      count -= taken;
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Appends one word choosing run or literal encoding.
+   */
+  func AddWord(WordType word) -> void {
+    if (!word || word == MarkerInfo::kClean) {
+      AddRun(word, 1);
+    } else if (!buffer_.empty() && Literals(buffer_[marker_]) < MarkerInfo::kMaxLiterals) {
+      // Fast path: extend the last literal sequence
+      buffer_[marker_] += WordType{1} << MarkerInfo::kLiteralsShift;
+      buffer_.push_back(word);
+    } else {
+      AddLiterals(&word, 1, false);
+    }
+  }
+
+
+  /**
+   * @internal
+   * @private
+   * @brief Applies word `operation` to two streams of equal size segment by segment.
+   * @details Run against run produces one run, run against literals either produces a run
+   *          (absorbing value) or copies the literals as is or inverted. Only literal pairs
+   *          are combined word by word.
+   */
+  template<typename Operation>
+  [[nodiscard]] static func Combine(const EwahBitset& lhs, const EwahBitset& rhs, Operation operation) -> EwahBitset {
+    EwahBitset result;
+    result.buffer_.reserve(std::max(lhs.buffer_.size(), rhs.buffer_.size()));
+
+    Cursor lhs_cursor{lhs.buffer_};
+    Cursor rhs_cursor{rhs.buffer_};
+    while (!lhs_cursor.Done()) {
+      const SizeType count{std::min(lhs_cursor.Available(), rhs_cursor.Available())};
+
+      if (lhs_cursor.InRun() && rhs_cursor.InRun()) {
+        result.AddRun(operation(Fill(lhs_cursor.RunValue()), Fill(rhs_cursor.RunValue())), count);
+      } else if (lhs_cursor.InRun() || rhs_cursor.InRun()) {
+        const bool lhs_run{lhs_cursor.InRun()};
+        const WordType fill{Fill(lhs_run ? lhs_cursor.RunValue() : rhs_cursor.RunValue())};
+        const auto apply{[&](WordType word) noexcept -> WordType {
+          return lhs_run ? operation(fill, word) : operation(word, fill);
+        }};
+        const WordType zeros{apply(0)};
+
+        if (zeros == apply(MarkerInfo::kClean)) {
+          result.AddRun(zeros, count);
+        } else {
+          result.AddLiterals(lhs_run ? rhs_cursor.Words() : lhs_cursor.Words(), count, zeros != 0);
+        }
+      } else {
+        for (SizeType word{}; word < count; ++word) {
+          result.AddWord(operation(lhs_cursor.Words()[word], rhs_cursor.Words()[word]));
+        }
+      }
+
+      lhs_cursor.Advance(count);
+      rhs_cursor.Advance(count);
+    }
+
+    result.bits_ = lhs.bits_;
+    result.tail_ = operation(lhs.tail_, rhs.tail_);
+    return result;
+  }
+
+ private:
+  std::vector<WordType> buffer_;
+  SizeType marker_{};
+  SizeType bits_{};
+  WordType tail_{};
+};
+
+}  // namespace bits
+
+/**
+ * @brief Performs a bitwise AND between two `EwahBitset` objects.
+ * @see bits::EwahBitset::operator&=
+ * @ingroup ewah-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails (std::allocator).
+ */
+[[nodiscard]] inline func operator&(const bits::EwahBitset& lhs, const bits::EwahBitset& rhs) -> bits::EwahBitset {
+  auto bits{lhs};
+  bits &= rhs;
+  return bits;
+}
+
+/**
+ * @brief Performs a bitwise OR between two `EwahBitset` objects.
+ * @see bits::EwahBitset::operator|=
+ * @ingroup ewah-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails (std::allocator).
+ */
+[[nodiscard]] inline func operator|(const bits::EwahBitset& lhs, const bits::EwahBitset& rhs) -> bits::EwahBitset {
+  auto bits{lhs};
+  bits |= rhs;
+  return bits;
+}
+
+/**
+ * @brief Performs a bitwise XOR between two `EwahBitset` objects.
+ * @see bits::EwahBitset::operator^=
+ * @ingroup ewah-bitset
+ *
+ * @throws std::invalid_argument If sizes of operands are different.
+ * @throws std::bad_alloc If memory allocation fails (std::allocator).
+ */
+[[nodiscard]] inline func operator^(const bits::EwahBitset& lhs, const bits::EwahBitset& rhs) -> bits::EwahBitset {
+  auto bits{lhs};
+  bits ^= rhs;
+  return bits;
+}
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
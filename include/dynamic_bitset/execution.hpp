@@ -0,0 +1,483 @@
+/**
+ * @file dynamic_bitset/execution.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Bulk `DynamicBitset` operations taking standard execution policies
+ * @defgroup dynamic-bitset-execution Execution policy overloads
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+// Parallel backend (TBB) headers use `func` as an identifier, include them before the macro definition
+#include <algorithm>   /* std::any_of, std::all_of, std::transform */
+#include <bit>         /* std::popcount */
+#include <concepts>    /* std::unsigned_integral */
+#include <execution>   /* std::is_execution_policy_v */
+#include <functional>  /* std::plus, std::bit_and, std::bit_or, std::bit_xor */
+#include <limits>      /* std::numeric_limits */
+#include <numeric>     /* std::transform_reduce, std::exclusive_scan, std::iota */
+#include <span>        /* std::span */
+#include <stdexcept>   /* std::invalid_argument, std::out_of_range */
+#include <type_traits> /* std::remove_cvref_t */
+#include <vector>      /* std::vector */
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#if !defined(__cpp_lib_parallel_algorithm)
+  #error "dynamic_bitset/execution.hpp requires standard parallel algorithms (__cpp_lib_parallel_algorithm)"
+#endif
+
+namespace __bits_details {
+
+/**
+ * @brief Validates the passed type to be a standard execution policy.
+ * @concept IsExecutionPolicy
+ */
+template<typename Policy>
+concept IsExecutionPolicy = std::is_execution_policy_v<std::remove_cvref_t<Policy>>;
+
+/**
+ * @brief Checks that all bitsets of a binary operation have equal non-zero size.
+ *
+ * @throws std::invalid_argument If sizes differ or bitsets are empty.
+ */
+template<typename Bitset>
+func CheckBinaryOperands(const Bitset& dst, const Bitset& lhs, const Bitset& rhs, const char* message) -> void {
+  if (!(lhs.Size() && lhs.Size() == rhs.Size() && lhs.Size() == dst.Size())) {
+    throw std::invalid_argument{message};
+  }
+}
+
+/**
+ * @brief Number of blocks decoded by one task of the parallel `ToIndices()`.
+ */
+inline constexpr std::size_t kIndicesChunkBlocks{4096};
+
+/**
+ * @brief Returns the numbers of the `ToIndices()` chunks of `bits`, `0` to `chunks - 1`.
+ * @details Parallel algorithms may pass copies of trivially copyable elements, so tasks take the chunk
+ *          number by value instead of deriving it from the element address.
+ */
+template<typename Block, typename Allocator>
+func IndicesChunks(const bits::DynamicBitset<Block, Allocator>& bits) -> std::vector<std::size_t> {
+  const std::size_t blocks{bits.Empty() ? 0 : (bits.Size() - 1) / std::numeric_limits<Block>::digits + 1};
+  std::vector<std::size_t> chunks((blocks + kIndicesChunkBlocks - 1) / kIndicesChunkBlocks);
+  std::iota(chunks.begin(), chunks.end(), std::size_t{});
+  return chunks;
+}
+
+/**
+ * @brief Returns offsets of the first set bit of every chunk in the index output, last element is the total.
+ */
+template<typename Policy, typename Block, typename Allocator>
+func IndicesChunkOffsets(
+  Policy& policy, const bits::DynamicBitset<Block, Allocator>& bits, const std::vector<std::size_t>& chunks
+) -> std::vector<std::size_t> {
+  const std::size_t blocks{bits.Empty() ? 0 : (bits.Size() - 1) / std::numeric_limits<Block>::digits + 1};
+  std::vector<std::size_t> offsets(chunks.size() + 1);
+  const Block* storage{bits.Data()};
+  std::for_each(policy, chunks.begin(), chunks.end(), [&](std::size_t chunk) noexcept -> void {
+    const std::size_t begin{chunk * kIndicesChunkBlocks};
+    const std::size_t end{std::min(begin + kIndicesChunkBlocks, blocks)};
+    std::size_t count{};
+    for (std::size_t block{begin}; block < end; ++block) {
+      const auto mask{block + 1 == blocks ? TailMask<Block>(bits.Size()) : static_cast<Block>(-1)};
+      count += static_cast<std::size_t>(std::popcount(static_cast<Block>(storage[block] & mask)));
+    }
+    offsets[chunk] = count;
+  });
+  std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), std::size_t{});
+  return offsets;
+}
+
+/**
+ * @brief Decodes every chunk of `bits` to `out` at its offset in parallel.
+ */
+template<typename Policy, typename Index, typename Block, typename Allocator>
+func DecodeIndicesChunks(
+  Policy& policy, const bits::DynamicBitset<Block, Allocator>& bits, const std::vector<std::size_t>& chunks,
+  const std::vector<std::size_t>& offsets, Index* out
+) -> void {
+  const std::size_t blocks{bits.Empty() ? 0 : (bits.Size() - 1) / std::numeric_limits<Block>::digits + 1};
+  std::for_each(policy, chunks.begin(), chunks.end(), [&](std::size_t chunk) noexcept -> void {
+    const std::size_t begin{chunk * kIndicesChunkBlocks};
+    DecodeSetBits(bits.Data(), begin, std::min(begin + kIndicesChunkBlocks, blocks), bits.Size(), out + offsets[chunk]);
+  });
+}
+
+/**
+ * @brief Checks that `Index` can represent every bit position of `bits`.
+ */
+template<typename Index, typename Bitset>
+func CheckIndexType(const Bitset& bits, const char* message) -> void {
+  if (!bits.Empty() && bits.Size() - 1 > std::numeric_limits<Index>::max()) [[unlikely]] {
+    throw std::invalid_argument{message};
+  }
+}
+
+}  // namespace __bits_details
+
+namespace bits {
+
+/**
+ * @brief Returns the number of set bits using `policy`.
+ * @details Full blocks are reduced with `std::transform_reduce`, the last block is masked.
+ * @ingroup dynamic-bitset-execution
+ *
+ * @param[in] policy Standard execution policy (`std::execution::seq`, `par`, `par_unseq`, `unseq`).
+ * @param[in] bits Bitset to count.
+ * @return The count of set bits.
+ *
+ * @throws std::bad_alloc If the parallel backend fails to allocate resources.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::DynamicBitset bits(std::size_t{1} << 32);
+ * auto set_bits{bits::Count(std::execution::par_unseq, bits)};
+ * @endcode
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator>
+[[nodiscard]] func Count(Policy&& policy, const DynamicBitset<Block, Allocator>& bits) -> std::size_t {
+  if (bits.Empty()) {
+    return 0;
+  }
+
+  const Block* storage{bits.Data()};
+  const std::size_t last_block{bits.NumBlocks() - 1};
+  const std::size_t full_count{std::transform_reduce(
+    std::forward<Policy>(policy),
+    storage,
+    storage + last_block,
+    std::size_t{},
+    std::plus<>{},
+    [](Block block) noexcept -> std::size_t { return static_cast<std::size_t>(std::popcount(block)); }
+  )};
+  return full_count +
+         static_cast<std::size_t>(std::popcount(static_cast<Block>(
+           storage[last_block] & __bits_details::TailMask<Block>(bits.Size())
+         )));
+}
+
+/**
+ * @brief Checks if any bit is set using `policy`.
+ * @ingroup dynamic-bitset-execution
+ *
+ * @return `true` if at least one bit is set, `false` otherwise or if `bits` is empty.
+ *
+ * @throws std::bad_alloc If the parallel backend fails to allocate resources.
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator>
+[[nodiscard]] func Any(Policy&& policy, const DynamicBitset<Block, Allocator>& bits) -> bool {
+  if (bits.Empty()) {
+    return false;
+  }
+
+  const Block* storage{bits.Data()};
+  const std::size_t last_block{bits.NumBlocks() - 1};
+  if (storage[last_block] & __bits_details::TailMask<Block>(bits.Size())) {
+    return true;
+  }
+  return std::any_of(std::forward<Policy>(policy), storage, storage + last_block, [](Block block) noexcept -> bool {
+    return block;
+  });
+}
+
+/**
+ * @brief Checks if no bit is set using `policy`.
+ * @ingroup dynamic-bitset-execution
+ *
+ * @return `true` if all bits are unset or `bits` is empty, `false` otherwise.
+ *
+ * @throws std::bad_alloc If the parallel backend fails to allocate resources.
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator>
+[[nodiscard]] func None(Policy&& policy, const DynamicBitset<Block, Allocator>& bits) -> bool {
+  return !Any(std::forward<Policy>(policy), bits);
+}
+
+/**
+ * @brief Checks if all bits are set using `policy`.
+ * @ingroup dynamic-bitset-execution
+ *
+ * @return `true` if all bits are set, `false` otherwise or if `bits` is empty.
+ *
+ * @throws std::bad_alloc If the parallel backend fails to allocate resources.
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator>
+[[nodiscard]] func All(Policy&& policy, const DynamicBitset<Block, Allocator>& bits) -> bool {
+  if (bits.Empty()) {
+    return false;
+  }
+
+  const Block* storage{bits.Data()};
+  const std::size_t last_block{bits.NumBlocks() - 1};
+  const auto tail_mask{__bits_details::TailMask<Block>(bits.Size())};
+  if ((storage[last_block] & tail_mask) != tail_mask) {
+    return false;
+  }
+  return std::all_of(std::forward<Policy>(policy), storage, storage + last_block, [](Block block) noexcept -> bool {
+    return block == static_cast<Block>(-1);
+  });
+}
+
+/**
+ * @brief Applies `operation` to every block of `src` and stores results in `dst` using `policy`.
+ * @details `dst` may be `src`. Bits past `Size()` in the last block of `dst` are unspecified.
+ * @ingroup dynamic-bitset-execution
+ *
+ * @param[in] policy Standard execution policy.
+ * @param[out] dst Destination bitset of the same size as `src`.
+ * @param[in] src Source bitset.
+ * @param[in] operation Callable `(Block) -> Block`.
+ * @return Lvalue reference to `dst`.
+ *
+ * @throws std::invalid_argument If `dst` and `src` sizes differ or they are empty.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * // Same as bits.Flip()
+ * bits::Transform(std::execution::par, bits, bits, std::bit_not<>{});
+ * @endcode
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator, typename Operation>
+func Transform(
+  Policy&& policy,
+  DynamicBitset<Block, Allocator>& dst,
+  const DynamicBitset<Block, Allocator>& src,
+  Operation operation
+) -> DynamicBitset<Block, Allocator>& {
+  __bits_details::CheckBinaryOperands(
+    dst, src, src, "bits::Transform(policy, dst, src, operation): invalid storage size"
+  );
+
+  std::transform(
+    std::forward<Policy>(policy),
+    src.Data(),
+    src.Data() + src.NumBlocks(),
+    dst.Data(),
+    [&operation](Block block) -> Block { return static_cast<Block>(operation(block)); }
+  );
+  return dst;
+}
+
+/**
+ * @brief Applies `operation` to every pair of blocks of `lhs` and `rhs` and stores results in `dst` using `policy`.
+ * @details `dst` may be `lhs` or `rhs`. Bits past `Size()` in the last block of `dst` are unspecified.
+ * @ingroup dynamic-bitset-execution
+ *
+ * @param[in] policy Standard execution policy.
+ * @param[out] dst Destination bitset.
+ * @param[in] lhs First operand.
+ * @param[in] rhs Second operand.
+ * @param[in] operation Callable `(Block, Block) -> Block`.
+ * @return Lvalue reference to `dst`.
+ *
+ * @throws std::invalid_argument If bitsets are empty or sizes differ.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * // dst = a & ~b
+ * bits::Transform(std::execution::par_unseq, dst, a, b, [](auto x, auto y) { return x & ~y; });
+ * @endcode
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator, typename Operation>
+func Transform(
+  Policy&& policy,
+  DynamicBitset<Block, Allocator>& dst,
+  const DynamicBitset<Block, Allocator>& lhs,
+  const DynamicBitset<Block, Allocator>& rhs,
+  Operation operation
+) -> DynamicBitset<Block, Allocator>& {
+  __bits_details::CheckBinaryOperands(
+    dst, lhs, rhs, "bits::Transform(policy, dst, lhs, rhs, operation): invalid storage size"
+  );
+
+  std::transform(
+    std::forward<Policy>(policy),
+    lhs.Data(),
+    lhs.Data() + lhs.NumBlocks(),
+    rhs.Data(),
+    dst.Data(),
+    [&operation](Block lhs_block, Block rhs_block) -> Block {
+      return static_cast<Block>(operation(lhs_block, rhs_block));
+    }
+  );
+  return dst;
+}
+
+/**
+ * @brief Stores `lhs & rhs` in `dst` using `policy`.
+ * @see Transform()
+ * @ingroup dynamic-bitset-execution
+ *
+ * @throws std::invalid_argument If bitsets are empty or sizes differ.
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator>
+func And(
+  Policy&& policy,
+  DynamicBitset<Block, Allocator>& dst,
+  const DynamicBitset<Block, Allocator>& lhs,
+  const DynamicBitset<Block, Allocator>& rhs
+) -> DynamicBitset<Block, Allocator>& {
+  __bits_details::CheckBinaryOperands(dst, lhs, rhs, "bits::And(policy, dst, lhs, rhs): invalid storage size");
+  return Transform(std::forward<Policy>(policy), dst, lhs, rhs, std::bit_and<Block>{});
+}
+
+/**
+ * @brief Stores `lhs | rhs` in `dst` using `policy`.
+ * @see Transform()
+ * @ingroup dynamic-bitset-execution
+ *
+ * @throws std::invalid_argument If bitsets are empty or sizes differ.
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator>
+func Or(
+  Policy&& policy,
+  DynamicBitset<Block, Allocator>& dst,
+  const DynamicBitset<Block, Allocator>& lhs,
+  const DynamicBitset<Block, Allocator>& rhs
+) -> DynamicBitset<Block, Allocator>& {
+  __bits_details::CheckBinaryOperands(dst, lhs, rhs, "bits::Or(policy, dst, lhs, rhs): invalid storage size");
+  return Transform(std::forward<Policy>(policy), dst, lhs, rhs, std::bit_or<Block>{});
+}
+
+/**
+ * @brief Stores `lhs ^ rhs` in `dst` using `policy`.
+ * @see Transform()
+ * @ingroup dynamic-bitset-execution
+ *
+ * @throws std::invalid_argument If bitsets are empty or sizes differ.
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator>
+func Xor(
+  Policy&& policy,
+  DynamicBitset<Block, Allocator>& dst,
+  const DynamicBitset<Block, Allocator>& lhs,
+  const DynamicBitset<Block, Allocator>& rhs
+) -> DynamicBitset<Block, Allocator>& {
+  __bits_details::CheckBinaryOperands(dst, lhs, rhs, "bits::Xor(policy, dst, lhs, rhs): invalid storage size");
+  return Transform(std::forward<Policy>(policy), dst, lhs, rhs, std::bit_xor<Block>{});
+}
+
+/**
+ * @brief Stores `lhs & ~rhs` in `dst` using `policy`.
+ * @see Transform()
+ * @ingroup dynamic-bitset-execution
+ *
+ * @throws std::invalid_argument If bitsets are empty or sizes differ.
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator>
+func AndNot(
+  Policy&& policy,
+  DynamicBitset<Block, Allocator>& dst,
+  const DynamicBitset<Block, Allocator>& lhs,
+  const DynamicBitset<Block, Allocator>& rhs
+) -> DynamicBitset<Block, Allocator>& {
+  __bits_details::CheckBinaryOperands(dst, lhs, rhs, "bits::AndNot(policy, dst, lhs, rhs): invalid storage size");
+  return Transform(std::forward<Policy>(policy), dst, lhs, rhs, [](Block lhs_block, Block rhs_block) noexcept -> Block {
+    return static_cast<Block>(lhs_block & ~rhs_block);
+  });
+}
+
+/**
+ * @brief Writes indices of all set bits of `bits` to `out` in increasing order using `policy`.
+ * @details Set bits are counted per chunk of blocks, an exclusive scan of the counts gives every chunk
+ *          its output offset, then chunks are decoded independently (VPCOMPRESS with AVX-512F).
+ * @see DynamicBitset::ToIndices()
+ * @ingroup dynamic-bitset-execution
+ *
+ * @param[in] policy Standard execution policy.
+ * @param[in] bits Bitset to decode.
+ * @param[out] out Destination span, must have room for `bits.Count()` indices.
+ * @return Number of written indices.
+ *
+ * @throws std::invalid_argument If `Index` can not represent `bits.Size() - 1`.
+ * @throws std::out_of_range If `out` is too small.
+ * @throws std::bad_alloc If the chunk offsets or the parallel backend fail to allocate.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * std::vector<std::uint32_t> indices(bits.Count());
+ * bits::ToIndices(std::execution::par, bits, std::span{indices});
+ * @endcode
+ */
+template<__bits_details::IsExecutionPolicy Policy, typename Block, typename Allocator, std::unsigned_integral Index>
+func ToIndices(Policy&& policy, const DynamicBitset<Block, Allocator>& bits, std::span<Index> out) -> std::size_t {
+  __bits_details::CheckIndexType<Index>(bits, "bits::ToIndices(policy, bits, out): index type is too narrow");
+  const auto chunks{__bits_details::IndicesChunks(bits)};
+  const auto offsets{__bits_details::IndicesChunkOffsets(policy, bits, chunks)};
+  if (offsets.back() > out.size()) [[unlikely]] {
+    throw std::out_of_range{"bits::ToIndices(policy, bits, out): output span is too small"};
+  }
+
+  __bits_details::DecodeIndicesChunks(policy, bits, chunks, offsets, out.data());
+  return offsets.back();
+}
+
+/**
+ * @brief Returns indices of all set bits of `bits` in increasing order using `policy`.
+ * @see ToIndices(Policy&&, const DynamicBitset<Block, Allocator>&, std::span<Index>)
+ * @ingroup dynamic-bitset-execution
+ *
+ * @tparam Index Unsigned integral type of the indices, `std::size_t` by default.
+ *
+ * @throws std::invalid_argument If `Index` can not represent `bits.Size() - 1`.
+ * @throws std::bad_alloc If the result, the chunk offsets or the parallel backend fail to allocate.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * auto indices{bits::ToIndices<std::uint32_t>(std::execution::par_unseq, bits)};
+ * @endcode
+ */
+template<
+  std::unsigned_integral Index = std::size_t,
+  __bits_details::IsExecutionPolicy Policy,
+  typename Block,
+  typename Allocator>
+[[nodiscard]] func ToIndices(Policy&& policy, const DynamicBitset<Block, Allocator>& bits) -> std::vector<Index> {
+  __bits_details::CheckIndexType<Index>(bits, "bits::ToIndices(policy, bits): index type is too narrow");
+  const auto chunks{__bits_details::IndicesChunks(bits)};
+  const auto offsets{__bits_details::IndicesChunkOffsets(policy, bits, chunks)};
+
+  std::vector<Index> result(offsets.back());
+  __bits_details::DecodeIndicesChunks(policy, bits, chunks, offsets, result.data());
+  return result;
+}
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
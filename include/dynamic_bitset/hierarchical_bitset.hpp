@@ -0,0 +1,432 @@
+/**
+ * @file dynamic_bitset/hierarchical_bitset.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Bitset with 64-ary summary levels for fast searches in sparse sets
+ * @defgroup hierarchical-bitset Hierarchical bitset
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::fill, std::min */
+#include <bit>       /* std::countr_zero, std::countl_zero */
+#include <cstdint>   /* std::uint64_t */
+#include <limits>    /* std::numeric_limits */
+#include <stdexcept> /* std::out_of_range */
+#include <utility>   /* std::move */
+#include <vector>    /* std::vector */
+
+namespace bits {
+
+/**
+ * @brief `DynamicBitset` with summary levels above it, bit `i` of a level means "word `i` below is non-zero".
+ * @details Level 0 summarizes the blocks of the underlying bitset, every next level summarizes 64 words of
+ *          the previous one, up to a single top word. `Set()` and `Reset()` update summaries only while a
+ *          word changes between zero and non-zero. Searches climb until a summary word has a candidate bit
+ *          and descend with one `std::countr_zero` per level, so empty regions are skipped without being
+ *          read. Every level divides the number of words by 64: with 64-bit blocks 2^24 bits take 3 levels,
+ *          2^30 bits take 4 levels and 2^32 bits take 5 levels.
+ * @ingroup hierarchical-bitset
+ *
+ * @tparam Block Unsigned integral type used for bit storage.
+ * @tparam Allocator Allocator of blocks.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::HierarchicalBitset<> bits{std::size_t{1} << 32};
+ * bits.Set(7, true).Set(3'000'000'000, true);
+ * auto next{bits.FindNext(7)};             // next == 3'000'000'000
+ * auto prev{bits.FindPrev(3'000'000'000)}; // prev == 7
+ * @endcode
+ */
+template<
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class HierarchicalBitset {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using BitsetType = DynamicBitset<BlockType, Allocator>;
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kSummaryBits{64};
+    static constexpr SizeType kSummaryShift{6};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kSet{static_cast<BlockType>(-1)};
+    static constexpr std::uint64_t kSummarySet{~std::uint64_t{}};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs an empty bitset.
+   */
+  HierarchicalBitset() = default;
+
+  /**
+   * @public
+   * @brief Constructs a bitset of `bits` unset bits.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit HierarchicalBitset(SizeType bits) : bits_(bits) { Build(); }
+
+  /**
+   * @public
+   * @brief Constructs summaries for a copy of `bits`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit HierarchicalBitset(BitsetType bits) : bits_{std::move(bits)} {
+    if (!bits_.Empty()) {
+      bits_.Data()[Words() - 1] &= __bits_details::TailMask<BlockType>(bits_.Size());
+    }
+    Build();
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of bits.
+   */
+  [[nodiscard]] func Size() const noexcept -> SizeType { return bits_.Size(); }
+
+  /**
+   * @public
+   * @brief Returns the number of summary levels.
+   */
+  [[nodiscard]] func Levels() const noexcept -> SizeType { return levels_.size(); }
+
+  /**
+   * @public
+   * @brief Returns the underlying bitset.
+   */
+  [[nodiscard]] func Bitset() const noexcept -> const BitsetType& { return bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of set bits.
+   */
+  [[nodiscard]] func Count() const noexcept -> SizeType { return bits_.Count(); }
+
+  /**
+   * @public
+   * @brief Checks if any bit is set, reads only the top summary word.
+   */
+  [[nodiscard]] func Any() const noexcept -> bool { return !levels_.empty() && levels_.back().front(); }
+
+  /**
+   * @public
+   * @brief Checks if no bit is set, reads only the top summary word.
+   */
+  [[nodiscard]] func None() const noexcept -> bool { return !Any(); }
+
+  /**
+   * @public
+   * @brief Returns the value of bit with `index`.
+   *
+   * @warning **Undefined Behaviour** if `index >= Size()`.
+   */
+  [[nodiscard]] func Test(SizeType index) const noexcept -> bool { return bits_.Test(index); }
+
+  /**
+   * @public
+   * @brief Set the bit with `index` to `value` and updates the summaries. Implies range check.
+   *
+   * @param[in] index The zero-based index of the bit to set/unset.
+   * @param[in] value The boolean value `true/false`.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func Set(SizeType index, bool value = false) -> HierarchicalBitset& {
+    if (index >= Size()) {
+      throw std::out_of_range{"bits::HierarchicalBitset::Set(SizeType, bool = false): index is out of range"};
+    }
+
+    if (!value) {
+      ResetBit(index);
+      return *this;
+    }
+
+    BlockType& word{bits_.Data()[index / BlockInfo::kBitsCount]};
+    const bool was_empty{!word};
+    word |= static_cast<BlockType>(BlockType{1} << index % BlockInfo::kBitsCount);
+    if (was_empty) {
+      // Mark the word in every level until a summary word was already non-zero
+      SizeType position{index / BlockInfo::kBitsCount};
+      for (std::vector<std::uint64_t>& level : levels_) {
+        std::uint64_t& summary{level[position >> BlockInfo::kSummaryShift]};
+        const std::uint64_t before{summary};
+        summary |= std::uint64_t{1} << (position & (BlockInfo::kSummaryBits - 1));
+        if (before) {
+          break;
+        }
+        position >>= BlockInfo::kSummaryShift;
+      }
+    }
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Set bit with `index` to `false` and updates the summaries. Implies range checking.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  func Reset(SizeType index) -> HierarchicalBitset& {
+    if (index >= Size()) {
+      throw std::out_of_range{"bits::HierarchicalBitset::Reset(SizeType): index is out of range"};
+    }
+
+    ResetBit(index);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Set all bits to `false` keeping `Size()`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  func Reset() noexcept -> HierarchicalBitset& {
+    std::fill(bits_.Data(), bits_.Data() + Words(), BlockType{});
+    for (std::vector<std::uint64_t>& level : levels_) {
+      std::fill(level.begin(), level.end(), std::uint64_t{});
+    }
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Returns the index of the first set bit or `Size()` if there is no such bit.
+   * @see DynamicBitset::FindFirst()
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func FindFirst() const noexcept -> SizeType { return FindFrom(0); }
+
+  /**
+   * @public
+   * @brief Returns the index of the first set bit after `index` or `Size()` if there is no such bit.
+   * @see DynamicBitset::FindNext()
+   *
+   * @param[in] index The zero-based index of the bit to start search after.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func FindNext(SizeType index) const noexcept -> SizeType {
+    return index + 1 < Size() ? FindFrom(index + 1) : Size();
+  }
+
+  /**
+   * @public
+   * @brief Returns the index of the last set bit or `Size()` if there is no such bit.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func FindLast() const noexcept -> SizeType { return FindPrev(Size()); }
+
+  /**
+   * @public
+   * @brief Returns the index of the last set bit before `index` or `Size()` if there is no such bit.
+   *
+   * @param[in] index The zero-based index of the bit to start search before, values past `Size()`
+   *                  search the whole bitset.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func FindPrev(SizeType index) const noexcept -> SizeType {
+    if (!index || !Size()) {
+      return Size();
+    }
+
+    const SizeType last{std::min(index, Size()) - 1};
+    SizeType position{last / BlockInfo::kBitsCount};
+    const auto block{static_cast<BlockType>(
+      bits_.Data()[position] & BitMask::kSet >> (BlockInfo::kBitsCount - 1 - last % BlockInfo::kBitsCount)
+    )};
+    if (block) {
+      return position * BlockInfo::kBitsCount + HighestBit(block);
+    }
+    if (!position) {
+      return Size();
+    }
+
+    // Climb to the first level having a non-zero word at or before the candidate
+    SizeType level{};
+    for (--position;; ++level) {
+      if (level == levels_.size()) {
+        return Size();
+      }
+      const std::uint64_t summary{
+        levels_[level][position >> BlockInfo::kSummaryShift] &
+        BitMask::kSummarySet >> (BlockInfo::kSummaryBits - 1 - (position & (BlockInfo::kSummaryBits - 1)))
+      };
+      if (summary) {
+        position = (position & ~(BlockInfo::kSummaryBits - 1)) + HighestBit(summary);
+        break;
+      }
+      if (position < BlockInfo::kSummaryBits) {
+        return Size();
+      }
+      position = (position >> BlockInfo::kSummaryShift) - 1;
+    }
+
+    while (level) {
+      position = (position << BlockInfo::kSummaryShift) + HighestBit(levels_[--level][position]);
+    }
+    return position * BlockInfo::kBitsCount + HighestBit(bits_.Data()[position]);
+  }
+
+ private:
+  [[nodiscard]] func Words() const noexcept -> SizeType {
+    return (Size() + BlockInfo::kBitsCount - 1) / BlockInfo::kBitsCount;
+  }
+
+  template<typename Word>
+  [[nodiscard]] static func HighestBit(Word word) noexcept -> SizeType {
+    return static_cast<SizeType>(std::numeric_limits<Word>::digits - 1 - std::countl_zero(word));
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Builds every summary level from the underlying blocks.
+   */
+  func Build() -> void {
+    levels_.clear();
+    SizeType words{Words()};
+    if (!words) {
+      return;
+    }
+
+    const auto summarize{[](SizeType words, auto non_zero) -> std::vector<std::uint64_t> {
+      std::vector<std::uint64_t> level((words + BlockInfo::kSummaryBits - 1) / BlockInfo::kSummaryBits);
+      for (SizeType word{}; word < words; ++word) {
+        level[word >> BlockInfo::kSummaryShift] |= static_cast<std::uint64_t>(non_zero(word))
+                                                   << (word & (BlockInfo::kSummaryBits - 1));
+      }
+      return level;
+    }};
+    levels_.push_back(summarize(words, [this](SizeType word) -> bool { return bits_.Data()[word]; }));
+    while (levels_.back().size() > 1) {
+      words = levels_.back().size();
+      const std::uint64_t* below{levels_.back().data()};
+      levels_.push_back(summarize(words, [below](SizeType word) -> bool { return below[word]; }));
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Unsets bit `index` and clears summary bits of words that became zero.
+   */
+  func ResetBit(SizeType index) noexcept -> void {
+    BlockType& word{bits_.Data()[index / BlockInfo::kBitsCount]};
+    word &= static_cast<BlockType>(~(BlockType{1} << index % BlockInfo::kBitsCount));
+    if (word) {
+      return;
+    }
+
+    SizeType position{index / BlockInfo::kBitsCount};
+    for (std::vector<std::uint64_t>& level : levels_) {
+      std::uint64_t& summary{level[position >> BlockInfo::kSummaryShift]};
+      summary &= ~(std::uint64_t{1} << (position & (BlockInfo::kSummaryBits - 1)));
+      if (summary) {
+        break;
+      }
+      position >>= BlockInfo::kSummaryShift;
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns the index of the first set bit in `[index, Size())` or `Size()`.
+   */
+  [[nodiscard]] func FindFrom(SizeType index) const noexcept -> SizeType {
+    if (index >= Size()) {
+      return Size();
+    }
+
+    SizeType position{index / BlockInfo::kBitsCount};
+    const auto block{
+      static_cast<BlockType>(bits_.Data()[position] & BitMask::kSet << index % BlockInfo::kBitsCount)
+    };
+    if (block) {
+      return position * BlockInfo::kBitsCount + static_cast<SizeType>(std::countr_zero(block));
+    }
+
+    // Climb to the first level having a non-zero word after the candidate
+    SizeType level{};
+    for (++position;; ++level) {
+      if (level == levels_.size() || position >= levels_[level].size() * BlockInfo::kSummaryBits) {
+        return Size();
+      }
+      const std::uint64_t summary{
+        levels_[level][position >> BlockInfo::kSummaryShift] &
+        BitMask::kSummarySet << (position & (BlockInfo::kSummaryBits - 1))
+      };
+      if (summary) {
+        position = (position & ~(BlockInfo::kSummaryBits - 1)) + static_cast<SizeType>(std::countr_zero(summary));
+        break;
+      }
+      position = (position >> BlockInfo::kSummaryShift) + 1;
+    }
+
+    while (level) {
+      position = (position << BlockInfo::kSummaryShift) +
+                 static_cast<SizeType>(std::countr_zero(levels_[--level][position]));
+    }
+    return position * BlockInfo::kBitsCount + static_cast<SizeType>(std::countr_zero(bits_.Data()[position]));
+  }
+
+  BitsetType bits_;
+  std::vector<std::vector<std::uint64_t>> levels_;
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
@@ -0,0 +1,458 @@
+/**
+ * @file dynamic_bitset/incremental.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Resumable whole-bitset operations with bounded work per step
+ * @defgroup dynamic-bitset-incremental Incremental operations
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm>   /* std::min */
+#include <bit>         /* std::countr_zero, std::popcount */
+#include <coroutine>   /* std::coroutine_handle, std::suspend_always */
+#include <cstddef>     /* std::ptrdiff_t */
+#include <exception>   /* std::exception_ptr, std::current_exception, std::rethrow_exception */
+#include <iterator>    /* std::default_sentinel_t, std::input_iterator_tag */
+#include <limits>      /* std::numeric_limits */
+#include <memory>      /* std::addressof */
+#include <stdexcept>   /* std::invalid_argument, std::out_of_range */
+#include <string>      /* std::string */
+#include <string_view> /* std::string_view */
+#include <utility>     /* std::exchange, std::move */
+
+namespace bits {
+
+/**
+ * @brief Minimal synchronous generator, an input range of values produced by `co_yield`.
+ * @details Subset of C++23 `std::generator` which is not available in all supported standard libraries.
+ *          Yielded values are referenced, not copied, and stay valid until the next increment.
+ *          Exceptions thrown by the coroutine body are rethrown from `begin()` and `operator++`.
+ * @ingroup dynamic-bitset-incremental
+ *
+ * @tparam T Type of yielded values.
+ */
+template<typename T>
+class Generator {
+ public:
+  /**
+   * @brief Coroutine promise, required by the language.
+   */
+  class promise_type {
+   public:
+    func get_return_object() noexcept -> Generator {
+      return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    func initial_suspend() noexcept -> std::suspend_always { return {}; }
+
+    func final_suspend() noexcept -> std::suspend_always { return {}; }
+
+    func yield_value(const T& value) noexcept -> std::suspend_always {
+      value_ = std::addressof(value);
+      return {};
+    }
+
+    func return_void() noexcept -> void { }
+
+    func unhandled_exception() noexcept -> void { exception_ = std::current_exception(); }
+
+   private:
+    friend class Generator;
+
+    const T* value_{};
+    std::exception_ptr exception_;
+  };
+
+  /**
+   * @brief Input iterator over yielded values.
+   */
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+
+    [[nodiscard]] func operator*() const noexcept -> const T& { return *handle_.promise().value_; }
+
+    func operator++() -> Iterator& {
+      Resume(handle_);
+      return *this;
+    }
+
+    func operator++(int) -> void { ++*this; }
+
+    [[nodiscard]] friend func operator==(const Iterator& iterator, std::default_sentinel_t) noexcept -> bool {
+      return iterator.handle_.done();
+    }
+
+   private:
+    friend class Generator;
+
+    explicit Iterator(std::coroutine_handle<promise_type> handle) noexcept : handle_{handle} { }
+
+    std::coroutine_handle<promise_type> handle_;
+  };
+
+ public:
+  Generator(const Generator&) = delete;
+  func operator=(const Generator&)->Generator& = delete;
+
+  Generator(Generator&& other) noexcept : handle_{std::exchange(other.handle_, nullptr)} { }
+
+  func operator=(Generator&& other) noexcept -> Generator& {
+    if (this != &other) {
+      if (handle_) {
+        handle_.destroy();
+      }
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+
+  ~Generator() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  /**
+   * @brief Runs the coroutine up to the first `co_yield`. Must be called once.
+   *
+   * @throws Any exception thrown by the coroutine body.
+   */
+  [[nodiscard]] func begin() -> Iterator {
+    Resume(handle_);
+    return Iterator{handle_};
+  }
+
+  [[nodiscard]] func end() const noexcept -> std::default_sentinel_t { return std::default_sentinel; }
+
+ private:
+  explicit Generator(std::coroutine_handle<promise_type> handle) noexcept : handle_{handle} { }
+
+  static func Resume(std::coroutine_handle<promise_type> handle) -> void {
+    handle.resume();
+    if (handle.promise().exception_) [[unlikely]] {
+      std::rethrow_exception(std::exchange(handle.promise().exception_, nullptr));
+    }
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+}  // namespace bits
+
+namespace __bits_details {
+
+/**
+ * @brief Throws if `budget` is zero, shared argument check of incremental operations.
+ *
+ * @throws std::invalid_argument If `budget == 0`.
+ */
+inline func CheckBudget(std::size_t budget, const char* message) -> void {
+  if (!budget) [[unlikely]] {
+    throw std::invalid_argument{message};
+  }
+}
+
+template<typename Block, typename Allocator>
+func CountIncrementally(const bits::DynamicBitset<Block, Allocator>& bits, std::size_t budget)
+  -> bits::Generator<std::size_t> {
+  const Block* storage{bits.Data()};
+  const std::size_t blocks{bits.NumBlocks()};
+  std::size_t count{};
+  for (std::size_t block{};;) {
+    const std::size_t end{std::min(blocks, block + budget)};
+    for (; block < end; ++block) {
+      const Block mask{block + 1 == blocks ? TailMask<Block>(bits.Size()) : static_cast<Block>(-1)};
+      count += static_cast<std::size_t>(std::popcount(static_cast<Block>(storage[block] & mask)));
+    }
+    co_yield count;
+    if (block == blocks) {
+      co_return;
+    }
+  }
+}
+
+template<typename Block, typename Allocator, typename Function>
+func ForEachSetBitChunked(const bits::DynamicBitset<Block, Allocator>& bits, std::size_t budget, Function function)
+  -> bits::Generator<std::size_t> {
+  constexpr std::size_t kBitsCount{std::numeric_limits<Block>::digits};
+  const Block* storage{bits.Data()};
+  const std::size_t blocks{bits.NumBlocks()};
+  for (std::size_t block{};;) {
+    const std::size_t end{std::min(blocks, block + budget)};
+    for (; block < end; ++block) {
+      const Block mask{block + 1 == blocks ? TailMask<Block>(bits.Size()) : static_cast<Block>(-1)};
+      for (auto word{static_cast<Block>(storage[block] & mask)}; word; word &= static_cast<Block>(word - 1)) {
+        function(block * kBitsCount + static_cast<std::size_t>(std::countr_zero(word)));
+      }
+    }
+    const std::size_t processed{std::min(bits.Size(), block * kBitsCount)};
+    co_yield processed;
+    if (block == blocks) {
+      co_return;
+    }
+  }
+}
+
+template<typename Block, typename Allocator>
+func ToStringIncrementally(const bits::DynamicBitset<Block, Allocator>& bits, std::size_t budget)
+  -> bits::Generator<std::string_view> {
+  const auto* bytes{reinterpret_cast<const unsigned char*>(bits.Data())};
+  const std::size_t total_bytes{(bits.Size() + 7) >> 3};
+  const std::size_t piece_bytes{budget * sizeof(Block)};
+  std::string piece(std::min(total_bytes, piece_bytes) << 3, '\0');
+  for (std::size_t byte{}; byte < total_bytes; byte += piece_bytes) {
+    const std::size_t count{std::min(total_bytes - byte, piece_bytes)};
+    ExpandBitsToChars(bytes + byte, count, piece.data());
+    const std::string_view view{piece.data(), std::min(count << 3, bits.Size() - (byte << 3))};
+    co_yield view;
+  }
+}
+
+/**
+ * @brief Same result as `DynamicBitset::operator>>=`, bit `i` takes the value of bit `i - offset`.
+ * @details Goes from the last block down, so every source block is read before it is overwritten.
+ */
+template<typename Block, typename Allocator>
+func ShiftRightIncrementally(bits::DynamicBitset<Block, Allocator>& bits, std::size_t offset, std::size_t budget)
+  -> bits::Generator<std::size_t> {
+  constexpr std::size_t kBitsCount{std::numeric_limits<Block>::digits};
+  Block* storage{bits.Data()};
+  const std::size_t blocks{bits.NumBlocks()};
+  const std::size_t block_shift{std::min(offset, bits.Size()) / kBitsCount};
+  const std::size_t bit_shift{offset < bits.Size() ? offset % kBitsCount : 0};
+  const auto source{[&](std::size_t block) noexcept -> Block {
+    return block < blocks ? storage[block] : Block{};
+  }};
+
+  for (std::size_t processed{};;) {
+    const std::size_t end{std::min(blocks, processed + budget)};
+    for (; processed < end; ++processed) {
+      const std::size_t block{blocks - 1 - processed};
+      if (offset >= bits.Size() || block < block_shift) {
+        storage[block] = Block{};
+      } else if (!bit_shift) {
+        storage[block] = storage[block - block_shift];
+      } else {
+        // Unsigned wrap of `block - block_shift - 1` below zero gives an out of range source block
+        storage[block] = static_cast<Block>(
+          static_cast<Block>(storage[block - block_shift] << bit_shift) |
+          static_cast<Block>(source(block - block_shift - 1) >> (kBitsCount - bit_shift))
+        );
+      }
+    }
+    const std::size_t progress{std::min(bits.Size(), processed * kBitsCount)};
+    co_yield progress;
+    if (processed == blocks) {
+      co_return;
+    }
+  }
+}
+
+/**
+ * @brief Same result as `DynamicBitset::operator<<=`, bit `i` takes the value of bit `i + offset`.
+ * @details Goes from the first block up, so every source block is read before it is overwritten.
+ */
+template<typename Block, typename Allocator>
+func ShiftLeftIncrementally(bits::DynamicBitset<Block, Allocator>& bits, std::size_t offset, std::size_t budget)
+  -> bits::Generator<std::size_t> {
+  constexpr std::size_t kBitsCount{std::numeric_limits<Block>::digits};
+  Block* storage{bits.Data()};
+  const std::size_t blocks{bits.NumBlocks()};
+  // Bits past Size() are unspecified and must not be shifted in
+  storage[blocks - 1] &= TailMask<Block>(bits.Size());
+  const std::size_t block_shift{std::min(offset, bits.Size()) / kBitsCount};
+  const std::size_t bit_shift{offset < bits.Size() ? offset % kBitsCount : 0};
+  const auto source{[&](std::size_t block) noexcept -> Block {
+    return block < blocks ? storage[block] : Block{};
+  }};
+
+  for (std::size_t block{};;) {
+    const std::size_t end{std::min(blocks, block + budget)};
+    for (; block < end; ++block) {
+      if (offset >= bits.Size()) {
+        storage[block] = Block{};
+      } else if (!bit_shift) {
+        storage[block] = source(block + block_shift);
+      } else {
+        storage[block] = static_cast<Block>(
+          static_cast<Block>(source(block + block_shift) >> bit_shift) |
+          static_cast<Block>(source(block + block_shift + 1) << (kBitsCount - bit_shift))
+        );
+      }
+    }
+    const std::size_t progress{std::min(bits.Size(), block * kBitsCount)};
+    co_yield progress;
+    if (block == blocks) {
+      co_return;
+    }
+  }
+}
+
+}  // namespace __bits_details
+
+namespace bits {
+
+/**
+ * @brief Counts set bits, `budget` blocks per step.
+ * @ingroup dynamic-bitset-incremental
+ *
+ * @param[in] bits Bitset, must outlive the generator and stay unchanged while it runs.
+ * @param[in] budget Maximal number of blocks processed by one step.
+ * @return Generator of running counts, the last value equals `bits.Count()`. Yields at least once.
+ *
+ * @throws std::invalid_argument If `budget == 0`.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * std::size_t count{};
+ * for (const std::size_t partial : bits::CountIncrementally(huge, 1 << 16)) {
+ *   count = partial;
+ *   event_loop.Poll();
+ * }
+ * @endcode
+ */
+template<typename Block, typename Allocator>
+[[nodiscard]] func CountIncrementally(const DynamicBitset<Block, Allocator>& bits, std::size_t budget)
+  -> Generator<std::size_t> {
+  __bits_details::CheckBudget(budget, "bits::CountIncrementally(const DynamicBitset&, std::size_t): budget is zero");
+  return __bits_details::CountIncrementally(bits, budget);
+}
+
+/**
+ * @brief Calls `function(index)` for every set bit in increasing order, `budget` blocks per step.
+ * @ingroup dynamic-bitset-incremental
+ *
+ * @param[in] bits Bitset, must outlive the generator and stay unchanged while it runs.
+ * @param[in] budget Maximal number of blocks processed by one step.
+ * @param[in] function Callable with `std::size_t` argument, stored in the generator.
+ * @return Generator of the number of bits processed so far, the last value equals `bits.Size()`.
+ *
+ * @throws std::invalid_argument If `budget == 0`.
+ */
+template<typename Block, typename Allocator, typename Function>
+[[nodiscard]] func ForEachSetBitChunked(
+  const DynamicBitset<Block, Allocator>& bits, std::size_t budget, Function function
+) -> Generator<std::size_t> {
+  __bits_details::CheckBudget(
+    budget, "bits::ForEachSetBitChunked(const DynamicBitset&, std::size_t, Function): budget is zero"
+  );
+  return __bits_details::ForEachSetBitChunked(bits, budget, std::move(function));
+}
+
+/**
+ * @brief Produces `bits.ToString()` in pieces of `budget` blocks.
+ * @ingroup dynamic-bitset-incremental
+ *
+ * @param[in] bits Bitset, must outlive the generator and stay unchanged while it runs.
+ * @param[in] budget Maximal number of blocks processed by one step.
+ * @return Generator of consecutive pieces, every piece is valid until the next step.
+ *
+ * @throws std::invalid_argument If `budget == 0`.
+ * @throws std::bad_alloc If allocation of the piece buffer fails.
+ */
+template<typename Block, typename Allocator>
+[[nodiscard]] func ToStringIncrementally(const DynamicBitset<Block, Allocator>& bits, std::size_t budget)
+  -> Generator<std::string_view> {
+  __bits_details::CheckBudget(
+    budget, "bits::ToStringIncrementally(const DynamicBitset&, std::size_t): budget is zero"
+  );
+  return __bits_details::ToStringIncrementally(bits, budget);
+}
+
+/**
+ * @brief Performs `bits >>= offset` in place, `budget` blocks per step.
+ * @ingroup dynamic-bitset-incremental
+ *
+ * @param[in,out] bits Bitset, must outlive the generator and must not be used until it finishes.
+ * @param[in] offset Shift offset, bit `i` takes the value of bit `i - offset`.
+ * @param[in] budget Maximal number of blocks processed by one step.
+ * @return Generator of the number of bits written so far, the last value equals `bits.Size()`.
+ *
+ * @throws std::out_of_range If `bits` is empty, as `operator>>=`.
+ * @throws std::invalid_argument If `budget == 0`.
+ */
+template<typename Block, typename Allocator>
+[[nodiscard]] func ShiftRightIncrementally(
+  DynamicBitset<Block, Allocator>& bits, std::size_t offset, std::size_t budget
+) -> Generator<std::size_t> {
+  if (bits.Empty()) [[unlikely]] {
+    throw std::out_of_range{
+      "bits::ShiftRightIncrementally(DynamicBitset&, std::size_t, std::size_t): invalid storage pointer (nullptr)"
+    };
+  }
+  __bits_details::CheckBudget(
+    budget, "bits::ShiftRightIncrementally(DynamicBitset&, std::size_t, std::size_t): budget is zero"
+  );
+  return __bits_details::ShiftRightIncrementally(bits, offset, budget);
+}
+
+/**
+ * @brief Performs `bits <<= offset` in place, `budget` blocks per step.
+ * @ingroup dynamic-bitset-incremental
+ *
+ * @param[in,out] bits Bitset, must outlive the generator and must not be used until it finishes.
+ * @param[in] offset Shift offset, bit `i` takes the value of bit `i + offset`.
+ * @param[in] budget Maximal number of blocks processed by one step.
+ * @return Generator of the number of bits written so far, the last value equals `bits.Size()`.
+ *
+ * @throws std::out_of_range If `bits` is empty, as `operator<<=`.
+ * @throws std::invalid_argument If `budget == 0`.
+ */
+template<typename Block, typename Allocator>
+[[nodiscard]] func ShiftLeftIncrementally(
+  DynamicBitset<Block, Allocator>& bits, std::size_t offset, std::size_t budget
+) -> Generator<std::size_t> {
+  if (bits.Empty()) [[unlikely]] {
+    throw std::out_of_range{
+      "bits::ShiftLeftIncrementally(DynamicBitset&, std::size_t, std::size_t): invalid storage pointer (nullptr)"
+    };
+  }
+  __bits_details::CheckBudget(
+    budget, "bits::ShiftLeftIncrementally(DynamicBitset&, std::size_t, std::size_t): budget is zero"
+  );
+  return __bits_details::ShiftLeftIncrementally(bits, offset, budget);
+}
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
@@ -0,0 +1,382 @@
+/**
+ * @file dynamic_bitset/partition.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Cache line aligned mutable partitions of `DynamicBitset` for writes from several threads
+ * @defgroup dynamic-bitset-partition Partitions
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::fill, std::for_each, std::min */
+#include <bit>       /* std::popcount */
+#include <cstdint>   /* std::uintptr_t */
+#include <limits>    /* std::numeric_limits */
+#include <stdexcept> /* std::invalid_argument, std::out_of_range */
+#include <vector>    /* std::vector */
+
+namespace bits {
+
+/**
+ * @brief Mutable view of a contiguous range of `DynamicBitset` bits owned by one thread.
+ * @details Created by `Partition()`. Every storage block, and every cache line of the storage,
+ *          belongs to at most one partition, so threads writing through different partitions
+ *          with plain (non-atomic) operations never touch the same word or cache line.
+ *          Indices are positions in the whole bitset, not offsets in the partition.
+ *
+ *          A partition is invalidated by every operation which reallocates or resizes the bitset.
+ * @ingroup dynamic-bitset-partition
+ *
+ * @tparam Block Unsigned integral type used for bit storage.
+ */
+template<__bits_details::IsValidDynamicBitsetBlockType Block = size_t>
+class BitsetPartition {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using block_type = Block;
+  using BlockType = block_type;
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kByteDivConst{kBitsCount < 32 ? sizeof(BlockType) + 2 : kBitsCount == 32 ? 5 : 6};
+    static constexpr SizeType kByteModConst{kBitsCount - 1};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kBit{1};
+    static constexpr BlockType kSet{std::numeric_limits<BlockType>::max()};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs an empty partition.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr BitsetPartition() noexcept = default;
+
+  /**
+   * @public
+   * @brief Constructs partition of bits `[begin, end)` of `storage`.
+   * @details `begin` must be a multiple of the block width unless the partition is empty.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr BitsetPartition(BlockType* storage, SizeType begin, SizeType end) noexcept
+    : storage_{storage}, begin_{begin}, end_{end} {
+    BITS_DYNAMIC_BITSET_ASSERT(begin <= end && (begin == end || !(begin & BlockInfo::kByteModConst)));
+  }
+
+  /**
+   * @public
+   * @brief Returns the index of the first bit of the partition.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Begin() const noexcept -> SizeType { return begin_; }
+
+  /**
+   * @public
+   * @brief Returns the index past the last bit of the partition.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func End() const noexcept -> SizeType { return end_; }
+
+  /**
+   * @public
+   * @brief Returns the number of bits in the partition.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Size() const noexcept -> SizeType { return end_ - begin_; }
+
+  /**
+   * @public
+   * @brief Checks if the partition has no bits.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Empty() const noexcept -> bool { return begin_ == end_; }
+
+  /**
+   * @public
+   * @brief Returns pointer to the first block of the partition.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Data() const noexcept -> BlockType* {
+    return storage_ + (begin_ >> BlockInfo::kByteDivConst);
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of blocks owned by the partition.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func NumBlocks() const noexcept -> SizeType {
+    if (Empty()) {
+      return 0;
+    }
+    return ((end_ + BlockInfo::kByteModConst) >> BlockInfo::kByteDivConst) - (begin_ >> BlockInfo::kByteDivConst);
+  }
+
+  /**
+   * @public
+   * @brief Checks if `index` belongs to the partition.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Contains(SizeType index) const noexcept -> bool {
+    return index >= begin_ && index < end_;
+  }
+
+  /**
+   * @public
+   * @brief Returns the value of the bit with `index`.
+   *
+   * @param[in] index The zero-based index of the bit in the whole bitset.
+   *
+   * @throws std::out_of_range If `index` is not in `[Begin(), End())`.
+   */
+  [[nodiscard]] constexpr func Test(SizeType index) const -> bool {
+    if (!Contains(index)) [[unlikely]] {
+      throw std::out_of_range{"bits::BitsetPartition::Test(SizeType): index is out of range"};
+    }
+    return storage_[index >> BlockInfo::kByteDivConst] & Mask(index);
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `value`.
+   *
+   * @param[in] index The zero-based index of the bit in the whole bitset.
+   * @param[in] value The boolean value `true/false`.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index` is not in `[Begin(), End())`.
+   *
+   * @par Example:
+   * @code{.cpp}
+   * bits::DynamicBitset bits(std::size_t{1} << 20);
+   * auto parts{bits::Partition(bits, 4)};
+   * // Thread 1
+   * parts[1].Set(parts[1].Begin(), true);
+   * @endcode
+   */
+  constexpr func Set(SizeType index, bool value = false) -> BitsetPartition& {
+    if (!Contains(index)) [[unlikely]] {
+      throw std::out_of_range{"bits::BitsetPartition::Set(SizeType, bool = false): index is out of range"};
+    }
+
+    BlockType& block{storage_[index >> BlockInfo::kByteDivConst]};
+    block = static_cast<BlockType>(value ? block | Mask(index) : block & ~Mask(index));
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Sets all bits of the partition to `true`.
+   *
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr func Set() noexcept -> BitsetPartition& {
+    std::fill(Data(), Data() + NumBlocks(), BitMask::kSet);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `false`.
+   *
+   * @param[in] index The zero-based index of the bit in the whole bitset.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index` is not in `[Begin(), End())`.
+   */
+  constexpr func Reset(SizeType index) -> BitsetPartition& {
+    if (!Contains(index)) [[unlikely]] {
+      throw std::out_of_range{"bits::BitsetPartition::Reset(SizeType): index is out of range"};
+    }
+
+    storage_[index >> BlockInfo::kByteDivConst] &= static_cast<BlockType>(~Mask(index));
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Sets all bits of the partition to `false`.
+   *
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr func Reset() noexcept -> BitsetPartition& {
+    std::fill(Data(), Data() + NumBlocks(), BlockType{});
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Flips the bit with `index`.
+   *
+   * @param[in] index The zero-based index of the bit in the whole bitset.
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index` is not in `[Begin(), End())`.
+   */
+  constexpr func Flip(SizeType index) -> BitsetPartition& {
+    if (!Contains(index)) [[unlikely]] {
+      throw std::out_of_range{"bits::BitsetPartition::Flip(SizeType): index is out of range"};
+    }
+
+    storage_[index >> BlockInfo::kByteDivConst] ^= Mask(index);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Flips all bits of the partition.
+   *
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr func Flip() noexcept -> BitsetPartition& {
+    std::for_each(Data(), Data() + NumBlocks(), [](BlockType& block) constexpr noexcept -> void {
+      block ^= BitMask::kSet;
+    });
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of set bits in the partition.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Count() const noexcept -> SizeType {
+    if (Empty()) {
+      return 0;
+    }
+
+    const BlockType* data{Data()};
+    const SizeType last_block{NumBlocks() - 1};
+    SizeType count{};
+    for (SizeType block{}; block < last_block; ++block) {
+      count += static_cast<SizeType>(std::popcount(data[block]));
+    }
+    return count + static_cast<SizeType>(std::popcount(
+                     static_cast<BlockType>(data[last_block] & __bits_details::TailMask<BlockType>(end_))
+                   ));
+  }
+
+ private:
+  [[nodiscard]] static constexpr func Mask(SizeType index) noexcept -> BlockType {
+    return static_cast<BlockType>(BitMask::kBit << (index & BlockInfo::kByteModConst));
+  }
+
+  BlockType* storage_{};
+  SizeType begin_{};
+  SizeType end_{};
+};
+
+/**
+ * @brief Splits `bits` into `parts` partitions for plain writes from several threads.
+ * @details Partitions are consecutive and cover all bits. Every boundary except `0` and `Size()` lies
+ *          at a cache line boundary of the storage address, so each block and each cache line is owned
+ *          by exactly one partition. Whole cache lines are spread evenly, the first partition also gets
+ *          the blocks before the first boundary; partitions are empty when there are fewer lines than parts.
+ * @ingroup dynamic-bitset-partition
+ *
+ * @param[in] bits Bitset to split, must not be resized while partitions are in use.
+ * @param[in] parts Number of partitions, usually the number of threads.
+ * @return `parts` partitions ordered by bit index.
+ *
+ * @throws std::invalid_argument If `parts == 0`.
+ * @throws std::bad_alloc If memory allocation fails.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::DynamicBitset bits(std::size_t{1} << 24);
+ * auto parts{bits::Partition(bits, threads.size())};
+ * // Thread `t` writes only through `parts[t]`
+ * for (auto index{parts[t].Begin()}; index < parts[t].End(); index += 3) {
+ *   parts[t].Set(index, true);
+ * }
+ * @endcode
+ */
+template<typename Block, typename Allocator>
+[[nodiscard]] func Partition(DynamicBitset<Block, Allocator>& bits, std::size_t parts)
+  -> std::vector<BitsetPartition<Block>> {
+  if (!parts) [[unlikely]] {
+    throw std::invalid_argument{"bits::Partition(bits, parts): number of parts must be positive"};
+  }
+
+  constexpr std::size_t kBitsCount{std::numeric_limits<Block>::digits};
+  constexpr std::size_t kLineBlocks{
+    sizeof(Block) < __bits_details::kCacheLineSize ? __bits_details::kCacheLineSize / sizeof(Block) : 1
+  };
+  const std::size_t blocks{(bits.Size() + kBitsCount - 1) / kBitsCount};
+  Block* storage{bits.Data()};
+
+  // First boundary is the first cache line boundary of the storage address
+  const auto misalignment{reinterpret_cast<std::uintptr_t>(storage) / sizeof(Block) % kLineBlocks};
+  const std::size_t head{std::min(blocks, (kLineBlocks - misalignment) % kLineBlocks)};
+  const std::size_t lines{(blocks - head + kLineBlocks - 1) / kLineBlocks};
+
+  std::vector<BitsetPartition<Block>> result;
+  result.reserve(parts);
+  for (std::size_t part{}; part < parts; ++part) {
+    const std::size_t begin{part ? head + part * lines / parts * kLineBlocks : 0};
+    const std::size_t end{std::min(blocks, head + (part + 1) * lines / parts * kLineBlocks)};
+    result.emplace_back(storage, std::min(bits.Size(), begin * kBitsCount), std::min(bits.Size(), end * kBitsCount));
+  }
+  return result;
+}
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
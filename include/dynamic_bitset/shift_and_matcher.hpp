@@ -0,0 +1,337 @@
+/**
+ * @file dynamic_bitset/shift_and_matcher.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Bit-parallel Shift-And matching of many and long patterns with a DynamicBitset state
+ * @defgroup shift-and-matcher Shift-And matcher
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+
+#include <algorithm>   /* std::upper_bound */
+#include <bit>         /* std::countr_zero */
+#include <cstdint>     /* std::uint8_t */
+#include <limits>      /* std::numeric_limits */
+#include <span>        /* std::span */
+#include <stdexcept>   /* std::invalid_argument */
+#include <string_view> /* std::string_view */
+#include <vector>      /* std::vector */
+
+namespace bits {
+
+/**
+ * @brief Shift-And automaton matching a set of patterns of any length in one pass over the text.
+ * @details Patterns are concatenated into a state vector of `StateBits()` bits, bit `j` being active when
+ *          the text read so far ends with the first `j - start + 1` characters of the pattern that owns
+ *          bit `j`. Every character of the text is one step
+ *          `state = ((state << 1) | starts) & masks[character]` over whole blocks, the bit shifted out of
+ *          a block is carried into the next one. A shifted bit crossing into the next pattern lands on
+ *          its start bit, which is set anyway. Match checks are folded into the same loop and only blocks
+ *          holding partial matches are stepped, so a step costs a few instructions per live block
+ *          regardless of the number and the length of patterns.
+ * @ingroup shift-and-matcher
+ *
+ * @tparam Block Unsigned integral type used for the state and the masks.
+ * @tparam Allocator Allocator of blocks.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * const std::string_view patterns[]{"error", "timeout"};
+ * bits::ShiftAndMatcher<> matcher{patterns};
+ * matcher.Scan("timeout: error", [](std::size_t pattern, std::size_t position) {
+ *   // (1, 0), then (0, 9)
+ * });
+ * @endcode
+ */
+template<
+  __bits_details::IsValidDynamicBitsetBlockType Block = std::size_t,
+  __bits_details::IsValidDynamicBitsetAllocatorType Allocator = std::allocator<Block>>
+class ShiftAndMatcher {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using BitsetType = DynamicBitset<BlockType, Allocator>;
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kAlphabet{std::numeric_limits<std::uint8_t>::max() + 1};
+    /* Up to 512 state bits stepping every block is cheaper than tracking live ones */
+    static constexpr SizeType kDenseBlocks{512 / kBitsCount};
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs a matcher of no patterns, it never reports a match.
+   */
+  ShiftAndMatcher() = default;
+
+  /**
+   * @public
+   * @brief Builds the per-character masks of `patterns`, pattern numbers are their indices.
+   *
+   * @throws std::invalid_argument If a pattern is empty.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit ShiftAndMatcher(std::span<const std::string_view> patterns) : offsets_{0} {
+    for (const std::string_view pattern : patterns) {
+      if (pattern.empty()) {
+        throw std::invalid_argument{
+          "bits::ShiftAndMatcher::ShiftAndMatcher(std::span<const std::string_view>): pattern is empty"
+        };
+      }
+      offsets_.push_back(offsets_.back() + pattern.size());
+    }
+
+    const SizeType bits{offsets_.back()};
+    blocks_ = (bits + BlockInfo::kBitsCount - 1) / BlockInfo::kBitsCount;
+    starts_ = BitsetType(bits);
+    ends_ = BitsetType(bits);
+    masks_ = BitsetType(BlockInfo::kAlphabet * blocks_ * BlockInfo::kBitsCount);
+    for (SizeType pattern{}; pattern < patterns.size(); ++pattern) {
+      starts_.Set(offsets_[pattern], true);
+      ends_.Set(offsets_[pattern + 1] - 1, true);
+      for (SizeType index{}; index < patterns[pattern].size(); ++index) {
+        const auto character{static_cast<std::uint8_t>(patterns[pattern][index])};
+        masks_.Set(character * blocks_ * BlockInfo::kBitsCount + offsets_[pattern] + index, true);
+      }
+    }
+
+    // Blocks holding start bits of patterns beginning with each character, in increasing order
+    start_blocks_.resize(BlockInfo::kAlphabet);
+    for (SizeType pattern{}; pattern < patterns.size(); ++pattern) {
+      auto& blocks{start_blocks_[static_cast<std::uint8_t>(patterns[pattern].front())]};
+      const SizeType block{offsets_[pattern] / BlockInfo::kBitsCount};
+      if (blocks.empty() || blocks.back() != block) {
+        blocks.push_back(block);
+      }
+    }
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of patterns.
+   */
+  [[nodiscard]] func Patterns() const noexcept -> SizeType { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+
+  /**
+   * @public
+   * @brief Returns the length of the state vector, the total length of the patterns.
+   */
+  [[nodiscard]] func StateBits() const noexcept -> SizeType { return offsets_.empty() ? 0 : offsets_.back(); }
+
+  /**
+   * @public
+   * @brief Calls `callback(pattern, position)` for every occurrence of every pattern in `text`.
+   * @details Occurrences are reported in order of their last character, patterns ending at the same
+   *          character in increasing order of their numbers. `position` is the first character.
+   *
+   * @throws Any exception thrown by `callback` or std::bad_alloc if memory allocation fails.
+   */
+  template<typename Callback>
+  func Scan(std::string_view text, Callback&& callback) const -> void {
+    Run(text, [&callback](SizeType pattern, SizeType position) -> bool {
+      callback(pattern, position);
+      return true;
+    });
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of occurrences of all patterns in `text`, overlapping ones included.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func Count(std::string_view text) const -> SizeType {
+    SizeType count{};
+    Run(text, [&count](SizeType, SizeType) -> bool {
+      ++count;
+      return true;
+    });
+    return count;
+  }
+
+  /**
+   * @public
+   * @brief Returns the first character of the occurrence that ends first, `std::string_view::npos` if none.
+   * @details For a single pattern this is `text.find(pattern)`.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  [[nodiscard]] func Find(std::string_view text) const -> SizeType {
+    SizeType found{std::string_view::npos};
+    Run(text, [&found](SizeType, SizeType position) -> bool {
+      found = position;
+      return false;
+    });
+    return found;
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Steps the automaton over `text`, stops when `report(pattern, position)` returns `false`.
+   * @details Short states step every block. Longer ones update only blocks that can be non-zero after
+   *          the step: non-zero blocks, the blocks they carry into and blocks where a pattern starts with
+   *          the current character. Other blocks stay zero, so long patterns cost as much as their live
+   *          partial matches.
+   */
+  template<typename Report>
+  func Run(std::string_view text, Report&& report) const -> void {
+    if (!blocks_) {
+      return;
+    }
+
+    BitsetType state(blocks_ * BlockInfo::kBitsCount);
+    BlockType* const words{state.Data()};
+    const BlockType* const starts{starts_.Data()};
+    const BlockType* const ends{ends_.Data()};
+    std::vector<SizeType> active;
+    std::vector<SizeType> next;
+    if (blocks_ <= BlockInfo::kDenseBlocks) {
+      for (SizeType block{}; block < blocks_; ++block) {
+        active.push_back(block);
+      }
+      for (SizeType end{}; end < text.size(); ++end) {
+        const BlockType* const mask{masks_.Data() + static_cast<std::uint8_t>(text[end]) * blocks_};
+        BlockType carry{};
+        BlockType hits{};
+        for (SizeType block{}; block < blocks_; ++block) {
+          const BlockType word{words[block]};
+          words[block] = static_cast<BlockType>(static_cast<BlockType>(word << 1) | carry | starts[block]) &
+                         mask[block];
+          carry = static_cast<BlockType>(word >> (BlockInfo::kBitsCount - 1));
+          hits |= words[block] & ends[block];
+        }
+        if (hits && !ReportMatches(words, active, end, report)) {
+          return;
+        }
+      }
+      return;
+    }
+
+    for (SizeType end{}; end < text.size(); ++end) {
+      const auto character{static_cast<std::uint8_t>(text[end])};
+      const BlockType* const mask{masks_.Data() + character * blocks_};
+      BlockType hits{};
+      // Blocks are visited in increasing order, the previous one is remembered for its carry
+      SizeType previous{blocks_};
+      BlockType previous_word{};
+      const auto step{[&](SizeType block) -> void {
+        if (previous != blocks_ && block <= previous) {
+          return;
+        }
+        const BlockType word{words[block]};
+        const auto carry{
+          static_cast<BlockType>(previous + 1 == block ? previous_word >> (BlockInfo::kBitsCount - 1) : 0)
+        };
+        words[block] = static_cast<BlockType>(static_cast<BlockType>(word << 1) | carry | starts[block]) & mask[block];
+        previous = block;
+        previous_word = word;
+        if (words[block]) {
+          next.push_back(block);
+          hits |= words[block] & ends[block];
+        }
+      }};
+
+      next.clear();
+      const std::vector<SizeType>& start_blocks{start_blocks_[character]};
+      auto start_block{start_blocks.begin()};
+      for (const SizeType block : active) {
+        for (; start_block != start_blocks.end() && *start_block < block; ++start_block) {
+          step(*start_block);
+        }
+        step(block);
+        if (block + 1 < blocks_) {
+          for (; start_block != start_blocks.end() && *start_block <= block; ++start_block) {
+            step(*start_block);
+          }
+          step(block + 1);
+        }
+      }
+      for (; start_block != start_blocks.end(); ++start_block) {
+        step(*start_block);
+      }
+      active.swap(next);
+
+      if (hits && !ReportMatches(words, active, end, report)) {
+        return;
+      }
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Reports patterns whose end bits are active in `active` blocks after reading character `end`.
+   */
+  template<typename Report>
+  func ReportMatches(const BlockType* words, const std::vector<SizeType>& active, SizeType end, Report& report) const
+    -> bool {
+    const BlockType* const ends{ends_.Data()};
+    for (const SizeType block : active) {
+      for (BlockType hits{static_cast<BlockType>(words[block] & ends[block])}; hits; hits &= hits - 1) {
+        const SizeType bit{block * BlockInfo::kBitsCount + static_cast<SizeType>(std::countr_zero(hits))};
+        // The pattern ending at `bit` is the last one starting at or before it
+        const auto next{std::upper_bound(offsets_.begin(), offsets_.end(), bit)};
+        const auto pattern{static_cast<SizeType>(next - offsets_.begin()) - 1};
+        if (!report(pattern, end + 1 - (offsets_[pattern + 1] - offsets_[pattern]))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  std::vector<SizeType> offsets_;
+  SizeType blocks_{};
+  BitsetType starts_;
+  BitsetType ends_;
+  BitsetType masks_;
+  std::vector<std::vector<SizeType>> start_blocks_;
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
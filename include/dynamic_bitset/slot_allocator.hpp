@@ -0,0 +1,477 @@
+/**
+ * @file dynamic_bitset/slot_allocator.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Lock-free allocator of slot indices backed by a bitmap
+ * @defgroup slot-allocator Slot allocator
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::min */
+#include <atomic>    /* std::atomic, std::memory_order */
+#include <bit>       /* std::countr_one, std::countr_zero, std::popcount */
+#include <limits>    /* std::numeric_limits */
+#include <memory>    /* std::unique_ptr, std::make_unique */
+#include <stdexcept> /* std::invalid_argument, std::out_of_range */
+
+namespace __bits_details {
+
+/**
+ * @internal
+ * @brief Returns a number unique to the calling thread, used to spread threads over search hints.
+ */
+inline func ThreadHintSlot() noexcept -> std::size_t {
+  static std::atomic<std::size_t> next{};
+  thread_local const std::size_t slot{next.fetch_add(1, std::memory_order_relaxed)};
+  return slot;
+}
+
+}  // namespace __bits_details
+
+namespace bits {
+
+/**
+ * @brief Fixed size pool of slot indices, every index is owned by at most one caller at a time.
+ * @details Slot `i` is acquired when bit `i` is set. `Acquire()` claims the lowest zero bit of a block
+ *          with one compare-and-swap, so threads never block each other. Two structures keep the search
+ *          short when the pool is almost full:
+ *          - summary level with one bit per block, set while the block is full, lets the search skip
+ *            full blocks by whole summary blocks;
+ *          - per-thread hints remember the last block where the thread succeeded and start threads
+ *            in different parts of the pool, so they do not fight for the same cache line.
+ *
+ *          Summary bits are hints: a stale bit only costs one extra block load and is repaired on the way.
+ * @ingroup slot-allocator
+ *
+ * @tparam Block Unsigned integral type used for bit storage.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::BitmapSlotAllocator<> connections{4096};
+ * // From any thread
+ * if (const auto slot{connections.Acquire()}; slot != connections.Size()) {
+ *   // ... use slot ...
+ *   connections.Release(slot);
+ * }
+ * @endcode
+ */
+template<__bits_details::IsValidDynamicBitsetBlockType Block = size_t>
+class BitmapSlotAllocator {
+  static_assert(std::atomic<Block>::is_always_lock_free, "Block must have lock-free atomic operations");
+
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using block_type = Block;
+  using BlockType = block_type;
+
+  /**
+   * @brief Number of search hints, threads share hints when there are more of them.
+   */
+  static constexpr SizeType kHintSlots{64};
+
+ private:
+  struct BlockInfo final {
+    static constexpr SizeType kBitsCount{std::numeric_limits<BlockType>::digits};
+    static constexpr SizeType kByteDivConst{kBitsCount < 32 ? sizeof(BlockType) + 2 : kBitsCount == 32 ? 5 : 6};
+    static constexpr SizeType kByteModConst{kBitsCount - 1};
+  };
+
+  struct BitMask final {
+    static constexpr BlockType kBit{1};
+    static constexpr BlockType kSet{std::numeric_limits<BlockType>::max()};
+  };
+
+  /**
+   * @internal
+   * @private
+   * @brief Block where the search starts, on its own cache line.
+   */
+  struct alignas(__bits_details::kCacheLineSize) Hint {
+    std::atomic<SizeType> block;
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs `BitmapSlotAllocator` with `slots` free slots.
+   *
+   * @param[in] slots Number of slots, fixed for the lifetime of the object.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit BitmapSlotAllocator(SizeType slots)
+    : storage_{std::make_unique<std::atomic<BlockType>[]>(Blocks(slots))},
+      summary_{std::make_unique<std::atomic<BlockType>[]>(Blocks(Blocks(slots)))},
+      hints_{std::make_unique<Hint[]>(kHintSlots)},
+      bits_{slots},
+      blocks_{Blocks(slots)},
+      summary_blocks_{Blocks(blocks_)} {
+    // Padding bits stay acquired forever, so runs never cross `Size()`
+    if (const SizeType remaining_bits{bits_ & BlockInfo::kByteModConst}; remaining_bits) {
+      storage_[blocks_ - 1].store(static_cast<BlockType>(BitMask::kSet << remaining_bits), std::memory_order_relaxed);
+    }
+    if (const SizeType remaining_blocks{blocks_ & BlockInfo::kByteModConst}; remaining_blocks) {
+      summary_[summary_blocks_ - 1].store(
+        static_cast<BlockType>(BitMask::kSet << remaining_blocks), std::memory_order_relaxed
+      );
+    }
+    for (SizeType hint{}; hint < kHintSlots; ++hint) {
+      hints_[hint].block.store(hint * blocks_ / kHintSlots, std::memory_order_relaxed);
+    }
+  }
+
+  BitmapSlotAllocator(const BitmapSlotAllocator&) = delete;
+  func operator=(const BitmapSlotAllocator&)->BitmapSlotAllocator& = delete;
+
+  /**
+   * @public
+   * @brief Returns the number of slots.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr func Size() const noexcept -> SizeType { return bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of acquired slots.
+   * @note Not atomic as a whole, every block is loaded once with relaxed order.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Count() const noexcept -> SizeType {
+    SizeType count{};
+    for (SizeType block{}; block < blocks_; ++block) {
+      count += static_cast<SizeType>(std::popcount(storage_[block].load(std::memory_order_relaxed)));
+    }
+    return count - ((blocks_ << BlockInfo::kByteDivConst) - bits_);
+  }
+
+  /**
+   * @public
+   * @brief Checks if slot with `index` is acquired.
+   *
+   * @param[in] index The zero-based index of the slot.
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if `index >= Size()`.
+   */
+  [[nodiscard]] func Test(SizeType index) const noexcept -> bool {
+    BITS_DYNAMIC_BITSET_ASSERT(index < bits_);
+    return storage_[index >> BlockInfo::kByteDivConst].load(std::memory_order_acquire) & Mask(index);
+  }
+
+  /**
+   * @public
+   * @brief Acquires one free slot.
+   * @details Starts from the block where the calling thread succeeded last time and skips full
+   *          blocks using the summary level.
+   *
+   * @return Index of the acquired slot or `Size()` if all slots are acquired.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Acquire() noexcept -> SizeType {
+    if (!blocks_) [[unlikely]] {
+      return bits_;
+    }
+
+    Hint& hint{hints_[__bits_details::ThreadHintSlot() % kHintSlots]};
+    const SizeType first{hint.block.load(std::memory_order_relaxed)};
+    const SizeType first_summary{first >> BlockInfo::kByteDivConst};
+    // The first summary block is visited twice: from the hint to its end and then whole after the wrap
+    for (SizeType step{}; step <= summary_blocks_; ++step) {
+      const SizeType summary{(first_summary + step) % summary_blocks_};
+      auto free{static_cast<BlockType>(~summary_[summary].load(std::memory_order_relaxed))};
+      if (!step) {
+        free &= static_cast<BlockType>(BitMask::kSet << (first & BlockInfo::kByteModConst));
+      }
+      while (free) {
+        const SizeType block{(summary << BlockInfo::kByteDivConst) + static_cast<SizeType>(std::countr_zero(free))};
+        free &= static_cast<BlockType>(free - 1);
+        if (const SizeType slot{TryAcquire(block)}; slot != bits_) {
+          hint.block.store(block, std::memory_order_relaxed);
+          return slot;
+        }
+      }
+    }
+    return bits_;
+  }
+
+  /**
+   * @public
+   * @brief Acquires `count` free slots with consecutive indices.
+   * @details Claims the run block by block and gives the claimed part back if another thread
+   *          took a slot of the run first, then continues the search.
+   *
+   * @param[in] count Number of slots.
+   * @return Index of the first acquired slot or `Size()` if there is no free run of `count` slots.
+   *
+   * @throws std::invalid_argument If `count == 0`.
+   */
+  [[nodiscard]] func AcquireN(SizeType count) -> SizeType {
+    if (!count) [[unlikely]] {
+      throw std::invalid_argument{"bits::BitmapSlotAllocator::AcquireN(SizeType): count must be positive"};
+    }
+    if (count == 1) {
+      return Acquire();
+    }
+    if (count > bits_) {
+      return bits_;
+    }
+
+    Hint& hint{hints_[__bits_details::ThreadHintSlot() % kHintSlots]};
+    const SizeType first{hint.block.load(std::memory_order_relaxed) << BlockInfo::kByteDivConst};
+    // Searches from the hint to the end, then from the beginning
+    for (SizeType from{first}, passes{first ? 2U : 1U}; passes; from = 0, --passes) {
+      for (SizeType start{FindRun(from, count)}; start != bits_; start = FindRun(start + 1, count)) {
+        if (ClaimRun(start, count)) {
+          hint.block.store(start >> BlockInfo::kByteDivConst, std::memory_order_relaxed);
+          return start;
+        }
+      }
+    }
+    return bits_;
+  }
+
+  /**
+   * @public
+   * @brief Releases slot with `index` acquired by `Acquire()` or `AcquireN()`.
+   *
+   * @param[in] index The zero-based index of the slot.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   * @throws std::invalid_argument If the slot is not acquired.
+   */
+  func Release(SizeType index) -> void {
+    if (index >= bits_) [[unlikely]] {
+      throw std::out_of_range{"bits::BitmapSlotAllocator::Release(SizeType): index is out of range"};
+    }
+    if (!ReleaseRun(index, index + 1)) [[unlikely]] {
+      throw std::invalid_argument{"bits::BitmapSlotAllocator::Release(SizeType): slot is not acquired"};
+    }
+  }
+
+  /**
+   * @public
+   * @brief Releases `count` slots starting from `index`.
+   *
+   * @param[in] index The zero-based index of the first slot.
+   * @param[in] count Number of slots.
+   *
+   * @throws std::out_of_range If `index + count > Size()` (out-of-bounds access).
+   * @throws std::invalid_argument If any slot of the run is not acquired, the other slots are released.
+   */
+  func ReleaseN(SizeType index, SizeType count) -> void {
+    if (index > bits_ || count > bits_ - index) [[unlikely]] {
+      throw std::out_of_range{"bits::BitmapSlotAllocator::ReleaseN(SizeType, SizeType): run is out of range"};
+    }
+    if (!ReleaseRun(index, index + count)) [[unlikely]] {
+      throw std::invalid_argument{"bits::BitmapSlotAllocator::ReleaseN(SizeType, SizeType): slot is not acquired"};
+    }
+  }
+
+ private:
+  [[nodiscard]] static constexpr func Blocks(SizeType bits) noexcept -> SizeType {
+    return (bits + BlockInfo::kBitsCount - 1) >> BlockInfo::kByteDivConst;
+  }
+
+  [[nodiscard]] static constexpr func Mask(SizeType index) noexcept -> BlockType {
+    return static_cast<BlockType>(BitMask::kBit << (index & BlockInfo::kByteModConst));
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns mask of `length` bits starting from `offset`, `offset + length <= kBitsCount`.
+   */
+  [[nodiscard]] static constexpr func RangeMask(SizeType offset, SizeType length) noexcept -> BlockType {
+    return static_cast<BlockType>(static_cast<BlockType>(BitMask::kSet >> (BlockInfo::kBitsCount - length)) << offset);
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Claims the lowest zero bit of `block`, returns its index or `Size()` if the block is full.
+   */
+  func TryAcquire(SizeType block) noexcept -> SizeType {
+    std::atomic<BlockType>& word{storage_[block]};
+    BlockType expected{word.load(std::memory_order_relaxed)};
+    while (expected != BitMask::kSet) {
+      // x | (x + 1) sets the lowest zero bit
+      const auto desired{static_cast<BlockType>(expected | static_cast<BlockType>(expected + 1))};
+      if (word.compare_exchange_weak(expected, desired, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        if (desired == BitMask::kSet) {
+          MarkFull(block);
+        }
+        return (block << BlockInfo::kByteDivConst) + static_cast<SizeType>(std::countr_one(expected));
+      }
+    }
+    // Summary was stale
+    MarkFull(block);
+    return bits_;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns the first index of `count` free slots at or after `from`, or `Size()`.
+   * @details Plain loads, the run is only a candidate for `ClaimRun()`.
+   */
+  [[nodiscard]] func FindRun(SizeType from, SizeType count) const noexcept -> SizeType {
+    const SizeType end{blocks_ << BlockInfo::kByteDivConst};
+    SizeType start{from};
+    SizeType length{};
+    for (SizeType index{from}; index < end;) {
+      const SizeType offset{index & BlockInfo::kByteModConst};
+      if (!offset && IsFull(index >> BlockInfo::kByteDivConst)) {
+        index += BlockInfo::kBitsCount;
+        start = index;
+        length = 0;
+        continue;
+      }
+
+      const auto word{
+        static_cast<BlockType>(storage_[index >> BlockInfo::kByteDivConst].load(std::memory_order_relaxed) >> offset)
+      };
+      // Shifted in zeros past the block end are cut off by the number of bits left in the block
+      if (const auto zeros{std::min(static_cast<SizeType>(std::countr_zero(word)), BlockInfo::kBitsCount - offset)};
+          zeros) {
+        index += zeros;
+        length += zeros;
+        if (length >= count) {
+          return start;
+        }
+      } else {
+        index += static_cast<SizeType>(std::countr_one(word));
+        start = index;
+        length = 0;
+      }
+    }
+    return bits_;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Claims slots `[start, start + count)` block by block, rolls back and returns `false` on conflict.
+   */
+  func ClaimRun(SizeType start, SizeType count) noexcept -> bool {
+    const SizeType end{start + count};
+    for (SizeType index{start}; index < end;) {
+      const SizeType block{index >> BlockInfo::kByteDivConst};
+      const SizeType offset{index & BlockInfo::kByteModConst};
+      const SizeType length{std::min(BlockInfo::kBitsCount - offset, end - index)};
+      const BlockType mask{RangeMask(offset, length)};
+
+      std::atomic<BlockType>& word{storage_[block]};
+      BlockType expected{word.load(std::memory_order_relaxed)};
+      do {
+        if (expected & mask) {
+          ReleaseRun(start, index);
+          return false;
+        }
+      } while (!word.compare_exchange_weak(
+        expected, static_cast<BlockType>(expected | mask), std::memory_order_acq_rel, std::memory_order_relaxed
+      ));
+      if (static_cast<BlockType>(expected | mask) == BitMask::kSet) {
+        MarkFull(block);
+      }
+      index += length;
+    }
+    return true;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Releases slots `[start, end)`, returns `false` if any of them was not acquired.
+   */
+  func ReleaseRun(SizeType start, SizeType end) noexcept -> bool {
+    bool acquired{true};
+    for (SizeType index{start}; index < end;) {
+      const SizeType block{index >> BlockInfo::kByteDivConst};
+      const SizeType offset{index & BlockInfo::kByteModConst};
+      const SizeType length{std::min(BlockInfo::kBitsCount - offset, end - index)};
+      const BlockType mask{RangeMask(offset, length)};
+
+      // Sequentially consistent, pairs with the recheck in `MarkFull()`
+      const BlockType previous{storage_[block].fetch_and(static_cast<BlockType>(~mask))};
+      acquired &= (previous & mask) == mask;
+      if (previous == BitMask::kSet) {
+        summary_[block >> BlockInfo::kByteDivConst].fetch_and(static_cast<BlockType>(~Mask(block)));
+      }
+      index += length;
+    }
+    return acquired;
+  }
+
+  [[nodiscard]] func IsFull(SizeType block) const noexcept -> bool {
+    return summary_[block >> BlockInfo::kByteDivConst].load(std::memory_order_relaxed) & Mask(block);
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Marks `block` full in the summary and clears the mark again if a slot was released meanwhile.
+   * @details Release clears the block bit before the summary bit, so either the recheck sees the released
+   *          slot or the release clears the mark after it was set.
+   */
+  func MarkFull(SizeType block) noexcept -> void {
+    std::atomic<BlockType>& summary{summary_[block >> BlockInfo::kByteDivConst]};
+    summary.fetch_or(Mask(block));
+    if (storage_[block].load() != BitMask::kSet) {
+      summary.fetch_and(static_cast<BlockType>(~Mask(block)));
+    }
+  }
+
+ private:
+  std::unique_ptr<std::atomic<BlockType>[]> storage_;
+  std::unique_ptr<std::atomic<BlockType>[]> summary_;
+  std::unique_ptr<Hint[]> hints_;
+  SizeType bits_;
+  SizeType blocks_;
+  SizeType summary_blocks_;
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
@@ -0,0 +1,465 @@
+/**
+ * @file dynamic_bitset/snapshot_bitset.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Copy-on-write bitset publishing immutable versions to concurrent readers
+ * @defgroup snapshot-bitset Snapshot bitset
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::copy_n, std::min */
+#include <array>     /* std::array */
+#include <atomic>    /* std::atomic */
+#include <bit>       /* std::bit_width, std::has_single_bit */
+#include <cstdint>   /* std::uint64_t */
+#include <limits>    /* std::numeric_limits */
+#include <memory>    /* std::shared_ptr, std::make_shared, std::make_unique */
+#include <stdexcept> /* std::invalid_argument, std::out_of_range */
+#include <thread>    /* std::this_thread::yield */
+#include <utility>   /* std::move */
+#include <vector>    /* std::vector */
+
+namespace bits {
+
+/**
+ * @brief Bitset with one writer and many readers, where readers see immutable published versions.
+ * @details Bits are split into fixed size chunks shared between versions. The writer edits a draft:
+ *          the first write to a chunk after `Publish()` copies only that chunk, and `Publish()`
+ *          makes the draft the current version with one atomic store. Readers take a `View` of the
+ *          current version with one atomic load, it stays valid and unchanged while the writer moves on.
+ *          Writer methods must not be called concurrently with each other, `Snapshot()` and `View`
+ *          methods may be called from any thread at any time.
+ * @note `Snapshot()` is lock-free: two counter updates and one reference count increment, retried only when
+ *       a `Publish()` lands between the epoch load and the registration. `Publish()` waits only for readers
+ *       which are inside `Snapshot()` at that moment, never for readers holding views.
+ * @ingroup snapshot-bitset
+ *
+ * @tparam Block Unsigned integral type used for bit storage.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::SnapshotBitset<> filter{1 << 20};
+ * // Writer thread
+ * filter.Set(42).Reset(7);
+ * filter.Publish();
+ * // Reader threads
+ * if (filter.Snapshot().Test(42)) {
+ *   // ...
+ * }
+ * @endcode
+ */
+template<__bits_details::IsValidDynamicBitsetBlockType Block = size_t>
+class SnapshotBitset {
+ public:
+  using size_type = std::size_t;
+  using SizeType = size_type;
+  using value_type = bool;
+  using ValueType = value_type;
+  using block_type = Block;
+  using BlockType = block_type;
+  using chunk_type = DynamicBitset<BlockType>;
+  using ChunkType = chunk_type;
+
+  /**
+   * @brief Default number of bits in one chunk (4 KiB of storage).
+   */
+  static constexpr SizeType kDefaultChunkBits{SizeType{1} << 15};
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Immutable published state.
+   */
+  struct Version {
+    SizeType bits;
+    SizeType chunk_shift;
+    std::uint64_t number;
+    std::vector<std::shared_ptr<const ChunkType>> chunks;
+  };
+
+ public:
+  /**
+   * @brief Read-only handle of one published version.
+   * @details Keeps the version alive, cheap to copy. Never observes later writes.
+   */
+  class View {
+   public:
+    /**
+     * @public
+     * @brief Returns the number of bits.
+     *
+     * @throws None (no-throw guarantee).
+     */
+    [[nodiscard]] func Size() const noexcept -> SizeType { return version_->bits; }
+
+    /**
+     * @public
+     * @brief Checks if the version has no bits (`Size() == 0`).
+     *
+     * @throws None (no-throw guarantee).
+     */
+    [[nodiscard]] func Empty() const noexcept -> bool { return !version_->bits; }
+
+    /**
+     * @public
+     * @brief Returns the sequence number of this version, increases with every `Publish()`.
+     *
+     * @throws None (no-throw guarantee).
+     */
+    [[nodiscard]] func Number() const noexcept -> std::uint64_t { return version_->number; }
+
+    /**
+     * @public
+     * @brief Returns the value of bit with `index`.
+     *
+     * @param[in] index The zero-based index of the bit.
+     *
+     * @throws None (no-throw guarantee).
+     *
+     * @warning **Undefined Behaviour** if `index >= Size()`.
+     */
+    [[nodiscard]] func Test(SizeType index) const noexcept -> bool {
+      BITS_DYNAMIC_BITSET_ASSERT(index < version_->bits);
+      const SizeType shift{version_->chunk_shift};
+      return version_->chunks[index >> shift]->Test(index & ((SizeType{1} << shift) - 1));
+    }
+
+    /**
+     * @public
+     * @brief Returns the number of set bits.
+     *
+     * @throws None (no-throw guarantee).
+     */
+    [[nodiscard]] func Count() const noexcept -> SizeType {
+      SizeType count{};
+      for (const auto& chunk : version_->chunks) {
+        count += chunk->Count();
+      }
+      return count;
+    }
+
+    /**
+     * @public
+     * @brief Copies the version into a plain `DynamicBitset`.
+     *
+     * @throws std::bad_alloc If memory allocation fails (std::allocator).
+     */
+    [[nodiscard]] func ToDynamicBitset() const -> DynamicBitset<BlockType> {
+      DynamicBitset<BlockType> result(version_->bits);
+      BlockType* out{result.Data()};
+      for (const auto& chunk : version_->chunks) {
+        out = std::copy_n(chunk->Data(), chunk->NumBlocks(), out);
+      }
+      return result;
+    }
+
+   private:
+    friend class SnapshotBitset;
+
+    explicit View(std::shared_ptr<const Version> version) noexcept : version_{std::move(version)} { }
+
+    std::shared_ptr<const Version> version_;
+  };
+
+ public:
+  /**
+   * @public
+   * @brief Constructs `SnapshotBitset` with `bits` unset bits and publishes it.
+   *
+   * @param[in] bits Number of bits.
+   * @param[in] chunk_bits Number of bits in one chunk, power of two not less than block width.
+   *
+   * @throws std::invalid_argument If `chunk_bits` is not a power of two or less than block width.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  explicit SnapshotBitset(SizeType bits = 0, SizeType chunk_bits = kDefaultChunkBits)
+    : chunk_bits_{chunk_bits}, chunk_shift_{static_cast<SizeType>(std::bit_width(chunk_bits) - 1)} {
+    if (!std::has_single_bit(chunk_bits) || chunk_bits < std::numeric_limits<BlockType>::digits) {
+      throw std::invalid_argument{"bits::SnapshotBitset::SnapshotBitset(SizeType, SizeType): invalid chunk size"};
+    }
+    Allocate(bits);
+    Publish();
+  }
+
+  /**
+   * @public
+   * @brief Constructs `SnapshotBitset` with the content of `bits` and publishes it.
+   *
+   * @tparam Allocator Allocator type of `bits`.
+   * @param[in] bits Source `DynamicBitset` object.
+   * @param[in] chunk_bits Number of bits in one chunk, power of two not less than block width.
+   *
+   * @throws std::invalid_argument If `chunk_bits` is not a power of two or less than block width.
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  template<typename Allocator>
+  explicit SnapshotBitset(const DynamicBitset<BlockType, Allocator>& bits, SizeType chunk_bits = kDefaultChunkBits)
+    : SnapshotBitset(0, chunk_bits) {
+    Assign(bits);
+    Publish();
+  }
+
+  SnapshotBitset(const SnapshotBitset&) = delete;
+  func operator=(const SnapshotBitset&)->SnapshotBitset& = delete;
+
+  ~SnapshotBitset() { delete current_.load(std::memory_order_relaxed); }
+
+  /**
+   * @public
+   * @brief Returns the current published version. Safe to call from any thread.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Snapshot() const noexcept -> View {
+    // Registers in the counter of the current epoch, so `Publish()` keeps the loaded handle alive until released.
+    // A `Publish()` between the epoch load and the registration may not wait for this counter, so retry then
+    for (;;) {
+      const SizeType epoch{epoch_.load()};
+      auto& readers{readers_[epoch & 1].value};
+      readers.fetch_add(1);
+      if (epoch_.load() == epoch) [[likely]] {
+        View view{*current_.load()};
+        readers.fetch_sub(1, std::memory_order_release);
+        return view;
+      }
+      readers.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of bits in the draft.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Size() const noexcept -> SizeType { return bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of bits in one chunk.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func ChunkBits() const noexcept -> SizeType { return chunk_bits_; }
+
+  /**
+   * @public
+   * @brief Returns the number of chunks copied or written since the last `Publish()`.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func DirtyChunks() const noexcept -> SizeType { return dirty_.Count(); }
+
+  /**
+   * @public
+   * @brief Returns the value of bit with `index` in the draft (writer side).
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   */
+  [[nodiscard]] func Test(SizeType index) const -> bool {
+    if (index >= bits_) {
+      throw std::out_of_range{"bits::SnapshotBitset::Test(SizeType): index is out of range"};
+    }
+    return draft_[index >> chunk_shift_]->Test(index & (chunk_bits_ - 1));
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `true` in the draft.
+   *
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   * @throws std::bad_alloc If copying the chunk fails.
+   */
+  func Set(SizeType index) -> SnapshotBitset& {
+    if (index >= bits_) {
+      throw std::out_of_range{"bits::SnapshotBitset::Set(SizeType): index is out of range"};
+    }
+    MutableChunk(index >> chunk_shift_).Set(index & (chunk_bits_ - 1), true);
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Sets the bit with `index` to `false` in the draft.
+   *
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   * @throws std::bad_alloc If copying the chunk fails.
+   */
+  func Reset(SizeType index) -> SnapshotBitset& {
+    if (index >= bits_) {
+      throw std::out_of_range{"bits::SnapshotBitset::Reset(SizeType): index is out of range"};
+    }
+    MutableChunk(index >> chunk_shift_).Reset(index & (chunk_bits_ - 1));
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Flips the bit with `index` in the draft.
+   *
+   * @return Lvalue reference to `this` object.
+   *
+   * @throws std::out_of_range If `index >= Size()` (out-of-bounds access).
+   * @throws std::bad_alloc If copying the chunk fails.
+   */
+  func Flip(SizeType index) -> SnapshotBitset& {
+    if (index >= bits_) {
+      throw std::out_of_range{"bits::SnapshotBitset::Flip(SizeType): index is out of range"};
+    }
+    MutableChunk(index >> chunk_shift_).Flip(index & (chunk_bits_ - 1));
+    return *this;
+  }
+
+  /**
+   * @public
+   * @brief Replaces the draft with the content of `bits`, all chunks become dirty.
+   *
+   * @tparam Allocator Allocator type of `bits`.
+   * @param[in] bits Source `DynamicBitset` object, may have any size.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  template<typename Allocator>
+  func Assign(const DynamicBitset<BlockType, Allocator>& bits) -> void {
+    Allocate(bits.Size());
+    const BlockType* in{bits.Data()};
+    for (const auto& chunk : draft_) {
+      std::copy_n(in, chunk->NumBlocks(), chunk->Data());
+      in += chunk->NumBlocks();
+    }
+    if (const SizeType remaining_bits{bits_ % std::numeric_limits<BlockType>::digits}; remaining_bits) {
+      // Bits past Size() in the last block are unspecified
+      ChunkType& last{*draft_.back()};
+      last.Data()[last.NumBlocks() - 1] &= static_cast<BlockType>(~(static_cast<BlockType>(-1) << remaining_bits));
+    }
+  }
+
+  /**
+   * @public
+   * @brief Makes the draft the current version with one atomic store.
+   * @details Readers holding older views keep them, their chunks are freed with the last view.
+   *          Waits for readers which loaded the previous version handle and did not copy it yet.
+   *
+   * @throws std::bad_alloc If memory allocation fails.
+   */
+  func Publish() -> void {
+    auto version{std::make_shared<Version>()};
+    version->bits = bits_;
+    version->chunk_shift = chunk_shift_;
+    version->number = published_++;
+    version->chunks.assign(draft_.begin(), draft_.end());
+    const auto* previous{current_.exchange(new std::shared_ptr<const Version>{std::move(version)})};
+    if (dirty_.Size()) {
+      dirty_.Reset();
+    }
+
+    // New readers register in the other counter, the old one drains after in-flight `Snapshot()` calls
+    auto& readers{readers_[epoch_.fetch_add(1) & 1].value};
+    while (readers.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    delete previous;
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Replaces the draft with `bits` unset bits in new dirty chunks.
+   */
+  func Allocate(SizeType bits) -> void {
+    const SizeType chunks{(bits + chunk_bits_ - 1) >> chunk_shift_};
+    std::vector<std::shared_ptr<ChunkType>> draft;
+    draft.reserve(chunks);
+    for (SizeType chunk{}; chunk < chunks; ++chunk) {
+      draft.push_back(std::make_shared<ChunkType>(std::min(chunk_bits_, bits - (chunk << chunk_shift_))));
+    }
+
+    DynamicBitset<> dirty(chunks);
+    if (chunks) {
+      dirty.Set();
+    }
+    draft_ = std::move(draft);
+    dirty_ = std::move(dirty);
+    bits_ = bits;
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Returns chunk of the draft for writing, copies it first if it is shared with a published version.
+   */
+  func MutableChunk(SizeType chunk) -> ChunkType& {
+    if (!dirty_.Test(chunk)) {
+      draft_[chunk] = std::make_shared<ChunkType>(*draft_[chunk]);
+      dirty_.Set(chunk, true);
+    }
+    return *draft_[chunk];
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Number of readers inside `Snapshot()` for one epoch parity, on its own cache line.
+   */
+  struct alignas(__bits_details::kCacheLineSize) ReaderCount {
+    std::atomic<SizeType> value;
+  };
+
+  std::atomic<const std::shared_ptr<const Version>*> current_{};
+  std::atomic<SizeType> epoch_{};
+  mutable std::array<ReaderCount, 2> readers_{};
+  std::vector<std::shared_ptr<ChunkType>> draft_;
+  DynamicBitset<> dirty_;
+  std::uint64_t published_{};
+  SizeType bits_{};
+  SizeType chunk_bits_;
+  SizeType chunk_shift_;
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
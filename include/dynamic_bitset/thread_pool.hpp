@@ -0,0 +1,234 @@
+/**
+ * @file dynamic_bitset/thread_pool.hpp
+ * @date 18-10-2026
+ * @version 0.2.0
+ * @copyright MIT License
+ *
+ * @author Kirill Morozov kirillsm05@gmail.com
+ */
+
+/**
+ * @brief Thread pool executor for parallel whole-bitset operations
+ * @defgroup thread-pool Thread pool executor
+ */
+
+#pragma once
+
+#include "dynamic_bitset.hpp"
+
+#if defined(func)
+  #pragma push_macro("func")
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for redefinition check.
+   * @def BITS_FUNC_MACRO_REDEFINED
+   */
+  #define BITS_FUNC_MACRO_REDEFINED
+  #undef func
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#else
+  /**
+   * @internal
+   * @brief Preprocessor macro definition for go-like functions.
+   * @def func
+   */
+  #define func auto
+#endif
+
+#include <algorithm> /* std::max */
+#include <atomic>    /* std::atomic */
+#include <cstdint>   /* std::size_t */
+#include <mutex>     /* std::mutex, std::lock_guard */
+#include <thread>    /* std::thread */
+#include <vector>    /* std::vector */
+
+namespace bits {
+
+/**
+ * @brief Fixed size thread pool implementing `ParallelExecutor`.
+ * @details The thread calling `Run()` takes tasks too, so the pool starts `threads - 1` workers.
+ *          Idle workers sleep in `std::atomic::wait()` on the job generation counter.
+ *          Concurrent `Run()` calls are served one by one, nested calls from a running task
+ *          run all their tasks on the calling thread.
+ * @ingroup thread-pool
+ *
+ * @par Example:
+ * @code{.cpp}
+ * bits::ThreadPoolExecutor pool{4};
+ * bits::SetParallelExecutor(&pool, std::size_t{1} << 20);
+ * bits::DynamicBitset a(std::size_t{1} << 30), b(std::size_t{1} << 30);
+ * a |= b; // Runs on 4 threads
+ * bits::SetParallelExecutor(nullptr);
+ * @endcode
+ */
+class ThreadPoolExecutor final : public ParallelExecutor {
+ public:
+  /**
+   * @public
+   * @brief Starts the pool.
+   *
+   * @param[in] threads Number of threads running tasks, including the caller of `Run()`.
+   *
+   * @throws std::system_error If a thread could not be started.
+   */
+  explicit ThreadPoolExecutor(std::size_t threads = std::max(1U, std::thread::hardware_concurrency())) {
+    workers_.reserve(threads > 1 ? threads - 1 : 0);
+    for (std::size_t worker{1}; worker < threads; ++worker) {
+      workers_.emplace_back([this]() -> void { WorkerLoop(); });
+    }
+  }
+
+  ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+  func operator=(const ThreadPoolExecutor&) -> ThreadPoolExecutor& = delete;
+
+  /**
+   * @public
+   * @brief Stops and joins all workers.
+   *
+   * @warning Must not be installed with `SetParallelExecutor()` when destroyed.
+   */
+  ~ThreadPoolExecutor() override {
+    {
+      const std::lock_guard lock{mutex_};
+      stop_ = true;
+      generation_.fetch_add(1, std::memory_order_release);
+    }
+    generation_.notify_all();
+    for (std::thread& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  /**
+   * @public
+   * @brief Returns the number of workers plus the calling thread.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] func Concurrency() const noexcept -> std::size_t override { return workers_.size() + 1; }
+
+  /**
+   * @public
+   * @brief Runs `task(context, index)` for every index in `[0, tasks)` and waits for all of them.
+   *
+   * @throws None (no-throw guarantee).
+   */
+  func Run(std::size_t tasks, TaskType task, void* context) noexcept -> void override {
+    if (workers_.empty() || tasks < 2 || current_pool_ == this) {
+      for (std::size_t index{}; index < tasks; ++index) {
+        task(context, index);
+      }
+      return;
+    }
+
+    const std::lock_guard run_lock{run_mutex_};
+    const Job job{task, context, tasks};
+    while (true) {
+      // Workers which joined the previous job late may still take its (exhausted) indices
+      WaitIdle();
+      const std::lock_guard lock{mutex_};
+      if (!active_.load(std::memory_order_relaxed)) {
+        job_ = job;
+        next_.store(0, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+        break;
+      }
+    }
+    generation_.notify_all();
+
+    current_pool_ = this;
+    Work(job);
+    current_pool_ = nullptr;
+    WaitIdle();
+  }
+
+ private:
+  /**
+   * @internal
+   * @private
+   * @brief Tasks of one `Run()` call.
+   */
+  struct Job {
+    TaskType task;
+    void* context;
+    std::size_t tasks;
+  };
+
+  /**
+   * @internal
+   * @private
+   * @brief Takes tasks of `job` until none left.
+   */
+  func Work(const Job& job) noexcept -> void {
+    for (std::size_t index{next_.fetch_add(1, std::memory_order_relaxed)}; index < job.tasks;
+         index = next_.fetch_add(1, std::memory_order_relaxed)) {
+      job.task(job.context, index);
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Waits until no worker runs tasks, makes their writes visible to the caller.
+   */
+  func WaitIdle() noexcept -> void {
+    for (std::size_t active{active_.load(std::memory_order_acquire)}; active;
+         active = active_.load(std::memory_order_acquire)) {
+      active_.wait(active, std::memory_order_acquire);
+    }
+  }
+
+  /**
+   * @internal
+   * @private
+   * @brief Worker thread body: waits for new jobs until the pool stops.
+   */
+  func WorkerLoop() -> void {
+    current_pool_ = this;
+    std::size_t seen_generation{};
+    while (true) {
+      generation_.wait(seen_generation, std::memory_order_acquire);
+
+      Job job;
+      {
+        const std::lock_guard lock{mutex_};
+        if (stop_) {
+          return;
+        }
+        seen_generation = generation_.load(std::memory_order_relaxed);
+        job = job_;
+        active_.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      Work(job);
+      if (active_.fetch_sub(1, std::memory_order_release) == 1) {
+        active_.notify_all();
+      }
+    }
+  }
+
+ private:
+  static inline thread_local const ThreadPoolExecutor* current_pool_{nullptr};
+
+  std::vector<std::thread> workers_;
+  std::mutex run_mutex_;
+  std::mutex mutex_;
+  Job job_{};
+  std::atomic<std::size_t> next_{};
+  std::atomic<std::size_t> generation_{};
+  std::atomic<std::size_t> active_{};
+  bool stop_{false};
+};
+
+}  // namespace bits
+
+#undef func
+#if defined(BITS_FUNC_MACRO_REDEFINED)
+  #undef BITS_FUNC_MACRO_REDEFINED
+  #pragma pop_macro("func")
+#endif
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/adaptive_bitset.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class AdaptiveBitsetFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{100'003};
+
+  static auto MakeFlat(std::size_t count, std::uint32_t seed) -> bits::DynamicBitset<std::uint32_t> {
+    std::mt19937_64 engine{seed};
+    bits::DynamicBitset<std::uint32_t> flat(kBits);
+    for (std::size_t bit{}; bit < count; ++bit) {
+      flat.Set(engine() % kBits, true);
+    }
+    return flat;
+  }
+
+  template<typename Block>
+  static auto Check(const bits::DynamicBitset<Block>& expected, const bits::AdaptiveBitset<Block>& actual) -> void {
+    ASSERT_EQ(expected.Size(), actual.Size());
+    EXPECT_EQ(expected.Count(), actual.Count());
+    EXPECT_EQ(expected, actual.ToDynamicBitset());
+    using Kind = typename bits::AdaptiveBitset<Block>::Kind;
+    if (actual.Count() > kBits / 32) {
+      EXPECT_EQ(Kind::kBitmap, actual.Representation()) << "Array past the limit";
+    } else if (actual.Count() <= kBits / 32 / 2) {
+      EXPECT_EQ(Kind::kArray, actual.Representation()) << "Bitmap below half of the limit";
+    }
+  }
+};
+
+TEST_F(AdaptiveBitsetFixture, OperationsTest) {
+  // Array, array near the limit and bitmap operands in every pairing
+  for (const std::size_t lhs_count : {10, 3'000, 40'000}) {
+    for (const std::size_t rhs_count : {7, 2'500, 60'000}) {
+      const auto lhs_flat{MakeFlat(lhs_count, 1)};
+      const auto rhs_flat{MakeFlat(rhs_count, 2)};
+      const bits::AdaptiveBitset<std::uint32_t> lhs{lhs_flat};
+      const bits::AdaptiveBitset<std::uint32_t> rhs{rhs_flat};
+      Check(lhs_flat, lhs);
+      Check(rhs_flat, rhs);
+
+      Check(lhs_flat & rhs_flat, lhs & rhs);
+      Check(lhs_flat | rhs_flat, lhs | rhs);
+      Check(lhs_flat ^ rhs_flat, lhs ^ rhs);
+      Check(lhs_flat & rhs_flat, rhs & lhs);
+      EXPECT_EQ(lhs & rhs, rhs & lhs);
+      EXPECT_EQ(lhs ^ rhs ^ rhs, lhs) << "Equality does not depend on representation";
+    }
+  }
+}
+
+TEST_F(AdaptiveBitsetFixture, ConversionTest) {
+  using Kind = bits::AdaptiveBitset<>::Kind;
+  constexpr std::size_t kLimit{kBits / 32};
+  bits::AdaptiveBitset<> bits{kBits};
+  for (std::size_t value{}; value < kLimit; ++value) {
+    bits.Set(value * 7, true);
+  }
+  EXPECT_EQ(Kind::kArray, bits.Representation());
+  bits.Set(kLimit * 7, true).Set(0, true);
+  EXPECT_EQ(Kind::kBitmap, bits.Representation()) << "One value past the limit moves to the bitmap";
+  EXPECT_EQ(kLimit + 1, bits.Count());
+
+  for (std::size_t value{}; value <= kLimit / 2; ++value) {
+    bits.Reset(value * 7);
+  }
+  EXPECT_EQ(Kind::kBitmap, bits.Representation()) << "Conversion back waits for half of the limit";
+  constexpr std::size_t kFirst{(kLimit / 2 + 2) * 7};
+  bits.Set(kFirst - 7, false);
+  EXPECT_EQ(Kind::kArray, bits.Representation());
+  EXPECT_EQ(kLimit / 2, bits.Count());
+  EXPECT_EQ(kFirst, bits.FindFirst());
+  EXPECT_EQ(kFirst + 7, bits.FindNext(kFirst));
+  EXPECT_TRUE(bits.Test(kLimit * 7));
+  EXPECT_FALSE(bits.Test(kLimit * 7 - 1));
+
+  const std::vector<std::uint32_t> values{5, 3, 5, 99};
+  const bits::AdaptiveBitset<> small{100, values};
+  EXPECT_EQ(3, small.Count());
+  EXPECT_EQ(3, small.FindFirst());
+  EXPECT_EQ(99, small.FindNext(5));
+  EXPECT_EQ(100, small.FindNext(99));
+  EXPECT_LT(small.MemoryUsage(), bits.MemoryUsage());
+
+  EXPECT_THROW(bits.Set(kBits, true), std::out_of_range);
+  EXPECT_THROW((bits::AdaptiveBitset<>{100, std::vector<std::uint32_t>{100}}), std::out_of_range);
+  EXPECT_THROW(bits::AdaptiveBitset<>{(std::size_t{1} << 32) + 1}, std::invalid_argument);
+  EXPECT_THROW(bits &= small, std::invalid_argument);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <dynamic_bitset/atomic_dynamic_bitset.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class AtomicDynamicBitsetFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{10'000};
+  static constexpr std::size_t kThreads{4};
+};
+
+TEST_F(AtomicDynamicBitsetFixture, ConstructorTest) {
+  bits::AtomicDynamicBitset<> empty;
+  EXPECT_EQ(0, empty.Size());
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(0, empty.Snapshot().Size());
+
+  bits::AtomicDynamicBitset<unsigned char> zeros{kBits};
+  EXPECT_EQ(kBits, zeros.Size());
+  EXPECT_EQ((kBits + 7) / 8, zeros.NumBlocks());
+  EXPECT_EQ(0, zeros.Count());
+
+  bits::DynamicBitset<unsigned char> flat(13);
+  flat.Set();
+  const bits::AtomicDynamicBitset<unsigned char> from_flat{flat};
+  EXPECT_EQ(13, from_flat.Count()) << "Bits past Size() must be dropped";
+  EXPECT_EQ(flat, from_flat.Snapshot());
+
+  bits::AtomicDynamicBitset<unsigned char> moved{std::move(zeros)};
+  EXPECT_EQ(kBits, moved.Size());
+  EXPECT_TRUE(zeros.Empty());
+}
+
+TEST_F(AtomicDynamicBitsetFixture, SetResetTestMethodTest) {
+  bits::AtomicDynamicBitset<unsigned short> bits{kBits};
+
+  EXPECT_FALSE(bits.TestAndSet(17));
+  EXPECT_TRUE(bits.TestAndSet(17));
+  EXPECT_TRUE(bits.Test(17));
+  EXPECT_FALSE(bits.Test(16, std::memory_order_relaxed));
+
+  bits.Set(kBits - 1).Set(0);
+  EXPECT_EQ(3, bits.Count());
+  EXPECT_TRUE(bits.TestAndReset(0));
+  EXPECT_FALSE(bits.TestAndReset(0));
+  bits.Reset(17);
+  EXPECT_FALSE(bits.Test(17));
+  EXPECT_EQ(1, bits.Count());
+
+  bits.Reset();
+  EXPECT_EQ(0, bits.Count());
+
+  EXPECT_THROW(bits.TestAndSet(kBits), std::out_of_range);
+  EXPECT_THROW(bits.TestAndReset(kBits), std::out_of_range);
+  EXPECT_THROW(bits.Set(kBits), std::out_of_range);
+  EXPECT_THROW(bits.Reset(kBits), std::out_of_range);
+}
+
+TEST_F(AtomicDynamicBitsetFixture, ConcurrentTestAndSetTest) {
+  bits::AtomicDynamicBitset<> visited{kBits};
+  std::atomic<std::size_t> first_visits{};
+
+  // Every thread visits every bit, each bit must be claimed exactly once
+  std::vector<std::thread> threads;
+  for (std::size_t thread{}; thread < kThreads; ++thread) {
+    threads.emplace_back([&visited, &first_visits, thread]() -> void {
+      std::size_t claimed{};
+      for (std::size_t step{}; step < kBits; ++step) {
+        claimed += !visited.TestAndSet((step * 7 + thread * 131) % kBits);
+      }
+      first_visits.fetch_add(claimed, std::memory_order_relaxed);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(kBits, first_visits.load());
+  EXPECT_EQ(kBits, visited.Count());
+  EXPECT_TRUE(visited.Snapshot().All());
+}
+
+TEST_F(AtomicDynamicBitsetFixture, ConcurrentSetResetTest) {
+  bits::AtomicDynamicBitset<unsigned char> bits{kBits};
+
+  // Threads share blocks but own separate bits: even bits are set, odd bits are set and reset
+  std::vector<std::thread> threads;
+  for (std::size_t thread{}; thread < kThreads; ++thread) {
+    threads.emplace_back([&bits, thread]() -> void {
+      for (std::size_t bit{thread}; bit < kBits; bit += kThreads) {
+        bits.Set(bit);
+        if (bit & 1) {
+          bits.Reset(bit);
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  const auto snapshot{bits.Snapshot()};
+  for (std::size_t bit{}; bit < kBits; ++bit) {
+    ASSERT_EQ(!(bit & 1), snapshot.Test(bit));
+  }
+}
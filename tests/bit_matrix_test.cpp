@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/bit_matrix.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <random>
+#include <stdexcept>
+
+class BitMatrixFixture : public testing::Test {
+ protected:
+  template<typename Block>
+  static auto MakeRandom(std::size_t rows, std::size_t cols, std::uint32_t seed, unsigned permille = 500)
+    -> bits::BitMatrix<Block> {
+    std::mt19937_64 engine{seed};
+    bits::BitMatrix<Block> result{rows, cols};
+    for (std::size_t row{}; row < rows; ++row) {
+      for (std::size_t column{}; column < cols; ++column) {
+        result.Set(row, column, engine() % 1000 < permille);
+      }
+    }
+    return result;
+  }
+
+  template<typename Block>
+  static auto CheckTranspose(std::size_t rows, std::size_t cols) -> void {
+    const auto matrix{MakeRandom<Block>(rows, cols, 1)};
+    const auto transposed{matrix.Transpose()};
+    ASSERT_EQ(cols, transposed.Rows());
+    ASSERT_EQ(rows, transposed.Cols());
+    for (std::size_t row{}; row < rows; ++row) {
+      for (std::size_t column{}; column < cols; ++column) {
+        ASSERT_EQ(matrix.Test(row, column), transposed.Test(column, row)) << row << ", " << column;
+      }
+    }
+    EXPECT_EQ(matrix.Count(), transposed.Count()) << "Padding bits must stay unset";
+    EXPECT_EQ(matrix, transposed.Transpose());
+  }
+
+  template<typename Block>
+  static auto CheckMultiply(std::size_t rows, std::size_t inner, std::size_t cols) -> void {
+    const auto lhs{MakeRandom<Block>(rows, inner, 2, 30)};
+    const auto rhs{MakeRandom<Block>(inner, cols, 3, 30)};
+    const auto product{lhs.Multiply(rhs)};
+    ASSERT_EQ(rows, product.Rows());
+    ASSERT_EQ(cols, product.Cols());
+    for (std::size_t row{}; row < rows; ++row) {
+      for (std::size_t column{}; column < cols; ++column) {
+        bool expected{};
+        for (std::size_t k{}; k < inner && !expected; ++k) {
+          expected = lhs.Test(row, k) && rhs.Test(k, column);
+        }
+        ASSERT_EQ(expected, product.Test(row, column)) << row << ", " << column;
+      }
+    }
+  }
+};
+
+TEST_F(BitMatrixFixture, AccessTest) {
+  bits::BitMatrix<std::uint16_t> matrix{5, 70};
+  EXPECT_EQ(5, matrix.Rows());
+  EXPECT_EQ(70, matrix.Cols());
+  EXPECT_EQ(8, matrix.Stride()) << "Rows are padded to whole 64-bit words";
+  EXPECT_EQ(0, matrix.Count());
+
+  matrix.Set(1, 69, true).Set(4, 0, true).Flip(2, 3);
+  EXPECT_TRUE(matrix.Test(1, 69));
+  EXPECT_TRUE(matrix.Test(2, 3));
+  matrix.Reset(2, 3);
+  EXPECT_EQ(2, matrix.Count());
+
+  const auto column{matrix.Column(69)};
+  EXPECT_EQ(5, column.Size());
+  EXPECT_EQ(1, column.Count());
+  EXPECT_TRUE(column.Test(1));
+
+  EXPECT_THROW(static_cast<void>(matrix.Test(5, 0)), std::out_of_range);
+  EXPECT_THROW(matrix.Set(0, 70, true), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(matrix.Row(5)), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(matrix.Column(70)), std::out_of_range);
+
+  const bits::BitMatrix<> empty;
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(0, empty.Count());
+  EXPECT_TRUE(empty.Transpose().Empty());
+}
+
+TEST_F(BitMatrixFixture, RowViewTest) {
+  auto matrix{MakeRandom<std::uint8_t>(4, 77, 4)};
+  const auto first{matrix[0].ToDynamicBitset()};
+  const auto second{matrix[1].ToDynamicBitset()};
+
+  matrix[2].Assign(first) |= matrix[1];
+  EXPECT_EQ(first | second, matrix[2].ToDynamicBitset());
+  matrix[2] &= second;
+  EXPECT_EQ(second, matrix[2].ToDynamicBitset());
+  matrix[2] ^= matrix[1];
+  EXPECT_FALSE(matrix[2].Any());
+
+  // Bits past Size() of a DynamicBitset operand must not leak into the padding
+  auto ones{first};
+  ones.Set();
+  ones.Data()[ones.NumBlocks() - 1] = 0xff;
+  matrix[3] |= ones;
+  EXPECT_EQ(77, matrix[3].Count());
+  EXPECT_EQ(first.Count() + second.Count() + 77, matrix.Count());
+
+  const bits::BitMatrix<std::uint8_t>::ConstRowView view{matrix[0]};
+  EXPECT_EQ(first.Test(5), view.Test(5));
+  EXPECT_THROW(static_cast<void>(view.Test(77)), std::out_of_range);
+  EXPECT_THROW(matrix[0] |= bits::DynamicBitset<std::uint8_t>(76), std::invalid_argument);
+}
+
+TEST_F(BitMatrixFixture, TransposeTest) {
+  CheckTranspose<std::uint64_t>(64, 64);
+  CheckTranspose<std::uint64_t>(130, 70);
+  CheckTranspose<std::uint8_t>(3, 200);
+  CheckTranspose<std::uint32_t>(129, 1);
+}
+
+TEST_F(BitMatrixFixture, MultiplyTest) {
+  CheckMultiply<std::uint64_t>(40, 130, 70);
+  CheckMultiply<std::uint16_t>(65, 10, 129);
+
+  bits::BitMatrix<> adjacency{4, 4};
+  adjacency.Set(0, 1, true).Set(1, 2, true).Set(2, 3, true);
+  const auto two_hops{adjacency.Multiply(adjacency)};
+  EXPECT_TRUE(two_hops.Test(0, 2));
+  EXPECT_TRUE(two_hops.Test(1, 3));
+  EXPECT_EQ(2, two_hops.Count());
+  EXPECT_THROW(static_cast<void>(adjacency.Multiply(bits::BitMatrix<>{3, 4})), std::invalid_argument);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/bit_sliced_index.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class BitSlicedIndexFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kRows{1'000};
+
+  template<typename Value>
+  static auto MakeValues(std::size_t rows, Value limit, std::uint32_t seed) -> std::vector<Value> {
+    std::mt19937_64 engine{seed};
+    std::vector<Value> result(rows);
+    for (Value& value : result) {
+      value = static_cast<Value>(engine() % (static_cast<std::uint64_t>(limit) + 1));
+    }
+    return result;
+  }
+
+  template<typename Value, typename Block, typename Predicate>
+  static auto CheckRows(const std::vector<Value>& values, const bits::DynamicBitset<Block>& rows, Predicate predicate)
+    -> void {
+    ASSERT_EQ(values.size(), rows.Size());
+    std::size_t expected{};
+    for (std::size_t row{}; row < values.size(); ++row) {
+      ASSERT_EQ(predicate(values[row]), rows.Test(row)) << "Row " << row << " value " << +values[row];
+      expected += predicate(values[row]);
+    }
+    EXPECT_EQ(expected, rows.Count()) << "Bits past Size() must stay zero";
+  }
+};
+
+TEST_F(BitSlicedIndexFixture, PredicateTest) {
+  const auto values{MakeValues<std::uint16_t>(kRows, 1'000, 1)};
+  const bits::BitSlicedIndex<std::uint16_t> index{values};
+  EXPECT_EQ(kRows, index.Rows());
+  EXPECT_EQ(10, index.Slices());
+
+  for (const std::uint16_t pivot : {0, 1, 500, 999, 1'000, 1'023, 1'024, 65'535}) {
+    CheckRows(values, index.Less(pivot), [pivot](std::uint16_t value) { return value < pivot; });
+    CheckRows(values, index.LessEqual(pivot), [pivot](std::uint16_t value) { return value <= pivot; });
+    CheckRows(values, index.Greater(pivot), [pivot](std::uint16_t value) { return value > pivot; });
+    CheckRows(values, index.GreaterEqual(pivot), [pivot](std::uint16_t value) { return value >= pivot; });
+    CheckRows(values, index.Equal(pivot), [pivot](std::uint16_t value) { return value == pivot; });
+    CheckRows(values, index.NotEqual(pivot), [pivot](std::uint16_t value) { return value != pivot; });
+  }
+  for (const std::uint16_t low : {0, 100, 999, 1'024, 2'000}) {
+    for (const std::uint16_t high : {0, 300, 1'023, 2'000}) {
+      CheckRows(values, index.Between(low, high), [low, high](std::uint16_t value) {
+        return value >= low && value <= high;
+      });
+    }
+  }
+  EXPECT_TRUE(index.Between(300, 100).None());
+
+  const std::vector<std::uint64_t> wide{0, std::numeric_limits<std::uint64_t>::max(), 1ULL << 63, 42};
+  const bits::BitSlicedIndex<std::uint64_t, std::uint8_t> wide_index{wide};
+  CheckRows(wide, wide_index.Less(1ULL << 63), [](std::uint64_t value) { return value < 1ULL << 63; });
+  CheckRows(wide, wide_index.Equal(42), [](std::uint64_t value) { return value == 42; });
+
+  const bits::BitSlicedIndex<std::uint32_t> empty;
+  EXPECT_EQ(0, empty.Less(10).Size());
+  EXPECT_EQ(0, empty.Sum());
+}
+
+TEST_F(BitSlicedIndexFixture, AccessAndSumTest) {
+  auto values{MakeValues<std::uint32_t>(kRows, 100'000, 2)};
+  bits::BitSlicedIndex<std::uint32_t, std::uint16_t> index{values};
+  for (std::size_t row{}; row < kRows; row += 37) {
+    ASSERT_EQ(values[row], index.Get(row));
+  }
+
+  index.Set(3, 1U << 30).Set(4, 0);
+  values[3] = 1U << 30;
+  values[4] = 0;
+  EXPECT_EQ(31, index.Slices()) << "Wider values must add slices";
+  EXPECT_EQ(1U << 30, index.Get(3));
+  EXPECT_EQ(0, index.Get(4));
+  CheckRows(values, index.GreaterEqual(1U << 20), [](std::uint32_t value) { return value >= 1U << 20; });
+
+  const auto mask{index.Between(1'000, 50'000)};
+  std::uint64_t expected{};
+  std::uint64_t total{};
+  for (std::size_t row{}; row < kRows; ++row) {
+    expected += mask.Test(row) ? values[row] : 0;
+    total += values[row];
+  }
+  EXPECT_EQ(expected, index.Sum(mask));
+  EXPECT_EQ(total, index.Sum());
+
+  EXPECT_THROW(static_cast<void>(index.Get(kRows)), std::out_of_range);
+  EXPECT_THROW(index.Set(kRows, 1), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(index.Slice(31)), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(index.Sum(bits::DynamicBitset<std::uint16_t>(kRows - 1))), std::invalid_argument);
+}
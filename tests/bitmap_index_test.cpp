@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/bitmap_index.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <functional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class BitmapIndexFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kRows{100'003};
+
+  /**
+   * Region is clustered in four runs so whole chunks drop out of conjunctions, status and category are uniform.
+   */
+  BitmapIndexFixture() : region(kRows), status(kRows), category(kRows) {
+    std::mt19937_64 engine{1};
+    for (std::size_t row{}; row < kRows; ++row) {
+      region[row] = static_cast<std::uint8_t>(row * 4 / kRows);
+      status[row] = static_cast<std::uint8_t>(engine() % 8);
+      category[row] = static_cast<std::uint16_t>(engine() % 100);
+    }
+  }
+
+  template<typename Block, typename Predicate>
+  auto CheckRows(const bits::DynamicBitset<Block>& rows, Predicate predicate) const -> void {
+    ASSERT_EQ(kRows, rows.Size());
+    std::size_t expected{};
+    for (std::size_t row{}; row < kRows; ++row) {
+      ASSERT_EQ(predicate(row), rows.Test(row)) << "Row " << row;
+      expected += predicate(row);
+    }
+    EXPECT_EQ(expected, rows.Count()) << "Bits past Size() must stay zero";
+  }
+
+  std::vector<std::uint8_t> region;
+  std::vector<std::uint8_t> status;
+  std::vector<std::uint16_t> category;
+};
+
+TEST_F(BitmapIndexFixture, BuildTest) {
+  const bits::BitmapIndex<std::uint8_t> index{region};
+  EXPECT_EQ(kRows, index.Rows());
+  EXPECT_EQ(4, index.Cardinality());
+  EXPECT_EQ(nullptr, index.Find(4));
+  EXPECT_EQ(0, index.Count(4));
+
+  std::size_t total{};
+  for (std::uint8_t key{}; key < 4; ++key) {
+    ASSERT_NE(nullptr, index.Find(key));
+    CheckRows(*index.Find(key), [&](std::size_t row) { return region[row] == key; });
+    EXPECT_EQ(index.Find(key)->Count(), index.Count(key));
+    EXPECT_EQ(index.Count(key), index.Equal(key).Count());
+    total += index.Count(key);
+  }
+  EXPECT_EQ(kRows, total);
+
+  const std::vector<std::string> names{"eu", "us", "eu", "asia", "eu"};
+  const bits::BitmapIndex<std::string, std::hash<std::string>, std::equal_to<>, std::uint8_t> strings{names};
+  EXPECT_EQ(3, strings.Cardinality());
+  EXPECT_EQ(3, strings.Count("eu"));
+  EXPECT_TRUE(strings.Find("eu")->Test(4));
+  EXPECT_FALSE(strings.Find("eu")->Test(3));
+
+  const bits::BitmapIndex<int> empty;
+  EXPECT_EQ(0, empty.Equal(1).Evaluate().Size());
+  EXPECT_EQ(0, (~empty.Equal(1)).Count());
+}
+
+TEST_F(BitmapIndexFixture, PredicateTest) {
+  const bits::BitmapIndex<std::uint8_t> regions{region};
+  const bits::BitmapIndex<std::uint8_t> statuses{status};
+  const bits::BitmapIndex<std::uint16_t> categories{category};
+
+  const auto query{regions.Equal(1) & statuses.In({2, 3}) & ~categories.Equal(5)};
+  const auto predicate{[this](std::size_t row) {
+    return region[row] == 1 && (status[row] == 2 || status[row] == 3) && category[row] != 5;
+  }};
+  CheckRows(query.Evaluate(), predicate);
+  EXPECT_EQ(query.Evaluate().Count(), query.Count());
+  EXPECT_LE(query.Count(), query.Estimate());
+
+  const auto nested{(regions.Equal(0) | regions.Equal(3)) & ~(statuses.Equal(1) & categories.In({1, 2, 3}))};
+  CheckRows(nested.Evaluate(), [this](std::size_t row) {
+    return (region[row] == 0 || region[row] == 3) && !(status[row] == 1 && category[row] >= 1 && category[row] <= 3);
+  });
+  EXPECT_EQ(nested.Evaluate().Count(), nested.Count());
+
+  // Missing keys match nothing, their negation everything
+  CheckRows((regions.Equal(9) | statuses.Equal(0)).Evaluate(), [this](std::size_t row) { return status[row] == 0; });
+  EXPECT_EQ(0, (regions.Equal(9) & statuses.Equal(0)).Count());
+  EXPECT_EQ(kRows, (~regions.Equal(9)).Count());
+  EXPECT_EQ(kRows, (regions.In({0, 1, 2, 3}) | statuses.Equal(0)).Count());
+  CheckRows((~~statuses.Equal(7)).Evaluate(), [this](std::size_t row) { return status[row] == 7; });
+
+  const bits::BitmapIndex<std::uint8_t> shorter{std::span{region}.first(kRows - 1)};
+  EXPECT_THROW(static_cast<void>(regions.Equal(1) & shorter.Equal(1)), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(regions.Equal(1) | shorter.Equal(1)), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(regions.In({})), std::invalid_argument);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <dynamic_bitset/bloom_filter.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+class BloomFilterFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kKeys{50'000};
+
+  static auto MakeHashes(std::size_t count, std::uint64_t seed) -> std::vector<std::uint64_t> {
+    std::mt19937_64 engine{seed};
+    std::vector<std::uint64_t> result(count);
+    for (std::uint64_t& hash : result) {
+      hash = engine();
+    }
+    return result;
+  }
+};
+
+TEST_F(BloomFilterFixture, InsertContainsTest) {
+  const auto keys{MakeHashes(kKeys, 1)};
+  const auto absent{MakeHashes(kKeys, 2)};
+  bits::BlockedBloomFilter filter{kKeys * 16};
+  EXPECT_EQ(0, filter.Size() % bits::BlockedBloomFilter::kBlockBits);
+  EXPECT_EQ(filter.Size() / 512, filter.NumBlocks());
+  EXPECT_FALSE(filter.Contains(keys.front()));
+
+  for (const std::uint64_t hash : keys) {
+    filter.Insert(hash);
+  }
+  for (const std::uint64_t hash : keys) {
+    ASSERT_TRUE(filter.Contains(hash)) << "Bloom filter must not have false negatives";
+  }
+
+  std::size_t false_positives{};
+  for (const std::uint64_t hash : absent) {
+    false_positives += filter.Contains(hash);
+  }
+  EXPECT_LT(false_positives, kKeys / 200) << "About 0.1% false positives are expected at 16 bits per key";
+
+  // Sequential identity hashes of integers must spread over blocks too
+  bits::BlockedBloomFilter integers{kKeys * 10};
+  for (std::uint64_t key{}; key < kKeys; ++key) {
+    integers.Insert(key);
+  }
+  false_positives = 0;
+  for (std::uint64_t key{kKeys}; key < 2 * kKeys; ++key) {
+    false_positives += integers.Contains(key);
+  }
+  EXPECT_LT(false_positives, kKeys / 40);
+
+  filter.Clear();
+  EXPECT_EQ(0, filter.Count());
+  EXPECT_EQ(bits::BlockedBloomFilter::kBlockBits, bits::BlockedBloomFilter{0}.Size());
+}
+
+TEST_F(BloomFilterFixture, BatchTest) {
+  const auto keys{MakeHashes(kKeys, 3)};
+  bits::BlockedBloomFilter single{kKeys * 8};
+  bits::BlockedBloomFilter batch{kKeys * 8};
+  for (const std::uint64_t hash : keys) {
+    single.Insert(hash);
+  }
+  batch.InsertBatch(keys);
+  EXPECT_EQ(single, batch);
+
+  auto lookups{MakeHashes(kKeys, 4)};
+  lookups.insert(lookups.end(), keys.begin(), keys.begin() + 100);
+  bits::DynamicBitset<> found(lookups.size());
+  std::size_t expected{};
+  for (const std::uint64_t hash : lookups) {
+    expected += batch.Contains(hash);
+  }
+  EXPECT_EQ(expected, batch.ContainsBatch(lookups, found));
+  EXPECT_EQ(expected, found.Count());
+  for (std::size_t index{}; index < lookups.size(); ++index) {
+    ASSERT_EQ(batch.Contains(lookups[index]), found.Test(index)) << index;
+  }
+
+  bits::DynamicBitset<std::uint8_t> wrong(lookups.size() - 1);
+  EXPECT_THROW(static_cast<void>(batch.ContainsBatch(lookups, wrong)), std::invalid_argument);
+}
+
+TEST_F(BloomFilterFixture, UnionAndSerializationTest) {
+  const auto left_keys{MakeHashes(1000, 5)};
+  const auto right_keys{MakeHashes(1000, 6)};
+  bits::BlockedBloomFilter left{20'000};
+  bits::BlockedBloomFilter right{20'000};
+  left.InsertBatch(left_keys);
+  right.InsertBatch(right_keys);
+
+  left |= right;
+  for (const std::uint64_t hash : right_keys) {
+    ASSERT_TRUE(left.Contains(hash));
+  }
+  bits::BlockedBloomFilter other{100'000};
+  EXPECT_THROW(left |= other, std::invalid_argument);
+
+  const std::vector<std::byte> bytes{left.Serialize()};
+  EXPECT_EQ((1 + left.NumBlocks() * 8) * 8, bytes.size());
+  const auto restored{bits::BlockedBloomFilter::Deserialize(bytes)};
+  EXPECT_EQ(left, restored);
+  EXPECT_NE(right, restored);
+  for (const std::uint64_t hash : left_keys) {
+    ASSERT_TRUE(restored.Contains(hash));
+  }
+
+  const std::span<const std::byte> view{bytes};
+  EXPECT_THROW(static_cast<void>(bits::BlockedBloomFilter::Deserialize({})), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(bits::BlockedBloomFilter::Deserialize(view.first(bytes.size() - 1))),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(bits::BlockedBloomFilter::Deserialize(view.first(bytes.size() - 64))),
+               std::invalid_argument);
+  std::vector<std::byte> corrupted{bytes};
+  corrupted.front() = std::byte{0};
+  EXPECT_THROW(static_cast<void>(bits::BlockedBloomFilter::Deserialize(corrupted)), std::invalid_argument);
+}
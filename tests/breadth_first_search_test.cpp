@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/breadth_first_search.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <execution>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+class BreadthFirstSearchFixture : public testing::Test {
+ protected:
+  struct Graph {
+    std::vector<std::size_t> offsets;
+    std::vector<std::uint32_t> targets;
+  };
+
+  /**
+   * Undirected graph with a dense core of `core` vertices and a long path attached, so searches
+   * go top-down, bottom-up and back to top-down. Vertices past the path stay unreachable.
+   */
+  static auto MakeGraph(std::size_t vertices, std::size_t core, std::size_t path, std::uint32_t seed) -> Graph {
+    std::mt19937_64 engine{seed};
+    std::vector<std::vector<std::uint32_t>> adjacency(vertices);
+    const auto connect{[&](std::size_t from, std::size_t to) -> void {
+      adjacency[from].push_back(static_cast<std::uint32_t>(to));
+      adjacency[to].push_back(static_cast<std::uint32_t>(from));
+    }};
+    for (std::size_t edge{}; edge < core * 16; ++edge) {
+      connect(engine() % core, engine() % core);
+    }
+    for (std::size_t vertex{core}; vertex < core + path; ++vertex) {
+      connect(vertex - 1, vertex);
+    }
+
+    Graph graph;
+    graph.offsets.push_back(0);
+    for (const auto& neighbours : adjacency) {
+      graph.targets.insert(graph.targets.end(), neighbours.begin(), neighbours.end());
+      graph.offsets.push_back(graph.targets.size());
+    }
+    return graph;
+  }
+
+  static auto ReferenceLevels(const Graph& graph, std::size_t source) -> std::vector<std::size_t> {
+    std::vector<std::size_t> levels(graph.offsets.size() - 1, SIZE_MAX);
+    std::queue<std::size_t> queue;
+    levels[source] = 0;
+    queue.push(source);
+    while (!queue.empty()) {
+      const std::size_t vertex{queue.front()};
+      queue.pop();
+      for (std::size_t edge{graph.offsets[vertex]}; edge < graph.offsets[vertex + 1]; ++edge) {
+        if (levels[graph.targets[edge]] == SIZE_MAX) {
+          levels[graph.targets[edge]] = levels[vertex] + 1;
+          queue.push(graph.targets[edge]);
+        }
+      }
+    }
+    return levels;
+  }
+
+  template<typename Block, typename Policy>
+  static auto CheckLevels(const Graph& graph, std::size_t source, Policy&& policy) -> void {
+    const auto levels{ReferenceLevels(graph, source)};
+    bits::BreadthFirstSearch<std::uint32_t, Block> bfs{graph.offsets, graph.targets};
+    bfs.Reset(static_cast<std::uint32_t>(source));
+    EXPECT_EQ(1, bfs.FrontierSize());
+
+    bool bottom_up{};
+    bool top_down_after_bottom_up{};
+    while (bfs.Step(policy)) {
+      using Direction = typename decltype(bfs)::Direction;
+      top_down_after_bottom_up |= bottom_up && bfs.LastDirection() == Direction::kTopDown;
+      bottom_up |= bfs.LastDirection() == Direction::kBottomUp;
+
+      std::size_t frontier{};
+      for (std::size_t vertex{}; vertex < levels.size(); ++vertex) {
+        ASSERT_EQ(levels[vertex] == bfs.Level(), bfs.Frontier().Test(vertex)) << "Vertex " << vertex;
+        frontier += levels[vertex] == bfs.Level();
+      }
+      ASSERT_EQ(frontier, bfs.FrontierSize());
+      ASSERT_EQ(frontier, bfs.Frontier().Count());
+    }
+    EXPECT_TRUE(bottom_up) << "Dense core must be expanded bottom-up";
+    EXPECT_TRUE(top_down_after_bottom_up) << "Path must be expanded top-down again";
+
+    std::size_t reached{};
+    for (std::size_t vertex{}; vertex < levels.size(); ++vertex) {
+      ASSERT_EQ(levels[vertex] != SIZE_MAX, bfs.Visited().Test(vertex)) << "Vertex " << vertex;
+      reached += levels[vertex] != SIZE_MAX;
+    }
+    EXPECT_EQ(reached, bfs.Reached());
+    EXPECT_EQ(0, bfs.Step()) << "Finished search must stay finished";
+  }
+};
+
+TEST_F(BreadthFirstSearchFixture, LevelsTest) {
+  const Graph graph{MakeGraph(12'011, 8'000, 300, 1)};
+  CheckLevels<std::uint64_t>(graph, 0, std::execution::seq);
+  CheckLevels<std::uint8_t>(graph, 7, std::execution::seq);
+  CheckLevels<std::uint64_t>(graph, 3, std::execution::par);
+  CheckLevels<std::uint16_t>(graph, 11, std::execution::par_unseq);
+}
+
+TEST_F(BreadthFirstSearchFixture, RunAndErrorsTest) {
+  const Graph graph{MakeGraph(5'000, 3'000, 100, 2)};
+  bits::BreadthFirstSearch<> bfs{graph.offsets, graph.targets};
+  const std::size_t reached{bfs.Run(0)};
+  EXPECT_EQ(reached, bfs.Visited().Count());
+  EXPECT_EQ(reached, bfs.Run(std::execution::par, 1)) << "Searches from the same component reach the same vertices";
+  EXPECT_EQ(1, bfs.Run(4'999)) << "Isolated vertex reaches only itself";
+  EXPECT_EQ(0, bfs.Level());
+
+  EXPECT_THROW(bfs.Reset(5'000), std::out_of_range);
+  const std::vector<std::size_t> offsets{0, 2};
+  const std::vector<std::uint32_t> targets{0};
+  EXPECT_THROW((bits::BreadthFirstSearch<>{offsets, targets}), std::invalid_argument);
+  EXPECT_THROW((bits::BreadthFirstSearch<>{std::vector<std::size_t>{}, targets}), std::invalid_argument);
+
+  const std::vector<std::size_t> wide(300, 0);
+  EXPECT_THROW(
+    (bits::BreadthFirstSearch<std::uint8_t>{wide, std::vector<std::uint8_t>{}}), std::invalid_argument
+  ) << "299 vertices do not fit std::uint8_t ids";
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/compressed_bitset.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <random>
+#include <stdexcept>
+
+class CompressedBitsetFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{5 * (1 << 16) + 123};
+
+  /**
+   * Builds a bitset with one container per layout:
+   * sparse (array), dense (bitmap), long runs, empty and a sparse tail.
+   */
+  static auto MakeMixed(std::uint32_t seed) -> bits::DynamicBitset<> {
+    std::mt19937 engine{seed};
+    bits::DynamicBitset<> bits(kBits);
+    for (std::size_t bit{}; bit < 1 << 16; ++bit) {
+      if (engine() % 64 == 0) {
+        bits.Set(bit, true);
+      }
+      if (engine() % 2 == 0) {
+        bits.Set((1 << 16) + bit, true);
+      }
+      if (bit / (128 + seed % 64) % 2 == 0) {
+        bits.Set((2 << 16) + bit, true);
+      }
+    }
+    for (std::size_t bit{4 << 16}; bit < kBits; bit += 97 + seed % 13) {
+      bits.Set(bit, true);
+    }
+    return bits;
+  }
+};
+
+TEST_F(CompressedBitsetFixture, ConstructorTest) {
+  bits::CompressedBitset empty;
+  EXPECT_EQ(0, empty.Size());
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_TRUE(empty.None());
+
+  bits::CompressedBitset zeros{kBits};
+  EXPECT_EQ(kBits, zeros.Size());
+  EXPECT_EQ(0, zeros.Count());
+  EXPECT_FALSE(zeros.Any());
+  EXPECT_EQ(kBits, zeros.FindFirst());
+}
+
+TEST_F(CompressedBitsetFixture, ConversionTest) {
+  const auto flat{MakeMixed(1)};
+  const bits::CompressedBitset compressed{flat};
+
+  EXPECT_EQ(flat.Size(), compressed.Size());
+  EXPECT_EQ(flat.Count(), compressed.Count());
+  EXPECT_EQ(flat, compressed.ToDynamicBitset());
+  EXPECT_LT(compressed.MemoryUsage(), flat.NumBlocks() * sizeof(std::size_t));
+
+  bits::DynamicBitset<unsigned char> bytes(1000);
+  bytes.Set(0, true).Set(7, true).Set(999, true);
+  const bits::CompressedBitset from_bytes{bytes};
+  EXPECT_EQ(3, from_bytes.Count());
+  EXPECT_EQ(bytes, from_bytes.ToDynamicBitset<unsigned char>());
+  EXPECT_EQ(bytes.ToString(), from_bytes.ToDynamicBitset<unsigned short>().ToString());
+
+  bits::DynamicBitset<> full(3 << 16);
+  full.Set();
+  full.Resize((3 << 16) + 5, true);
+  const bits::CompressedBitset from_full{full};
+  EXPECT_TRUE(from_full.All());
+  EXPECT_LT(from_full.MemoryUsage(), 512) << "Full containers must be stored as runs";
+  EXPECT_EQ(full, from_full.ToDynamicBitset());
+}
+
+TEST_F(CompressedBitsetFixture, SetResetTestMethodTest) {
+  bits::CompressedBitset bits{kBits};
+
+  // Array container growing into bitmap and shrinking back
+  for (std::size_t bit{}; bit < 10'000; ++bit) {
+    bits.Set(bit * 3, true);
+  }
+  EXPECT_EQ(10'000, bits.Count());
+  for (std::size_t bit{}; bit < 10'000; ++bit) {
+    ASSERT_TRUE(bits.Test(bit * 3));
+    ASSERT_FALSE(bits.Test(bit * 3 + 1));
+  }
+  for (std::size_t bit{}; bit < 9'000; ++bit) {
+    bits.Reset(bit * 3);
+  }
+  EXPECT_EQ(1'000, bits.Count());
+  EXPECT_FALSE(bits.Test(0));
+  EXPECT_TRUE(bits.Test(9'000 * 3));
+
+  // Run container point updates
+  bits::DynamicBitset<> runs(kBits);
+  for (std::size_t bit{100}; bit < 60'000; ++bit) {
+    runs.Set(bit, true);
+  }
+  bits::CompressedBitset compressed_runs{runs};
+  compressed_runs.Reset(200).Reset(100).Reset(59'999).Set(200, true).Set(99, true).Set(60'001, true);
+  runs.Set(99, true).Reset(100).Set(59'999).Set(60'001, true);
+  EXPECT_EQ(runs, compressed_runs.ToDynamicBitset());
+  compressed_runs.Set(60'000, true);
+  runs.Set(60'000, true);
+  EXPECT_EQ(runs, compressed_runs.ToDynamicBitset());
+
+  EXPECT_THROW(bits.Set(kBits, true), std::out_of_range);
+  EXPECT_THROW(bits.Reset(kBits), std::out_of_range);
+
+  bits.Reset();
+  EXPECT_EQ(kBits, bits.Size());
+  EXPECT_TRUE(bits.None());
+  bits.Clear();
+  EXPECT_TRUE(bits.Empty());
+}
+
+TEST_F(CompressedBitsetFixture, FindNextMethodTest) {
+  const auto flat{MakeMixed(2)};
+  const bits::CompressedBitset compressed{flat};
+
+  std::size_t expected{flat.FindFirst()};
+  std::size_t found{compressed.FindFirst()};
+  while (expected < flat.Size()) {
+    ASSERT_EQ(expected, found);
+    expected = flat.FindNext(expected);
+    found = compressed.FindNext(found);
+  }
+  EXPECT_EQ(compressed.Size(), found);
+  EXPECT_EQ(compressed.Size(), compressed.FindNext(compressed.Size() - 1));
+}
+
+TEST_F(CompressedBitsetFixture, BitwiseOperatorsTest) {
+  for (std::uint32_t seed{}; seed < 9; ++seed) {
+    const auto lhs_flat{MakeMixed(seed)};
+    auto rhs_flat{MakeMixed(seed + 10)};
+    // Shift containers against each other to pair every representation
+    rhs_flat <<= (seed % 3) << 16;
+    const bits::CompressedBitset lhs{lhs_flat};
+    const bits::CompressedBitset rhs{rhs_flat};
+
+    EXPECT_EQ(lhs_flat & rhs_flat, (lhs & rhs).ToDynamicBitset());
+    EXPECT_EQ(lhs_flat | rhs_flat, (lhs | rhs).ToDynamicBitset());
+    EXPECT_EQ(lhs_flat ^ rhs_flat, (lhs ^ rhs).ToDynamicBitset());
+    EXPECT_EQ(lhs_flat & ~rhs_flat, bits::CompressedBitset{lhs}.AndNot(rhs).ToDynamicBitset());
+    EXPECT_EQ(rhs_flat & ~lhs_flat, bits::CompressedBitset{rhs}.AndNot(lhs).ToDynamicBitset());
+    EXPECT_EQ((lhs_flat & rhs_flat).Count(), (lhs & rhs).Count());
+    EXPECT_EQ(lhs, lhs & lhs);
+    EXPECT_TRUE((lhs ^ lhs).None());
+  }
+
+  EXPECT_THROW(bits::CompressedBitset{10} &= bits::CompressedBitset{11}, std::invalid_argument);
+  EXPECT_THROW(bits::CompressedBitset{10} |= bits::CompressedBitset{11}, std::invalid_argument);
+  EXPECT_THROW(bits::CompressedBitset{10} ^= bits::CompressedBitset{11}, std::invalid_argument);
+  EXPECT_THROW(bits::CompressedBitset{10}.AndNot(bits::CompressedBitset{11}), std::invalid_argument);
+}
+
+TEST_F(CompressedBitsetFixture, EqualityOperatorTest) {
+  const auto flat{MakeMixed(3)};
+  const bits::CompressedBitset optimized{flat};
+
+  // Same content built by point updates keeps different representations
+  bits::CompressedBitset updated{flat.Size()};
+  for (std::size_t bit{flat.FindFirst()}; bit < flat.Size(); bit = flat.FindNext(bit)) {
+    updated.Set(bit, true);
+  }
+  EXPECT_EQ(optimized, updated);
+  EXPECT_GT(updated.MemoryUsage(), optimized.MemoryUsage());
+  updated.ShrinkToFit();
+  EXPECT_EQ(optimized, updated);
+  EXPECT_LE(updated.MemoryUsage(), optimized.MemoryUsage());
+
+  updated.Reset(flat.FindFirst());
+  EXPECT_NE(optimized, updated);
+}
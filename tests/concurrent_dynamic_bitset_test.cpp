@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <dynamic_bitset/concurrent_dynamic_bitset.hpp>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class ConcurrentDynamicBitsetFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kShardBits{256};
+  static constexpr std::size_t kBits{20'000};
+  static constexpr std::size_t kThreads{4};
+};
+
+TEST_F(ConcurrentDynamicBitsetFixture, ConstructorTest) {
+  bits::ConcurrentDynamicBitset<> empty;
+  EXPECT_EQ(0, empty.Size());
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(empty.kDefaultShardBits, empty.ShardBits());
+  EXPECT_EQ(0, empty.NumShards());
+  EXPECT_EQ(0, empty.Snapshot().Size());
+
+  const bits::ConcurrentDynamicBitset<unsigned char> sized{kBits, kShardBits};
+  EXPECT_EQ(kBits, sized.Size());
+  EXPECT_EQ(0, sized.NumShards()) << "Storage must be allocated lazily";
+  EXPECT_EQ(0, sized.Count());
+  EXPECT_EQ(bits::DynamicBitset<unsigned char>(kBits), sized.Snapshot());
+
+  EXPECT_THROW(bits::ConcurrentDynamicBitset<>(0, 100), std::invalid_argument);
+  EXPECT_THROW(bits::ConcurrentDynamicBitset<>(0, 32), std::invalid_argument);
+  EXPECT_THROW(bits::ConcurrentDynamicBitset<>(0, 0), std::invalid_argument);
+}
+
+TEST_F(ConcurrentDynamicBitsetFixture, SetResetTestMethodTest) {
+  bits::ConcurrentDynamicBitset<unsigned short> bits{0, kShardBits};
+
+  EXPECT_FALSE(bits.Test(1000));
+  EXPECT_FALSE(bits.TestAndSet(1000));
+  EXPECT_EQ(1001, bits.Size()) << "Setting a bit past Size() must grow the set";
+  EXPECT_EQ(1, bits.NumShards()) << "Shards before the written one must stay unallocated";
+  EXPECT_TRUE(bits.TestAndSet(1000));
+  EXPECT_TRUE(bits.Test(1000));
+
+  bits.Set(5).Set(kShardBits);
+  EXPECT_EQ(3, bits.Count());
+  EXPECT_EQ(3, bits.NumShards());
+  EXPECT_TRUE(bits.TestAndReset(5));
+  EXPECT_FALSE(bits.TestAndReset(5));
+  EXPECT_FALSE(bits.TestAndReset(600)) << "Unallocated shard holds unset bits";
+  bits.Reset(kShardBits).Reset(700);
+  EXPECT_EQ(3, bits.NumShards());
+  EXPECT_EQ(1, bits.Count());
+
+  bits.Resize(10);
+  EXPECT_EQ(1001, bits.Size()) << "Resize() must not shrink";
+  bits.Resize(5000);
+  EXPECT_EQ(5000, bits.Size());
+
+  bits.Reset();
+  EXPECT_EQ(0, bits.Count());
+  EXPECT_EQ(3, bits.NumShards());
+
+  EXPECT_THROW(bits.Reset(5000), std::out_of_range);
+  EXPECT_THROW(bits.TestAndReset(5000), std::out_of_range);
+}
+
+TEST_F(ConcurrentDynamicBitsetFixture, PushBackSnapshotTest) {
+  bits::ConcurrentDynamicBitset<std::uint8_t> bits{0, kShardBits};
+  bits::DynamicBitset<std::uint8_t> expected;
+
+  for (std::size_t bit{}; bit < kBits; ++bit) {
+    const bool value{bit % 3 == 0 || bit / 700 % 2 == 1};
+    EXPECT_EQ(bit, bits.PushBack(value));
+    expected.PushBack(value);
+  }
+
+  EXPECT_EQ(kBits, bits.Size());
+  EXPECT_EQ(expected.Count(), bits.Count());
+  EXPECT_EQ(expected, bits.Snapshot());
+  EXPECT_LT(0, bits.MemoryUsage());
+}
+
+TEST_F(ConcurrentDynamicBitsetFixture, ConcurrentGrowthTest) {
+  bits::ConcurrentDynamicBitset<> bits{0, kShardBits};
+  std::atomic<std::size_t> first_visits{};
+
+  // Threads grow the set from different ends and claim every bit exactly once
+  std::vector<std::thread> threads;
+  for (std::size_t thread{}; thread < kThreads; ++thread) {
+    threads.emplace_back([&bits, &first_visits, thread]() -> void {
+      std::size_t claimed{};
+      for (std::size_t step{}; step < kBits; ++step) {
+        const std::size_t index{thread & 1 ? kBits - 1 - step : (step * 7 + thread * 131) % kBits};
+        claimed += !bits.TestAndSet(index);
+      }
+      first_visits.fetch_add(claimed, std::memory_order_relaxed);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(kBits, first_visits.load());
+  EXPECT_EQ(kBits, bits.Size());
+  EXPECT_EQ(kBits, bits.Count());
+  EXPECT_EQ((kBits + kShardBits - 1) / kShardBits, bits.NumShards());
+  EXPECT_TRUE(bits.Snapshot().All());
+}
+
+TEST_F(ConcurrentDynamicBitsetFixture, ConcurrentPushBackTest) {
+  bits::ConcurrentDynamicBitset<unsigned char> bits{0, kShardBits};
+
+  // Every thread appends set bits and remembers their indices
+  std::vector<std::vector<std::size_t>> indices(kThreads);
+  std::vector<std::thread> threads;
+  for (std::size_t thread{}; thread < kThreads; ++thread) {
+    threads.emplace_back([&bits, &indices, thread]() -> void {
+      for (std::size_t step{}; step < kBits / kThreads; ++step) {
+        const bool value{step % 2 == 0};
+        const std::size_t index{bits.PushBack(value)};
+        if (value) {
+          indices[thread].push_back(index);
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  bits::DynamicBitset<unsigned char> expected(kBits);
+  expected.Reset();
+  for (const auto& thread_indices : indices) {
+    for (const std::size_t index : thread_indices) {
+      ASSERT_FALSE(expected.Test(index)) << "Indices must be unique";
+      expected.Set(index, true);
+    }
+  }
+  EXPECT_EQ(kBits, bits.Size());
+  EXPECT_EQ(kBits / 2, bits.Count());
+  EXPECT_EQ(expected, bits.Snapshot());
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/elias_fano.hpp>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+class EliasFanoFixture : public testing::Test {
+ protected:
+  template<typename Block>
+  static auto CheckSequence(const bits::EliasFano<Block>& sequence, const std::vector<std::size_t>& values) -> void {
+    ASSERT_EQ(values.size(), sequence.Size());
+    for (std::size_t index{}; index < values.size(); ++index) {
+      ASSERT_EQ(values[index], sequence.Access(index)) << "Index " << index;
+    }
+
+    // Every value, its neighbours and a few random probes against std::lower_bound
+    std::mt19937_64 engine{values.size()};
+    std::vector<std::size_t> probes{0, sequence.Universe() - 1, sequence.Universe()};
+    for (const std::size_t value : values) {
+      probes.insert(probes.end(), {value, value + 1, value ? value - 1 : 0});
+    }
+    for (int probe{}; probe < 1'000; ++probe) {
+      probes.push_back(engine() % sequence.Universe());
+    }
+    for (const std::size_t probe : probes) {
+      const auto expected{std::lower_bound(values.begin(), values.end(), probe)};
+      const auto [index, value]{sequence.NextGEQ(probe)};
+      ASSERT_EQ(static_cast<std::size_t>(expected - values.begin()), index) << "Probe " << probe;
+      ASSERT_EQ(expected == values.end() ? sequence.Universe() : *expected, value) << "Probe " << probe;
+    }
+  }
+};
+
+TEST_F(EliasFanoFixture, BitsetRoundTripTest) {
+  std::mt19937_64 engine{1};
+  for (const std::size_t universe : {1UL, 63UL, 1'000UL, 100'003UL}) {
+    for (const std::size_t permille : {0, 1, 30, 500, 1'000}) {
+      bits::DynamicBitset<> ids(universe);
+      bits::DynamicBitset<std::uint8_t> narrow_ids(universe);
+      std::vector<std::size_t> values;
+      for (std::size_t bit{}; bit < universe; ++bit) {
+        if (engine() % 1'000 < permille) {
+          ids.Set(bit, true);
+          narrow_ids.Set(bit, true);
+          values.push_back(bit);
+        }
+      }
+
+      const bits::EliasFano<> sequence{ids};
+      EXPECT_EQ(universe, sequence.Universe());
+      CheckSequence(sequence, values);
+      EXPECT_EQ(ids, sequence.ToDynamicBitset());
+
+      const bits::EliasFano<std::uint8_t> narrow{narrow_ids};
+      CheckSequence(narrow, values);
+      EXPECT_EQ(narrow_ids, narrow.ToDynamicBitset());
+    }
+  }
+}
+
+TEST_F(EliasFanoFixture, SequenceTest) {
+  // Clustered values with duplicates and long gaps exercise many empty buckets
+  std::mt19937_64 engine{2};
+  std::vector<std::size_t> values;
+  for (std::size_t value{}; values.size() < 20'000;) {
+    value += engine() % 16 == 0 ? engine() % 100'000 : engine() % 3;
+    values.push_back(value);
+  }
+  const bits::EliasFano<std::uint16_t> sequence{values.back() + 5, values};
+  EXPECT_EQ(std::bit_width((values.back() + 5) / values.size()) - 1, sequence.LowerBits());
+  CheckSequence(sequence, values);
+  EXPECT_LT(sequence.MemoryUsage() * 8 / values.size(), 2 + sequence.LowerBits() + 2)
+    << "Within 2 bits per value of the Elias-Fano bound";
+
+  const std::vector<std::size_t> wide{0, std::size_t{1} << 40, (std::size_t{1} << 40) + 1};
+  CheckSequence(bits::EliasFano<>{std::size_t{1} << 41, wide}, wide);
+
+  const bits::EliasFano<> empty;
+  EXPECT_EQ(0, empty.NextGEQ(0).first);
+  EXPECT_THROW(static_cast<void>(empty.Access(0)), std::out_of_range);
+  const bits::EliasFano<> huge_empty{std::size_t{1} << 40, {}};
+  EXPECT_EQ(0, huge_empty.Size());
+  EXPECT_LT(huge_empty.MemoryUsage(), 1'024) << "An empty sequence must not allocate upper bits for the universe";
+  EXPECT_EQ(std::make_pair(std::size_t{0}, std::size_t{1} << 40), huge_empty.NextGEQ(5));
+  const std::vector<std::size_t> unsorted{5, 3};
+  EXPECT_THROW((bits::EliasFano<>{10, unsorted}), std::invalid_argument);
+  EXPECT_THROW((bits::EliasFano<>{5, std::vector<std::size_t>{5}}), std::invalid_argument);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/ewah_bitset.hpp>
+#include <random>
+#include <stdexcept>
+
+class EwahBitsetFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{64 * 1000 + 37};
+
+  /**
+   * Builds a bitset of alternating long runs of zeros, ones and random words
+   * with a partial last word.
+   */
+  static auto MakeFlags(std::uint32_t seed) -> bits::DynamicBitset<> {
+    std::mt19937 engine{seed};
+    bits::DynamicBitset<> bits(kBits);
+    for (std::size_t bit{}; bit < kBits;) {
+      const std::size_t length{engine() % 2000 + 1};
+      const auto kind{engine() % 3};
+      for (const std::size_t last{std::min(bit + length, kBits)}; bit < last; ++bit) {
+        if (kind == 1 || (kind == 2 && engine() % 2)) {
+          bits.Set(bit, true);
+        }
+      }
+    }
+    return bits;
+  }
+};
+
+TEST_F(EwahBitsetFixture, ConstructorTest) {
+  bits::EwahBitset empty;
+  EXPECT_EQ(0, empty.Size());
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_TRUE(empty.None());
+  EXPECT_FALSE(empty.All());
+  EXPECT_EQ(0, empty.Decompress().Size());
+}
+
+TEST_F(EwahBitsetFixture, CompressDecompressTest) {
+  for (std::uint32_t seed{}; seed < 4; ++seed) {
+    const auto flat{MakeFlags(seed)};
+    const auto compressed{bits::EwahBitset::Compress(flat)};
+
+    EXPECT_EQ(flat.Size(), compressed.Size());
+    EXPECT_EQ(flat.Count(), compressed.Count());
+    EXPECT_EQ(flat, compressed.Decompress());
+    EXPECT_LT(compressed.MemoryUsage(), flat.NumBlocks() * sizeof(std::size_t));
+  }
+
+  bits::DynamicBitset<unsigned char> bytes(1000);
+  bytes.Set(0, true).Set(7, true).Set(999, true);
+  const auto from_bytes{bits::EwahBitset::Compress(bytes)};
+  EXPECT_EQ(3, from_bytes.Count());
+  EXPECT_EQ(bytes, from_bytes.Decompress<unsigned char>());
+  EXPECT_EQ(bytes.ToString(), from_bytes.Decompress<unsigned short>().ToString());
+
+  bits::DynamicBitset<> full(1 << 20);
+  full.Set();
+  full.Resize((1 << 20) + 5, true);
+  const auto from_full{bits::EwahBitset::Compress(full)};
+  EXPECT_TRUE(from_full.All());
+  EXPECT_LT(from_full.MemoryUsage(), 64) << "Full words must be stored as one run";
+  EXPECT_EQ(full, from_full.Decompress());
+}
+
+TEST_F(EwahBitsetFixture, AppendTest) {
+  const auto flat{MakeFlags(5)};
+  bits::EwahBitset pushed;
+  for (std::size_t bit{}; bit < flat.Size(); ++bit) {
+    pushed.PushBack(flat.Test(bit));
+  }
+  EXPECT_EQ(bits::EwahBitset::Compress(flat), pushed);
+
+  // Unaligned appends of words, runs and single bits
+  bits::DynamicBitset<> expected;
+  bits::EwahBitset appended;
+  std::mt19937_64 engine{7};
+  for (std::size_t step{}; step < 2000; ++step) {
+    const std::uint64_t word{engine()};
+    const std::size_t count{word % 65};
+    if (step % 3 == 0) {
+      appended.AppendBits(word, count);
+      for (std::size_t bit{}; bit < count; ++bit) {
+        expected.PushBack(word >> bit & 1);
+      }
+    } else {
+      const bool value{step % 3 == 1};
+      const std::size_t length{count * (step % 7)};
+      appended.AppendRun(value, length);
+      for (std::size_t bit{}; bit < length; ++bit) {
+        expected.PushBack(value);
+      }
+    }
+  }
+  EXPECT_EQ(expected.Size(), appended.Size());
+  EXPECT_EQ(expected.Count(), appended.Count());
+  EXPECT_EQ(expected, appended.Decompress());
+  EXPECT_EQ(bits::EwahBitset::Compress(expected), appended);
+
+  bits::EwahBitset runs;
+  runs.AppendRun(false, 1'000'000);
+  runs.PushBack(true);
+  runs.AppendRun(true, 1'000'000);
+  EXPECT_EQ(1'000'001, runs.Count());
+  EXPECT_TRUE(runs.Any());
+  EXPECT_LT(runs.MemoryUsage(), 128);
+
+  runs.Clear();
+  EXPECT_TRUE(runs.Empty());
+  EXPECT_EQ(0, runs.Count());
+}
+
+TEST_F(EwahBitsetFixture, BitwiseOperatorsTest) {
+  for (std::uint32_t seed{}; seed < 8; ++seed) {
+    const auto lhs_flat{MakeFlags(seed)};
+    const auto rhs_flat{MakeFlags(seed + 100)};
+    const auto lhs{bits::EwahBitset::Compress(lhs_flat)};
+    const auto rhs{bits::EwahBitset::Compress(rhs_flat)};
+
+    EXPECT_EQ(lhs_flat & rhs_flat, (lhs & rhs).Decompress());
+    EXPECT_EQ(lhs_flat | rhs_flat, (lhs | rhs).Decompress());
+    EXPECT_EQ(lhs_flat ^ rhs_flat, (lhs ^ rhs).Decompress());
+    EXPECT_EQ(lhs_flat & ~rhs_flat, bits::EwahBitset{lhs}.AndNot(rhs).Decompress());
+    EXPECT_EQ(rhs_flat & ~lhs_flat, bits::EwahBitset{rhs}.AndNot(lhs).Decompress());
+    EXPECT_EQ((lhs_flat | rhs_flat).Count(), (lhs | rhs).Count());
+
+    // Results stay canonical
+    EXPECT_EQ(bits::EwahBitset::Compress(lhs_flat ^ rhs_flat), lhs ^ rhs);
+    EXPECT_EQ(lhs, lhs & lhs);
+    EXPECT_TRUE((lhs ^ lhs).None());
+  }
+
+  bits::EwahBitset small;
+  small.AppendRun(false, 10);
+  bits::EwahBitset large;
+  large.AppendRun(false, 11);
+  EXPECT_THROW(small &= large, std::invalid_argument);
+  EXPECT_THROW(small |= large, std::invalid_argument);
+  EXPECT_THROW(small ^= large, std::invalid_argument);
+  EXPECT_THROW(small.AndNot(large), std::invalid_argument);
+}
+
+TEST_F(EwahBitsetFixture, EqualityOperatorTest) {
+  const auto flat{MakeFlags(9)};
+  const auto compressed{bits::EwahBitset::Compress(flat)};
+  auto modified{flat};
+  modified.Flip(flat.Size() - 1);
+
+  EXPECT_EQ(compressed, bits::EwahBitset::Compress(flat));
+  EXPECT_NE(compressed, bits::EwahBitset::Compress(modified));
+  modified.PopBack();
+  EXPECT_NE(compressed, bits::EwahBitset::Compress(modified));
+}
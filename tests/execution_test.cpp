@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/execution.hpp>
+#include <execution>
+#include <functional>
+#include <stdexcept>
+
+#include "test_utils.hpp"
+
+class ExecutionFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{(1 << 18) + 45};
+
+  /**
+   * Checks every policy overload against member functions.
+   */
+  template<typename Block, typename Policy>
+  static auto CompareWithMembers(const Policy& policy) -> void {
+    const auto lhs{bits::test::MakeRandom<Block>(kBits, 1)};
+    const auto rhs{bits::test::MakeRandom<Block>(kBits, 2)};
+    bits::DynamicBitset<Block> dst(kBits);
+
+    EXPECT_EQ(lhs.Count(), bits::Count(policy, lhs));
+    EXPECT_EQ(lhs & rhs, bits::And(policy, dst, lhs, rhs));
+    EXPECT_EQ(lhs | rhs, bits::Or(policy, dst, lhs, rhs));
+    EXPECT_EQ(lhs ^ rhs, bits::Xor(policy, dst, lhs, rhs));
+    EXPECT_EQ(lhs & ~rhs, bits::AndNot(policy, dst, lhs, rhs));
+    EXPECT_EQ(~lhs, bits::Transform(policy, dst, lhs, std::bit_not<Block>{}));
+
+    auto aliased{lhs};
+    bits::And(policy, aliased, aliased, rhs);
+    EXPECT_EQ(lhs & rhs, aliased);
+
+    bits::DynamicBitset<Block> zeros(kBits);
+    EXPECT_FALSE(bits::Any(policy, zeros));
+    EXPECT_TRUE(bits::None(policy, zeros));
+    zeros.Set(kBits - 1, true);
+    EXPECT_TRUE(bits::Any(policy, zeros)) << "Last bit must be found";
+    EXPECT_FALSE(bits::None(policy, zeros));
+
+    bits::DynamicBitset<Block> ones(kBits);
+    ones.Set();
+    EXPECT_TRUE(bits::All(policy, ones));
+    EXPECT_EQ(kBits, bits::Count(policy, ones)) << "Bits past Size() must not be counted";
+    ones.Reset(kBits / 2);
+    EXPECT_FALSE(bits::All(policy, ones));
+    EXPECT_FALSE(bits::All(policy, lhs));
+  }
+};
+
+TEST_F(ExecutionFixture, PolicyOverloadsTest) {
+  CompareWithMembers<std::uint8_t>(std::execution::seq);
+  CompareWithMembers<std::uint8_t>(std::execution::par);
+  CompareWithMembers<std::uint16_t>(std::execution::par_unseq);
+  CompareWithMembers<std::uint32_t>(std::execution::unseq);
+  CompareWithMembers<std::uint64_t>(std::execution::par_unseq);
+}
+
+TEST_F(ExecutionFixture, EmptyAndInvalidSizeTest) {
+  const bits::DynamicBitset<> empty;
+  EXPECT_EQ(0, bits::Count(std::execution::par, empty));
+  EXPECT_FALSE(bits::Any(std::execution::par, empty));
+  EXPECT_TRUE(bits::None(std::execution::par, empty));
+  EXPECT_FALSE(bits::All(std::execution::par, empty));
+
+  bits::DynamicBitset<> dst(10);
+  const bits::DynamicBitset<> lhs(10);
+  const bits::DynamicBitset<> rhs(11);
+  EXPECT_THROW(bits::And(std::execution::par, dst, lhs, rhs), std::invalid_argument);
+  EXPECT_THROW(bits::Or(std::execution::par, dst, rhs, rhs), std::invalid_argument);
+  EXPECT_THROW(bits::Xor(std::execution::seq, dst, empty, empty), std::invalid_argument);
+  EXPECT_THROW(bits::Transform(std::execution::seq, dst, rhs, std::bit_not<>{}), std::invalid_argument);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/hierarchical_bitset.hpp>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+class HierarchicalBitsetFixture : public testing::Test {
+ protected:
+  /**
+   * Compares searches of `bits` with `expected` by iterating both directions and
+   * by random `FindNext()`/`FindPrev()` queries.
+   */
+  template<typename Block>
+  static auto CheckSearches(
+    const bits::HierarchicalBitset<Block>& bits, const std::set<std::size_t>& expected, std::mt19937_64& engine
+  ) -> void {
+    const std::size_t size{bits.Size()};
+    EXPECT_EQ(expected.size(), bits.Count());
+    EXPECT_EQ(!expected.empty(), bits.Any());
+
+    std::vector<std::size_t> forward;
+    for (std::size_t index{bits.FindFirst()}; index < size; index = bits.FindNext(index)) {
+      forward.push_back(index);
+    }
+    ASSERT_EQ(std::vector<std::size_t>(expected.begin(), expected.end()), forward);
+
+    std::vector<std::size_t> backward;
+    for (std::size_t index{bits.FindLast()}; index < size; index = bits.FindPrev(index)) {
+      backward.push_back(index);
+    }
+    ASSERT_EQ(std::vector<std::size_t>(expected.rbegin(), expected.rend()), backward);
+
+    for (int query{}; query < 1'000; ++query) {
+      const std::size_t index{engine() % size};
+      const auto next{expected.upper_bound(index)};
+      EXPECT_EQ(next == expected.end() ? size : *next, bits.FindNext(index)) << "Index " << index;
+      const auto prev{expected.lower_bound(index)};
+      EXPECT_EQ(prev == expected.begin() ? size : *std::prev(prev), bits.FindPrev(index)) << "Index " << index;
+    }
+  }
+
+  template<typename Block>
+  static auto RandomUpdates(std::size_t size, std::size_t updates, std::uint32_t seed) -> void {
+    std::mt19937_64 engine{seed};
+    bits::HierarchicalBitset<Block> bits{size};
+    std::set<std::size_t> expected;
+    CheckSearches(bits, expected, engine);
+
+    // Updates cluster in a few regions, so summary words turn zero and non-zero again
+    for (std::size_t update{}; update < updates; ++update) {
+      const std::size_t region{engine() % 4 * (size / 4)};
+      const std::size_t index{region + engine() % std::min<std::size_t>(size / 4, 4'096)};
+      if (engine() % 3) {
+        bits.Set(index, true);
+        expected.insert(index);
+      } else {
+        bits.Reset(index);
+        expected.erase(index);
+      }
+    }
+    CheckSearches(bits, expected, engine);
+
+    for (const std::size_t index : std::set<std::size_t>{expected}) {
+      if (index % 5) {
+        bits.Set(index, false);
+        expected.erase(index);
+      }
+    }
+    CheckSearches(bits, expected, engine);
+    EXPECT_EQ(expected.size(), bits.Bitset().Count());
+  }
+};
+
+TEST_F(HierarchicalBitsetFixture, SearchTest) {
+  RandomUpdates<std::uint64_t>(1'000'003, 20'000, 1);
+  RandomUpdates<std::uint8_t>(300'007, 20'000, 2);
+  RandomUpdates<std::uint32_t>(4'097, 3'000, 3);
+  RandomUpdates<std::uint16_t>(70, 200, 4);
+
+  bits::HierarchicalBitset<> bits{std::size_t{1} << 24};
+  EXPECT_EQ(3, bits.Levels()) << "2^18 blocks need 4096, 64 and 1 summary words";
+  EXPECT_TRUE(bits.None());
+  EXPECT_EQ(bits.Size(), bits.FindFirst());
+  EXPECT_EQ(bits.Size(), bits.FindLast());
+  bits.Set(0, true).Set(bits.Size() - 1, true);
+  EXPECT_EQ(bits.Size() - 1, bits.FindNext(0));
+  EXPECT_EQ(0, bits.FindPrev(bits.Size() - 1));
+  EXPECT_EQ(bits.Size() - 1, bits.FindPrev(bits.Size() + 10)) << "Past the end searches the whole bitset";
+  EXPECT_EQ(bits.Size(), bits.FindPrev(0));
+  bits.Reset();
+  EXPECT_TRUE(bits.None());
+  EXPECT_EQ(bits.Size(), bits.FindFirst());
+}
+
+TEST_F(HierarchicalBitsetFixture, ConstructionAndErrorsTest) {
+  bits::DynamicBitset<std::uint8_t> source(1'003);
+  source.Set(3, true).Set(700, true).Set(999, true);
+  source.Data()[source.Size() / 8] |= 0xf0;  // Dirty bits past Size() must be dropped
+  const bits::HierarchicalBitset<std::uint8_t> bits{source};
+  EXPECT_EQ(3, bits.Count());
+  EXPECT_EQ(700, bits.FindNext(3));
+  EXPECT_EQ(999, bits.FindLast());
+  EXPECT_EQ(bits.Size(), bits.FindNext(999));
+
+  const bits::HierarchicalBitset<> empty;
+  EXPECT_EQ(0, empty.Levels());
+  EXPECT_TRUE(empty.None());
+  EXPECT_EQ(0, empty.FindFirst());
+  EXPECT_EQ(0, empty.FindLast());
+
+  bits::HierarchicalBitset<> small{10};
+  EXPECT_THROW(small.Set(10, true), std::out_of_range);
+  EXPECT_THROW(small.Reset(10), std::out_of_range);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/incremental.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+class IncrementalFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{1000};
+};
+
+TEST_F(IncrementalFixture, CountIncrementallyTest) {
+  const auto bits{bits::test::MakeRandom<std::uint16_t>(kBits, 1)};
+
+  std::vector<std::size_t> partials;
+  for (const std::size_t partial : bits::CountIncrementally(bits, 10)) {
+    partials.push_back(partial);
+  }
+  ASSERT_EQ((bits.NumBlocks() + 9) / 10, partials.size()) << "Every step must process at most budget blocks";
+  EXPECT_TRUE(std::is_sorted(partials.begin(), partials.end()));
+  EXPECT_EQ(bits.Count(), partials.back());
+
+  const bits::DynamicBitset<> empty;
+  std::size_t steps{};
+  for (const std::size_t partial : bits::CountIncrementally(empty, 1)) {
+    EXPECT_EQ(0, partial);
+    ++steps;
+  }
+  EXPECT_EQ(1, steps) << "Empty bitset must still yield the count";
+
+  EXPECT_THROW(static_cast<void>(bits::CountIncrementally(bits, 0)), std::invalid_argument);
+}
+
+TEST_F(IncrementalFixture, ForEachSetBitChunkedTest) {
+  const auto bits{bits::test::MakeRandom<std::uint8_t>(kBits + 3, 2)};
+
+  std::vector<std::size_t> indices;
+  std::size_t last{};
+  for (const std::size_t processed : bits::ForEachSetBitChunked(bits, 7, [&indices](std::size_t index) -> void {
+         indices.push_back(index);
+       })) {
+    EXPECT_LE(processed - last, 7 * 8);
+    for (const std::size_t index : indices) {
+      EXPECT_LT(index, processed) << "Only processed bits may be visited";
+    }
+    last = processed;
+  }
+  EXPECT_EQ(bits.Size(), last);
+
+  std::vector<std::size_t> expected;
+  for (std::size_t index{}; index < bits.Size(); ++index) {
+    if (bits.Test(index)) {
+      expected.push_back(index);
+    }
+  }
+  EXPECT_EQ(expected, indices);
+}
+
+TEST_F(IncrementalFixture, ToStringIncrementallyTest) {
+  const auto bits{bits::test::MakeRandom<std::uint32_t>(kBits + 5, 3)};
+
+  std::string result;
+  for (const std::string_view piece : bits::ToStringIncrementally(bits, 4)) {
+    EXPECT_LE(piece.size(), 4 * 32);
+    result += piece;
+  }
+  EXPECT_EQ(bits.ToString(), result);
+
+  const bits::DynamicBitset<> empty;
+  for (const std::string_view piece : bits::ToStringIncrementally(empty, 4)) {
+    ADD_FAILURE() << "Empty bitset has no pieces: " << piece;
+  }
+}
+
+TEST_F(IncrementalFixture, ShiftIncrementallyTest) {
+  const auto source{bits::test::MakeRandom<std::uint8_t>(kBits + 3, 4)};
+  const std::size_t size{source.Size()};
+  for (const std::size_t offset : {0UL, 1UL, 7UL, 8UL, 9UL, 64UL, 333UL, kBits + 2, kBits + 3, kBits + 100}) {
+    auto bits{source};
+    for (const std::size_t progress : bits::ShiftRightIncrementally(bits, offset, 5)) {
+      EXPECT_LE(progress, size);
+    }
+    for (std::size_t index{}; index < size; ++index) {
+      ASSERT_EQ(index >= offset && source.Test(index - offset), bits.Test(index)) << ">> " << offset << " at " << index;
+    }
+
+    bits = source;
+    for (const std::size_t progress : bits::ShiftLeftIncrementally(bits, offset, 3)) {
+      EXPECT_LE(progress, size);
+    }
+    for (std::size_t index{}; index < size; ++index) {
+      ASSERT_EQ(offset < size - index && source.Test(index + offset), bits.Test(index))
+        << "<< " << offset << " at " << index;
+    }
+  }
+
+  bits::DynamicBitset<> empty;
+  EXPECT_THROW(static_cast<void>(bits::ShiftLeftIncrementally(empty, 1, 1)), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(bits::ShiftRightIncrementally(empty, 1, 1)), std::out_of_range);
+  auto bits{source};
+  EXPECT_THROW(static_cast<void>(bits::ShiftRightIncrementally(bits, 1, 0)), std::invalid_argument);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/execution.hpp>
+#include <execution>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "test_utils.hpp"
+
+class IndicesFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{(1 << 18) + 45};
+
+  template<typename Index, typename Block>
+  static auto Reference(const bits::DynamicBitset<Block>& bits) -> std::vector<Index> {
+    std::vector<Index> result;
+    for (std::size_t index{bits.FindFirst()}; index != bits.Size(); index = bits.FindNext(index)) {
+      result.push_back(static_cast<Index>(index));
+    }
+    return result;
+  }
+
+  /**
+   * Checks member and policy decoders against a `FindNext()` walk.
+   */
+  template<typename Block, typename Index>
+  static auto CompareWithReference(bool sparse) -> void {
+    const auto bits{bits::test::MakeRandom<Block>(kBits, 1, sparse)};
+    const auto expected{Reference<Index>(bits)};
+
+    std::vector<Index> indices(expected.size() + 3);
+    EXPECT_EQ(expected.size(), bits.ToIndices(std::span{indices}));
+    indices.resize(expected.size());
+    EXPECT_EQ(expected, indices);
+
+    EXPECT_EQ(expected, bits::ToIndices<Index>(std::execution::seq, bits));
+    EXPECT_EQ(expected, bits::ToIndices<Index>(std::execution::par_unseq, bits));
+    std::vector<Index> parallel(expected.size());
+    EXPECT_EQ(expected.size(), bits::ToIndices(std::execution::par, bits, std::span{parallel}));
+    EXPECT_EQ(expected, parallel);
+  }
+};
+
+TEST_F(IndicesFixture, ToIndicesTest) {
+  for (const bool sparse : {false, true}) {
+    CompareWithReference<std::uint8_t, std::uint32_t>(sparse);
+    CompareWithReference<std::uint16_t, std::uint64_t>(sparse);
+    CompareWithReference<std::uint32_t, std::uint32_t>(sparse);
+    CompareWithReference<std::uint64_t, std::uint64_t>(sparse);
+    CompareWithReference<std::uint64_t, std::uint32_t>(sparse);
+  }
+}
+
+TEST_F(IndicesFixture, TailAndInvalidOutputTest) {
+  bits::DynamicBitset<std::uint64_t> bits(70);
+  bits.Set();
+  bits.Data()[1] = ~std::uint64_t{};
+  std::vector<std::uint16_t> indices(70);
+  EXPECT_EQ(70, bits.ToIndices(std::span{indices})) << "Bits past Size() must not be decoded";
+  EXPECT_EQ(69, indices.back());
+  EXPECT_EQ(70, bits::ToIndices(std::execution::par, bits).size());
+
+  std::vector<std::uint16_t> small(69);
+  EXPECT_THROW(static_cast<void>(bits.ToIndices(std::span{small})), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(bits::ToIndices(std::execution::par, bits, std::span{small})), std::out_of_range);
+
+  const bits::DynamicBitset<> wide(300);
+  std::vector<std::uint8_t> narrow(1);
+  EXPECT_THROW(static_cast<void>(wide.ToIndices(std::span{narrow})), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(bits::ToIndices<std::uint8_t>(std::execution::seq, wide)), std::invalid_argument);
+
+  const bits::DynamicBitset<> empty;
+  EXPECT_EQ(0, empty.ToIndices(std::span<std::uint32_t>{}));
+  EXPECT_TRUE(bits::ToIndices(std::execution::par, empty).empty());
+}
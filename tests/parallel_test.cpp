@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/thread_pool.hpp>
+
+#include "test_utils.hpp"
+
+namespace {
+
+/**
+ * Sequential executor which records how it was used.
+ */
+class RecordingExecutor final : public bits::ParallelExecutor {
+ public:
+  [[nodiscard]] auto Concurrency() const noexcept -> std::size_t override { return 4; }
+
+  auto Run(std::size_t tasks, TaskType task, void* context) noexcept -> void override {
+    ++runs;
+    last_tasks = tasks;
+    for (std::size_t index{tasks}; index--;) {
+      task(context, index);
+    }
+  }
+
+  std::size_t runs{};
+  std::size_t last_tasks{};
+};
+
+}  // namespace
+
+class ParallelFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{(1 << 20) + 77};
+
+  auto TearDown() -> void override { bits::SetParallelExecutor(nullptr); }
+
+  /**
+   * Runs every parallel operation with `executor` installed and compares with sequential results.
+   */
+  template<typename Block>
+  static auto CompareWithSequential(bits::ParallelExecutor& executor) -> void {
+    const auto lhs{bits::test::MakeRandom<Block>(kBits, 1)};
+    const auto rhs{bits::test::MakeRandom<Block>(kBits, 2)};
+
+    bits::SetParallelExecutor(nullptr);
+    const auto count{lhs.Count()};
+    const auto and_result{lhs & rhs};
+    const auto or_result{lhs | rhs};
+    const auto xor_result{lhs ^ rhs};
+    auto flipped{lhs};
+    flipped.Flip();
+
+    bits::SetParallelExecutor(&executor, 0);
+    EXPECT_EQ(count, lhs.Count());
+    EXPECT_EQ(and_result, lhs & rhs);
+    EXPECT_EQ(or_result, lhs | rhs);
+    EXPECT_EQ(xor_result, lhs ^ rhs);
+    auto parallel_flipped{lhs};
+    parallel_flipped.Flip();
+    EXPECT_EQ(flipped, parallel_flipped);
+    EXPECT_EQ(lhs, bits::DynamicBitset<Block>{lhs});
+    EXPECT_NE(lhs, rhs);
+
+    auto changed{lhs};
+    changed.Flip(kBits / 3);
+    EXPECT_NE(lhs, changed) << "Mismatch in the middle chunk must be found";
+
+    auto filled{lhs};
+    filled.Set();
+    EXPECT_EQ(kBits, filled.Count());
+    EXPECT_TRUE(filled.All());
+    filled.Reset();
+    EXPECT_EQ(0, filled.Count());
+    EXPECT_TRUE(filled.None());
+  }
+};
+
+TEST_F(ParallelFixture, ExecutorInstallationTest) {
+  RecordingExecutor executor;
+  bits::DynamicBitset<> bits(kBits);
+  EXPECT_EQ(nullptr, bits::GetParallelExecutor());
+
+  bits.Set();
+  EXPECT_EQ(0, executor.runs) << "Parallel execution must be opt-in";
+
+  bits::SetParallelExecutor(&executor, bits.NumBlocks() * sizeof(std::size_t) + 1);
+  EXPECT_EQ(&executor, bits::GetParallelExecutor());
+  EXPECT_EQ(kBits, bits.Count());
+  EXPECT_EQ(0, executor.runs) << "Storage below threshold must stay sequential";
+
+  // Count() runs over all blocks but the last one
+  bits::SetParallelExecutor(&executor, (bits.NumBlocks() - 1) * sizeof(std::size_t));
+  bits.Reset();
+  EXPECT_EQ(1, executor.runs);
+  EXPECT_LE(executor.last_tasks, executor.Concurrency());
+  EXPECT_GE(executor.last_tasks, executor.Concurrency() - 1);
+  EXPECT_EQ(0, bits.Count());
+  EXPECT_EQ(2, executor.runs);
+
+  bits::DynamicBitset<> small(64 * 4);
+  small.Set();
+  EXPECT_EQ(2, executor.runs) << "Storage of a few cache lines must stay sequential";
+}
+
+TEST_F(ParallelFixture, RecordingExecutorTest) {
+  RecordingExecutor executor;
+  CompareWithSequential<std::uint8_t>(executor);
+  CompareWithSequential<std::uint16_t>(executor);
+  CompareWithSequential<std::uint32_t>(executor);
+  CompareWithSequential<std::uint64_t>(executor);
+  EXPECT_LT(0, executor.runs);
+}
+
+TEST_F(ParallelFixture, ThreadPoolExecutorTest) {
+  bits::ThreadPoolExecutor pool{4};
+  EXPECT_EQ(4, pool.Concurrency());
+  CompareWithSequential<std::uint8_t>(pool);
+  CompareWithSequential<std::uint64_t>(pool);
+
+  bits::ThreadPoolExecutor single{1};
+  EXPECT_EQ(1, single.Concurrency());
+  CompareWithSequential<std::uint64_t>(single);
+}
+
+TEST_F(ParallelFixture, ThreadPoolNestedRunTest) {
+  bits::ThreadPoolExecutor pool{3};
+  struct Context {
+    bits::ThreadPoolExecutor& pool;
+    std::atomic<std::size_t> calls;
+  } context{pool, 0};
+
+  pool.Run(
+    8,
+    [](void* erased, std::size_t) noexcept -> void {
+      auto& self{*static_cast<Context*>(erased)};
+      self.pool.Run(
+        4,
+        [](void* inner, std::size_t) noexcept -> void {
+          static_cast<Context*>(inner)->calls.fetch_add(1, std::memory_order_relaxed);
+        },
+        erased
+      );
+    },
+    &context
+  );
+
+  EXPECT_EQ(32, context.calls.load());
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/partition.hpp>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class PartitionFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kBits{100'003};
+  static constexpr std::size_t kThreads{4};
+
+  /**
+   * Checks that partitions cover `bits` in order and split it at cache line boundaries only.
+   */
+  template<typename Block>
+  static auto CheckLayout(bits::DynamicBitset<Block>& bits, std::size_t parts) -> void {
+    const auto partitions{bits::Partition(bits, parts)};
+    ASSERT_EQ(parts, partitions.size());
+    EXPECT_EQ(0, partitions.front().Begin());
+    EXPECT_EQ(bits.Size(), partitions.back().End());
+
+    std::size_t blocks{};
+    for (std::size_t part{1}; part < parts; ++part) {
+      ASSERT_EQ(partitions[part - 1].End(), partitions[part].Begin()) << "Partitions must be consecutive";
+      if (!partitions[part].Empty()) {
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(partitions[part].Data()) % 64) << "Partition " << part;
+      }
+    }
+    for (const auto& partition : partitions) {
+      blocks += partition.NumBlocks();
+    }
+    EXPECT_EQ((bits.Size() + std::numeric_limits<Block>::digits - 1) / std::numeric_limits<Block>::digits, blocks)
+      << "Every block must be owned by exactly one partition";
+  }
+};
+
+TEST_F(PartitionFixture, LayoutTest) {
+  bits::DynamicBitset<std::uint8_t> bytes(kBits);
+  bits::DynamicBitset<std::uint64_t> words(kBits);
+  for (const std::size_t parts : {1UL, 2UL, 3UL, 7UL, 64UL}) {
+    CheckLayout(bytes, parts);
+    CheckLayout(words, parts);
+  }
+
+  bits::DynamicBitset<> small(100);
+  CheckLayout(small, 5);
+  bits::DynamicBitset<> empty;
+  const auto partitions{bits::Partition(empty, 3)};
+  EXPECT_EQ(3, partitions.size());
+  EXPECT_TRUE(partitions[1].Empty());
+  EXPECT_EQ(0, partitions[2].Count());
+  EXPECT_THROW(static_cast<void>(bits::Partition(small, 0)), std::invalid_argument);
+}
+
+TEST_F(PartitionFixture, AccessTest) {
+  bits::DynamicBitset<std::uint16_t> bits(kBits);
+  auto partitions{bits::Partition(bits, 3)};
+  auto& middle{partitions[1]};
+
+  middle.Set(middle.Begin(), true).Set(middle.End() - 1, true).Flip(middle.Begin() + 1);
+  EXPECT_TRUE(bits.Test(middle.Begin()));
+  EXPECT_TRUE(middle.Test(middle.Begin() + 1));
+  EXPECT_EQ(3, middle.Count());
+  EXPECT_EQ(3, bits.Count());
+  middle.Reset(middle.Begin());
+  EXPECT_FALSE(middle.Test(middle.Begin()));
+
+  EXPECT_THROW(middle.Set(middle.End(), true), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(middle.Test(middle.Begin() - 1)), std::out_of_range);
+  EXPECT_THROW(middle.Reset(kBits), std::out_of_range);
+
+  partitions.back().Set();
+  EXPECT_EQ(partitions.back().Size(), partitions.back().Count()) << "Bits past Size() must not be counted";
+  EXPECT_EQ(partitions.back().Size() + 2, bits.Count());
+  partitions.back().Flip();
+  partitions.front().Set().Reset();
+  EXPECT_EQ(2, bits.Count());
+}
+
+TEST_F(PartitionFixture, ConcurrentFillTest) {
+  bits::DynamicBitset<std::uint8_t> bits(kBits);
+  auto partitions{bits::Partition(bits, kThreads)};
+
+  // Plain writes next to partition boundaries must not lose updates of the neighbours
+  std::vector<std::thread> threads;
+  for (std::size_t thread{}; thread < kThreads; ++thread) {
+    threads.emplace_back([&partition = partitions[thread]]() -> void {
+      for (std::size_t round{}; round < 8; ++round) {
+        for (std::size_t index{partition.Begin()}; index < partition.End(); ++index) {
+          partition.Set(index, round % 2 == 0 || index % 3 == 0);
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (std::size_t index{}; index < kBits; ++index) {
+    ASSERT_EQ(index % 3 == 0, bits.Test(index)) << index;
+  }
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <dynamic_bitset/shift_and_matcher.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class ShiftAndMatcherFixture : public testing::Test {
+ protected:
+  template<typename Block>
+  static auto Check(const std::vector<std::string_view>& patterns, std::string_view text) -> void {
+    // Every occurrence found with std::string_view::find, ordered by the last character
+    std::vector<std::pair<std::size_t, std::size_t>> expected;
+    for (std::size_t pattern{}; pattern < patterns.size(); ++pattern) {
+      for (std::size_t position{text.find(patterns[pattern])}; position != std::string_view::npos;
+           position = text.find(patterns[pattern], position + 1)) {
+        expected.emplace_back(position + patterns[pattern].size(), pattern);
+      }
+    }
+    std::ranges::sort(expected);
+
+    const bits::ShiftAndMatcher<Block> matcher{patterns};
+    std::vector<std::pair<std::size_t, std::size_t>> actual;
+    matcher.Scan(text, [&actual, &patterns](std::size_t pattern, std::size_t position) {
+      actual.emplace_back(position + patterns[pattern].size(), pattern);
+    });
+    ASSERT_EQ(expected, actual);
+    EXPECT_EQ(expected.size(), matcher.Count(text));
+    const std::size_t first{
+      expected.empty() ? std::string_view::npos : expected.front().first - patterns[expected.front().second].size()
+    };
+    EXPECT_EQ(first, matcher.Find(text));
+  }
+};
+
+TEST_F(ShiftAndMatcherFixture, MatchTest) {
+  // A two-letter alphabet makes long overlapping matches frequent
+  std::mt19937_64 engine{1};
+  std::string text(20'000, 'a');
+  for (char& character : text) {
+    character = engine() % 8 ? 'a' : 'b';
+  }
+
+  std::vector<std::string> storage;
+  for (const std::size_t length : {1, 7, 63, 64, 65, 130, 600}) {
+    storage.push_back(text.substr(engine() % (text.size() - length), length));
+  }
+  storage.emplace_back(100, 'a');
+  storage.emplace_back("\xff\x80 binary");
+  text += storage.back();
+  const std::vector<std::string_view> patterns(storage.begin(), storage.end());
+
+  for (const std::string_view pattern : patterns) {
+    Check<std::uint64_t>({pattern}, text);
+    Check<std::uint8_t>({pattern}, text);
+  }
+  Check<std::uint64_t>(patterns, text);
+  Check<std::uint8_t>(patterns, text);
+  Check<std::uint32_t>({patterns[0], patterns[0], patterns[7]}, text);
+  Check<std::uint16_t>({patterns[2], patterns[5], patterns[6], patterns[1]}, text);
+
+  const bits::ShiftAndMatcher<> matcher{patterns};
+  EXPECT_EQ(patterns.size(), matcher.Patterns());
+  EXPECT_EQ(1 + 7 + 63 + 64 + 65 + 130 + 600 + 100 + 9, matcher.StateBits());
+  EXPECT_EQ(std::string_view::npos, matcher.Find(""));
+}
+
+TEST_F(ShiftAndMatcherFixture, ErrorsTest) {
+  const bits::ShiftAndMatcher<> none;
+  EXPECT_EQ(0, none.Patterns());
+  EXPECT_EQ(0, none.Count("text"));
+  EXPECT_EQ(std::string_view::npos, none.Find("text"));
+
+  const std::vector<std::string_view> patterns{"a", ""};
+  EXPECT_THROW(bits::ShiftAndMatcher<>{patterns}, std::invalid_argument);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <dynamic_bitset/slot_allocator.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class SlotAllocatorFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kSlots{1000};
+  static constexpr std::size_t kThreads{4};
+};
+
+TEST_F(SlotAllocatorFixture, AcquireReleaseTest) {
+  bits::BitmapSlotAllocator<std::uint8_t> slots{kSlots};
+  EXPECT_EQ(kSlots, slots.Size());
+  EXPECT_EQ(0, slots.Count());
+
+  std::vector<bool> acquired(kSlots);
+  for (std::size_t slot{}; slot < kSlots; ++slot) {
+    const std::size_t index{slots.Acquire()};
+    ASSERT_LT(index, kSlots);
+    ASSERT_FALSE(acquired[index]) << "Slot must not be handed out twice";
+    acquired[index] = true;
+  }
+  EXPECT_EQ(kSlots, slots.Count());
+  EXPECT_EQ(kSlots, slots.Acquire()) << "Full pool must return Size()";
+
+  slots.Release(123);
+  slots.Release(kSlots - 1);
+  EXPECT_FALSE(slots.Test(123));
+  EXPECT_EQ(kSlots - 2, slots.Count());
+  const std::size_t first{slots.Acquire()};
+  const std::size_t second{slots.Acquire()};
+  EXPECT_EQ(123 + kSlots - 1, first + second) << "Released slots must be found again";
+  EXPECT_EQ(kSlots, slots.Acquire());
+
+  EXPECT_THROW(slots.Release(kSlots), std::out_of_range);
+  slots.Release(5);
+  EXPECT_THROW(slots.Release(5), std::invalid_argument);
+
+  bits::BitmapSlotAllocator<> empty{0};
+  EXPECT_EQ(0, empty.Acquire());
+  EXPECT_EQ(0, empty.AcquireN(2));
+}
+
+TEST_F(SlotAllocatorFixture, AcquireNTest) {
+  bits::BitmapSlotAllocator<std::uint16_t> slots{kSlots};
+
+  const std::size_t run{slots.AcquireN(100)};
+  ASSERT_LT(run, kSlots);
+  EXPECT_EQ(100, slots.Count());
+  for (std::size_t slot{run}; slot < run + 100; ++slot) {
+    EXPECT_TRUE(slots.Test(slot));
+  }
+
+  // Leave single free slots between acquired ones, so only the released run fits
+  for (std::size_t slot{slots.Acquire()}; slot != kSlots; slot = slots.Acquire()) {
+  }
+  for (std::size_t slot{1}; slot < kSlots; slot += 2) {
+    if (slot < 490 || slot > 550) {
+      slots.Release(slot);
+    }
+  }
+  EXPECT_EQ(kSlots, slots.AcquireN(2));
+  slots.ReleaseN(500, 37);
+  EXPECT_EQ(500, slots.AcquireN(37)) << "Run must span the block boundaries";
+  EXPECT_EQ(kSlots, slots.AcquireN(kSlots + 1));
+
+  EXPECT_THROW(static_cast<void>(slots.AcquireN(0)), std::invalid_argument);
+  EXPECT_THROW(slots.ReleaseN(kSlots - 1, 2), std::out_of_range);
+  EXPECT_THROW(slots.ReleaseN(0, 2), std::invalid_argument) << "Slot 1 is free";
+}
+
+TEST_F(SlotAllocatorFixture, ConcurrentAcquireReleaseTest) {
+  bits::BitmapSlotAllocator<> slots{kSlots};
+  std::vector<std::vector<std::size_t>> owned(kThreads);
+
+  // Threads churn through the pool and finally keep everything they can get
+  std::vector<std::thread> threads;
+  for (std::size_t thread{}; thread < kThreads; ++thread) {
+    threads.emplace_back([&slots, &owned, thread]() -> void {
+      for (std::size_t round{}; round < 2000; ++round) {
+        if (const std::size_t run{slots.AcquireN(3)}; run != kSlots) {
+          slots.ReleaseN(run, 3);
+        }
+        if (const std::size_t slot{slots.Acquire()}; slot != kSlots) {
+          slots.Release(slot);
+        }
+      }
+      for (std::size_t slot{slots.Acquire()}; slot != kSlots; slot = slots.Acquire()) {
+        owned[thread].push_back(slot);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<bool> seen(kSlots);
+  std::size_t total{};
+  for (const auto& thread_slots : owned) {
+    for (const std::size_t slot : thread_slots) {
+      ASSERT_FALSE(seen[slot]) << "Slot must not be handed out twice";
+      seen[slot] = true;
+      ++total;
+    }
+  }
+  EXPECT_EQ(kSlots, total) << "Every slot must be found once the churn stops";
+  EXPECT_EQ(kSlots, slots.Count());
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <dynamic_bitset/snapshot_bitset.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class SnapshotBitsetFixture : public testing::Test {
+ protected:
+  static constexpr std::size_t kChunkBits{256};
+  static constexpr std::size_t kBits{10 * kChunkBits + 45};
+  static constexpr std::size_t kReaders{3};
+};
+
+TEST_F(SnapshotBitsetFixture, ConstructorTest) {
+  const bits::SnapshotBitset<> empty;
+  EXPECT_EQ(0, empty.Size());
+  EXPECT_EQ(empty.kDefaultChunkBits, empty.ChunkBits());
+  EXPECT_TRUE(empty.Snapshot().Empty());
+  EXPECT_EQ(0, empty.DirtyChunks());
+
+  bits::DynamicBitset<std::uint8_t> source(kBits);
+  source.Set(0, true).Set(kChunkBits, true).Set(kBits - 1, true);
+  const bits::SnapshotBitset<std::uint8_t> copy{source, kChunkBits};
+  EXPECT_EQ(kBits, copy.Size());
+  EXPECT_EQ(3, copy.Snapshot().Count());
+  EXPECT_EQ(source, copy.Snapshot().ToDynamicBitset());
+
+  EXPECT_THROW(bits::SnapshotBitset<>(0, 100), std::invalid_argument);
+  EXPECT_THROW(bits::SnapshotBitset<>(0, 32), std::invalid_argument);
+  EXPECT_THROW(bits::SnapshotBitset<>(0, 0), std::invalid_argument);
+}
+
+TEST_F(SnapshotBitsetFixture, CopyOnWritePublishTest) {
+  bits::SnapshotBitset<unsigned short> bits{kBits, kChunkBits};
+  const auto initial{bits.Snapshot()};
+
+  bits.Set(3).Set(kChunkBits + 1).Flip(kBits - 1);
+  EXPECT_EQ(3, bits.DirtyChunks()) << "Only written chunks must be copied";
+  EXPECT_TRUE(bits.Test(3));
+  EXPECT_FALSE(bits.Snapshot().Test(3)) << "Draft must stay invisible until Publish()";
+
+  bits.Publish();
+  EXPECT_EQ(0, bits.DirtyChunks());
+  const auto published{bits.Snapshot()};
+  EXPECT_LT(initial.Number(), published.Number());
+  EXPECT_TRUE(published.Test(3));
+  EXPECT_TRUE(published.Test(kBits - 1));
+  EXPECT_EQ(3, published.Count());
+
+  bits.Reset(3).Flip(kBits - 1);
+  bits.Publish();
+  EXPECT_EQ(0, initial.Count()) << "Old views must never change";
+  EXPECT_EQ(3, published.Count()) << "Old views must never change";
+  EXPECT_EQ(1, bits.Snapshot().Count());
+
+  bits::DynamicBitset<unsigned short> replacement(100);
+  replacement.Set();
+  bits.Assign(replacement);
+  EXPECT_EQ(100, bits.Size());
+  EXPECT_EQ(kBits, bits.Snapshot().Size());
+  bits.Publish();
+  EXPECT_EQ(100, bits.Snapshot().Count()) << "Bits past Size() must not be published";
+
+  EXPECT_THROW(bits.Set(100), std::out_of_range);
+  EXPECT_THROW(bits.Reset(100), std::out_of_range);
+  EXPECT_THROW(bits.Flip(100), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(bits.Test(100)), std::out_of_range);
+}
+
+TEST_F(SnapshotBitsetFixture, ConcurrentReadersTest) {
+  bits::SnapshotBitset<> bits{kBits, kChunkBits};
+  std::atomic<bool> stop{};
+  std::atomic<std::size_t> torn{};
+
+  // Writer keeps two chunks equal in every published version, readers must never see them differ
+  std::vector<std::thread> readers;
+  for (std::size_t reader{}; reader < kReaders; ++reader) {
+    readers.emplace_back([&bits, &stop, &torn]() -> void {
+      std::uint64_t last{};
+      while (!stop.load(std::memory_order_acquire)) {
+        const auto view{bits.Snapshot()};
+        torn.fetch_add(view.Number() < last, std::memory_order_relaxed);
+        last = view.Number();
+        for (std::size_t bit{}; bit < kChunkBits; ++bit) {
+          torn.fetch_add(view.Test(bit) != view.Test(kBits - kChunkBits + bit), std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+
+  for (std::size_t round{}; round < 500; ++round) {
+    const std::size_t bit{round * 37 % kChunkBits};
+    bits.Flip(bit).Flip(kBits - kChunkBits + bit);
+    bits.Publish();
+  }
+  stop.store(true, std::memory_order_release);
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(0, torn.load());
+  EXPECT_EQ(bits.Snapshot().Count() % 2, 0);
+}
+
+TEST_F(SnapshotBitsetFixture, PublishStressTest) {
+  bits::SnapshotBitset<> bits{kBits, kChunkBits};
+  std::atomic<bool> stop{};
+  std::atomic<std::size_t> broken{};
+
+  // Back-to-back publishes retire a version per call, a reader racing them must never load a freed handle
+  std::vector<std::thread> readers;
+  for (std::size_t reader{}; reader < kReaders; ++reader) {
+    readers.emplace_back([&bits, &stop, &broken]() -> void {
+      std::uint64_t last{};
+      while (!stop.load(std::memory_order_acquire)) {
+        const auto view{bits.Snapshot()};
+        broken.fetch_add(view.Size() != kBits || view.Number() < last, std::memory_order_relaxed);
+        last = view.Number();
+      }
+    });
+  }
+
+  for (std::size_t round{}; round < 20'000; ++round) {
+    if (round % 64 == 0) {
+      bits.Flip(round % kBits);
+    }
+    bits.Publish();
+  }
+  stop.store(true, std::memory_order_release);
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(0, broken.load());
+}
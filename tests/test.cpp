@@ -4,7 +4,9 @@
 #include <array>
 #include <cstdint>
 #include <dynamic_bitset/dynamic_bitset.hpp>
+#include <format>
 #include <memory_resource>
+#include <string>
 
 class DynamicBitsetFixture : public testing::Test {
  protected:
@@ -89,6 +91,21 @@ TEST_F(DynamicBitsetFixture, CountMethodTest) {
   EXPECT_EQ(16, filled_bitset.Count());
 }
 
+TEST_F(DynamicBitsetFixture, IntersectionCountMethodTest) {
+  EXPECT_EQ(0, empty_bitset.IntersectionCount(bits::DynamicBitset<>{}));
+  EXPECT_EQ(8, filled_bitset.IntersectionCount(bits::DynamicBitset<>{16, 0xf0'f0}));
+  EXPECT_THROW(static_cast<void>(filled_bitset.IntersectionCount(empty_bitset)), std::invalid_argument);
+
+  bits::DynamicBitset<std::uint8_t> lhs(130);
+  bits::DynamicBitset<std::uint8_t> rhs(130);
+  lhs.Set();
+  rhs.Set(0, true).Set(64, true).Set(129, true);
+  EXPECT_EQ(3, lhs.IntersectionCount(rhs));
+  lhs.PopBack();
+  rhs.PopBack();
+  EXPECT_EQ(2, lhs.IntersectionCount(rhs)) << "Bits past Size() must not be counted";
+}
+
 TEST_F(DynamicBitsetFixture, ReserveMethodTest) {
   EXPECT_THROW(empty_bitset.Reserve(std::numeric_limits<std::size_t>::max()), std::bad_array_new_length);
   empty_bitset.Reserve(10);
@@ -138,6 +155,26 @@ TEST_F(DynamicBitsetFixture, NoneMethodTest) {
   EXPECT_EQ(false, filled_bitset.None());
 }
 
+TEST_F(DynamicBitsetFixture, FindNextMethodTest) {
+  EXPECT_EQ(0, empty_bitset.FindFirst()) << "search on empty object must return Size()";
+  EXPECT_EQ(0, filled_bitset.FindFirst());
+  EXPECT_EQ(15, filled_bitset.FindNext(14));
+  EXPECT_EQ(16, filled_bitset.FindNext(15));
+
+  bits::DynamicBitset<unsigned char> test_bitset(203);
+  for (std::size_t bit : {3, 8, 9, 64, 130, 202}) {
+    test_bitset.Set(bit, true);
+  }
+  std::string found;
+  for (std::size_t bit{test_bitset.FindFirst()}; bit < test_bitset.Size(); bit = test_bitset.FindNext(bit)) {
+    found += std::to_string(bit) + ' ';
+  }
+  EXPECT_EQ("3 8 9 64 130 202 ", found);
+
+  test_bitset.PopBack();
+  EXPECT_EQ(202, test_bitset.FindNext(130)) << "bits beyond Size() must be ignored";
+}
+
 TEST_F(DynamicBitsetFixture, EmptyMethodTest) {
   EXPECT_EQ(true, empty_bitset.Empty()) << "empty object can not contain any bits";
   EXPECT_EQ(false, filled_bitset.Empty());
@@ -364,9 +401,96 @@ TEST_F(DynamicBitsetFixture, BitwiseInverseOperatorTest) {
   ASSERT_EQ(true, empty_bitset.None());
 }
 
+TEST_F(DynamicBitsetFixture, EqualityOperatorTest) {
+  bits::DynamicBitset<unsigned char> lhs{12, 0b1010'0101};
+  bits::DynamicBitset<unsigned char> rhs{12, 0b1010'0101};
+  EXPECT_EQ(lhs, rhs) << "unset bits in the last block must compare equal";
+
+  rhs.Set(9, true);
+  EXPECT_NE(lhs, rhs);
+
+  rhs.Reset(9);
+  rhs.Set(11, true);
+  rhs.PopBack();
+  lhs.PopBack();
+  EXPECT_EQ(lhs, rhs) << "bits past Size() must not be compared";
+}
+
 TEST_F(DynamicBitsetFixture, ToStringMethodTest) {
   EXPECT_EQ("", empty_bitset.ToString());
   EXPECT_EQ("1111111111111111", filled_bitset.ToString());
+
+  bits::DynamicBitset<unsigned char> test_bitset;
+  std::string expected;
+  for (std::size_t i{}; i < 203; ++i) {
+    const bool value{i % 3 == 0 || i % 7 == 0};
+    test_bitset.PushBack(value);
+    expected.push_back(value ? '1' : '0');
+    ASSERT_EQ(expected, test_bitset.ToString()) << "tail bits must be written for size " << i + 1;
+  }
+}
+
+TEST_F(DynamicBitsetFixture, ToHexStringMethodTest) {
+  EXPECT_EQ("", empty_bitset.ToHexString());
+  EXPECT_EQ("ffff", filled_bitset.ToHexString());
+
+  bits::DynamicBitset<> test_bitset{12, 0b0000'0001'1111};
+  EXPECT_EQ("f10", test_bitset.ToHexString());
+
+  test_bitset.Resize(14);
+  test_bitset.Set(13, true);
+  EXPECT_EQ("f102", test_bitset.ToHexString());
+
+  test_bitset.PopBack();
+  EXPECT_EQ("f100", test_bitset.ToHexString()) << "bits beyond Size() must not leak into the output";
+}
+
+TEST_F(DynamicBitsetFixture, FromHexStringMethodTest) {
+  EXPECT_EQ(empty_bitset, bits::DynamicBitset<>::FromHexString(""));
+  EXPECT_EQ(filled_bitset, bits::DynamicBitset<>::FromHexString("FFff"));
+  EXPECT_EQ("11111000", bits::DynamicBitset<>::FromHexString("f1").ToString());
+  EXPECT_THROW((void) bits::DynamicBitset<>::FromHexString("fg"), std::invalid_argument);
+  EXPECT_THROW((void) bits::DynamicBitset<>::FromHexString("fff", 4), std::invalid_argument);
+
+  bits::DynamicBitset<unsigned char> test_bitset;
+  for (std::size_t i{}; i < 150; ++i) {
+    test_bitset.PushBack(i % 5 == 0 || i % 11 == 0);
+    const auto restored{decltype(test_bitset)::FromHexString(test_bitset.ToHexString(), test_bitset.Size())};
+    ASSERT_EQ(test_bitset.ToString(), restored.ToString());
+    ASSERT_EQ(test_bitset.Count(), restored.Count());
+  }
+}
+
+TEST_F(DynamicBitsetFixture, FormatterTest) {
+  bits::DynamicBitset<unsigned char> test_bitset{12, 0b0000'0000};
+  test_bitset.Data()[0] = 0b0000'1111;
+  test_bitset.Data()[1] = 0b0000'1101;
+
+  EXPECT_EQ("", std::format("{}", empty_bitset));
+  EXPECT_EQ(filled_bitset.ToString(), std::format("{}", filled_bitset));
+  EXPECT_EQ("111100001011", std::format("{:b}", test_bitset));
+  EXPECT_EQ("f0d", std::format("{:x}", test_bitset));
+  EXPECT_EQ("0-3,8,10-11", std::format("{:r}", test_bitset));
+  EXPECT_EQ("", std::format("{:r}", empty_bitset));
+  EXPECT_EQ("1111", std::format("{:.4}", test_bitset));
+  EXPECT_EQ("f0", std::format("{:.8x}", test_bitset));
+  EXPECT_EQ("0-3,8", std::format("{:.10r}", test_bitset));
+  EXPECT_EQ("    11", std::format("{:>6.2}", test_bitset));
+  EXPECT_EQ("*f0d**", std::format("{:*^6x}", test_bitset));
+  EXPECT_EQ("0-3,8,10-11  ", std::format("{:13r}", test_bitset));
+  EXPECT_THROW((void) std::vformat("{:q}", std::make_format_args(test_bitset)), std::format_error);
+
+  bits::DynamicBitset<> large_bitset;
+  std::string expected_runs;
+  for (std::size_t i{}; i < 10'000; ++i) {
+    large_bitset.PushBack(i % 3 == 0);
+    if (i % 3 == 0) {
+      expected_runs += (expected_runs.empty() ? "" : ",") + std::to_string(i);
+    }
+  }
+  EXPECT_EQ(large_bitset.ToString(), std::format("{}", large_bitset));
+  EXPECT_EQ(large_bitset.ToHexString(), std::format("{:x}", large_bitset));
+  EXPECT_EQ(expected_runs, std::format("{:r}", large_bitset));
 }
 
 TEST_F(DynamicBitsetFixture, LhsAssignmentTest) {
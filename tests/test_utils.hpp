@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <dynamic_bitset/dynamic_bitset.hpp>
+#include <random>
+
+namespace bits::test {
+
+/**
+ * Returns `bits` bits filled block by block from a seeded engine, about one bit in eight is set if `sparse`.
+ */
+template<typename Block>
+auto MakeRandom(std::size_t bits, std::uint32_t seed, bool sparse = false) -> bits::DynamicBitset<Block> {
+  std::mt19937_64 engine{seed};
+  bits::DynamicBitset<Block> result(bits);
+  for (std::size_t block{}; block < result.NumBlocks(); ++block) {
+    result.Data()[block] = static_cast<Block>(sparse ? engine() & engine() & engine() : engine());
+  }
+  return result;
+}
+
+}  // namespace bits::test